@@ -78,6 +78,10 @@
  *(Not so important, you can adjust it to modify default sizes and spaces)*/
 #define LV_DPI_DEF 130     /*[px/inch]*/
 
+/*1: In LV_DISPLAY_RENDER_MODE_DIRECT move the already rendered content of a scrolled object in the draw buffer
+ *and redraw only the newly visible strip instead of the whole object*/
+#define LV_USE_SCROLL_BLIT 0
+
 /*=================
  * OPERATING SYSTEM
  *=================*/
@@ -179,6 +183,11 @@
         * radius * 4 bytes are used per circle (the most often used radiuses are saved)
         * 0: to disable caching */
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
+
+        /* Draw the arcs with an analytic anti-aliased ring sector rasterizer instead of
+         * stacking an angle and two radius masks. Can be enabled for a single arc too
+         * by setting `analytic` in its `lv_draw_arc_dsc_t`*/
+        #define LV_DRAW_SW_ARC_ANALYTIC 0
     #endif
 
     #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
@@ -304,6 +313,17 @@
      *0: Do not print file and line number of the log*/
     #define LV_LOG_USE_FILE_LINE 1
 
+    /*1: Don't format the logs when they are added but store them in binary form (level, timestamp,
+     *   address of the format string, function and file, and the arguments) in a ring buffer.
+     *   `lv_log_deferred_drain()` passes the records to a writer later and a host tool formats them.
+     *   The print callback and `LV_LOG_PRINTF` are not used then. With GCC and Clang the records are added
+     *   with atomics, without a lock, so any thread or interrupt can log. With other compilers and `LV_USE_OS`
+     *   they are added under `lv_lock()`, so don't log from interrupts there.*/
+    #define LV_LOG_DEFERRED 0
+    #if LV_LOG_DEFERRED
+        /*Size of the ring buffer of the log records in bytes. The records not fitting into it are dropped*/
+        #define LV_LOG_DEFERRED_BUF_SIZE 1024
+    #endif
 
     /*Enable/disable LV_LOG_TRACE in modules that produces a huge number of logs*/
     #define LV_LOG_TRACE_MEM        1
@@ -369,6 +389,26 @@
  *The main logic is like `LV_CACHE_DEF_SIZE` but for image headers.*/
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/*1: Evict images from the image cache by decode time per byte (GreedyDual-Size)
+ *   so that e.g. PNGs stay cached longer than binary images.
+ *   The decode time is measured with `lv_tick_get_us()`, set a microsecond clock with `lv_tick_set_us_cb()`.
+ *0: Evict the least recently used image*/
+#define LV_IMAGE_CACHE_COST_AWARE 0
+
+/*Split the image and image header caches into this many independently locked shards
+ *so that draw threads using different images don't wait for each other.
+ *The cache size is split evenly, so an image larger than `LV_CACHE_DEF_SIZE / LV_IMAGE_CACHE_SHARD_CNT`
+ *can't be cached. 1: no sharding*/
+#define LV_IMAGE_CACHE_SHARD_CNT 1
+
+/*Period in ms to log the hits, misses, evictions and decode time of the image caches. 0: disable*/
+#define LV_CACHE_STATS_DUMP_PERIOD 0
+
+/*Number of texts whose line breaks and line widths are cached.
+ *Measuring and drawing a label reuse the same layout instead of walking the glyphs again.
+ *Only texts shorter than 512 bytes are cached. 0: disable*/
+#define LV_TEXT_LAYOUT_CACHE_CNT 0
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #define LV_GRADIENT_MAX_STOPS   2
@@ -380,6 +420,14 @@
 /* Add 2 x 32 bit variables to each lv_obj_t to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/* Keep the memory of up to this many deleted objects per widget class and reuse it
+ * for new objects of the same class, e.g. when screens are destroyed and created again.
+ * 0: disable */
+#define LV_OBJ_POOL_DEPTH       0
+
+/* Number of widget classes whose deleted objects can be kept */
+#define LV_OBJ_POOL_CLASS_CNT   8
+
 /* Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -729,6 +777,7 @@
     #define LV_FS_POSIX_LETTER '\0'     /*Set an upper cased letter on which the drive will accessible (e.g. 'A')*/
     #define LV_FS_POSIX_PATH ""         /*Set the working directory. File/directory paths will be appended to it.*/
     #define LV_FS_POSIX_CACHE_SIZE 0    /*>0 to cache this number of bytes in lv_fs_read()*/
+    #define LV_FS_POSIX_MMAP 0          /*1: let the binary font and image loaders use mmap()ed files without copying*/
 #endif
 
 /*API for CreateFile, ReadFile, etc*/
@@ -798,6 +847,14 @@
 /*Decode bin images to RAM*/
 #define LV_BIN_DECODER_RAM_LOAD 0
 
+/*Decompress RLE compressed bin images row block by row block while drawing
+ *instead of into a full size buffer. Needs LV_USE_RLE*/
+#define LV_BIN_DECODER_STREAM 0
+#if LV_BIN_DECODER_STREAM
+    /*Number of rows decompressed at once. A restart point is also saved at every row block*/
+    #define LV_BIN_DECODER_STREAM_ROWS 8
+#endif
+
 /*RLE decompress library*/
 #define LV_USE_RLE 0
 
@@ -824,6 +881,11 @@
     /* Enable loading TTF data from files */
     #define LV_TINY_TTF_FILE_SUPPORT 0
     #define LV_TINY_TTF_CACHE_GLYPH_CNT 256
+    /* >0: pack the rasterized glyphs into A8 atlas pages of this width and height in pixels
+     * instead of allocating a draw buffer for each glyph */
+    #define LV_TINY_TTF_ATLAS_SIZE 0
+    /* Maximum number of atlas pages of a font. If all are full the oldest one is cleared. */
+    #define LV_TINY_TTF_ATLAS_PAGE_CNT 4
 #endif
 
 /*Rlottie library*/
@@ -896,6 +958,22 @@
         #define LV_PROFILER_BUILTIN_BUF_SIZE (16 * 1024)     /*[bytes]*/
     #endif
 
+    /*1: Enable the binary profiler. It records fixed size events into a lock-free ring buffer
+     *per thread. Use it by setting the macros below to `LV_PROFILER_BIN_...` and
+     *LV_PROFILER_INCLUDE to "lvgl/src/misc/lv_profiler_bin.h".
+     *Convert the output of `lv_profiler_bin_dump()` with `scripts/trace_bin2json.py`*/
+    #define LV_USE_PROFILER_BIN 0
+    #if LV_USE_PROFILER_BIN
+        /*Trace buffer size of each thread*/
+        #define LV_PROFILER_BIN_BUF_SIZE (16 * 1024)     /*[bytes]*/
+
+        /*Maximum number of threads which can record events*/
+        #define LV_PROFILER_BIN_THREAD_MAX 4
+
+        /*Maximum number of different tags. Must be a power of 2*/
+        #define LV_PROFILER_BIN_TAG_MAX 256
+    #endif
+
     /*Header to include for the profiler*/
     #define LV_PROFILER_INCLUDE "lvgl/src/misc/lv_profiler_builtin.h"
 
@@ -997,6 +1075,10 @@
     #define LV_LINUX_FBDEV_RENDER_MODE   LV_DISPLAY_RENDER_MODE_PARTIAL
     #define LV_LINUX_FBDEV_BUFFER_COUNT  0
     #define LV_LINUX_FBDEV_BUFFER_SIZE   60
+    /*Render directly into two halves of the framebuffer and flip between them by panning instead of copying.
+     *Needs a driver supporting a virtual resolution twice the screen height. Falls back to copying otherwise.
+     *Works with LV_DISPLAY_RENDER_MODE_DIRECT and LV_DISPLAY_RENDER_MODE_FULL. Not supported with LV_LINUX_FBDEV_BSD*/
+    #define LV_LINUX_FBDEV_PAGE_FLIP     0
 #endif
 
 /*Use Nuttx to open window and handle touchscreen*/
@@ -1048,8 +1130,9 @@
 #define LV_USE_ST7789        0
 #define LV_USE_ST7796        0
 #define LV_USE_ILI9341       0
+#define LV_USE_GC9A01        0
 
-#define LV_USE_GENERIC_MIPI (LV_USE_ST7735 | LV_USE_ST7789 | LV_USE_ST7796 | LV_USE_ILI9341)
+#define LV_USE_GENERIC_MIPI (LV_USE_ST7735 | LV_USE_ST7789 | LV_USE_ST7796 | LV_USE_ILI9341 | LV_USE_GC9A01)
 
 /*Driver for Renesas GLCD*/
 #define LV_USE_RENESAS_GLCDC    0
@@ -31,8 +31,10 @@ extern "C" {
 #include "src/misc/lv_async.h"
 #include "src/misc/lv_anim_timeline.h"
 #include "src/misc/lv_profiler_builtin.h"
+#include "src/misc/lv_profiler_bin.h"
 #include "src/misc/lv_rb.h"
 #include "src/misc/lv_utils.h"
+#include "src/misc/cache/lv_text_layout_cache.h"
 
 #include "src/tick/lv_tick.h"
 
@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+
+"""
+Convert the output of the LVGL binary profiler (lv_profiler_bin_dump() or the chunks
+written by lv_profiler_bin_flush()) to the Chrome trace event format.
+The result can be opened in https://ui.perfetto.dev or chrome://tracing
+
+Usage: trace_bin2json.py trace.bin [-o trace.json] [--pid 1]
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = b"LVPB"
+# Version 2 added the dropped event count to the chunk header
+VERSIONS = (1, 2)
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+        self.endian = "<"
+
+    def left(self):
+        return len(self.data) - self.pos
+
+    def read(self, fmt):
+        fmt = self.endian + fmt
+        size = struct.calcsize(fmt)
+        if self.left() < size:
+            raise ValueError("truncated trace at offset %d" % self.pos)
+        values = struct.unpack_from(fmt, self.data, self.pos)
+        self.pos += size
+        return values
+
+    def read_bytes(self, size):
+        if self.left() < size:
+            raise ValueError("truncated trace at offset %d" % self.pos)
+        b = self.data[self.pos:self.pos + size]
+        self.pos += size
+        return b
+
+
+def parse_chunk(r, threads, tags):
+    magic = r.read_bytes(4)
+    if magic != MAGIC:
+        raise ValueError("bad magic at offset %d" % (r.pos - 4))
+
+    # The version tells the byte order of the target
+    r.endian = "<"
+    (version,) = r.read("H")
+    if version not in VERSIONS:
+        r.endian = ">"
+        version = struct.unpack(">H", struct.pack("<H", version))[0]
+        if version not in VERSIONS:
+            raise ValueError("unsupported version %d" % version)
+
+    ring_cnt, tick_per_sec, tag_cnt = r.read("HII")
+    (dropped,) = r.read("I") if version >= 2 else (0,)
+
+    for _ in range(tag_cnt):
+        tag_id, length = r.read("HH")
+        tags[tag_id] = r.read_bytes(length).decode("utf-8", "replace")
+
+    lost = 0
+    for _ in range(ring_cnt):
+        tid, ring_lost, event_cnt = r.read("iII")
+        lost += ring_lost
+        thread = threads.setdefault(tid, {"events": [], "last": None, "wrap": 0})
+        for _ in range(event_cnt):
+            tick, tag_id, ev_type, cpu = r.read("IHBB")
+
+            # Unwrap the 32 bit tick counter
+            if thread["last"] is not None and tick < thread["last"] and thread["last"] - tick > 0x80000000:
+                thread["wrap"] += 1 << 32
+            thread["last"] = tick
+
+            ts = (tick + thread["wrap"]) * 1000000.0 / tick_per_sec
+            thread["events"].append((ts, tag_id, chr(ev_type), cpu))
+
+    return lost, dropped
+
+
+def convert(data, pid):
+    r = Reader(data)
+    threads = {}
+    tags = {}
+    lost = 0
+    dropped = 0
+    while r.left() > 0:
+        chunk_lost, chunk_dropped = parse_chunk(r, threads, tags)
+        lost += chunk_lost
+        dropped += chunk_dropped
+
+    trace = []
+    for tid, thread in sorted(threads.items()):
+        trace.append({"name": "thread_name", "ph": "M", "pid": pid, "tid": tid,
+                      "args": {"name": "LVGL-%d" % tid}})
+        for ts, tag_id, ev_type, cpu in thread["events"]:
+            trace.append({"name": tags.get(tag_id, "<unknown>"), "ph": ev_type,
+                          "ts": ts, "pid": pid, "tid": tid, "args": {"cpu": cpu}})
+
+    return {"traceEvents": trace, "displayTimeUnit": "ms"}, lost, dropped
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert an LVGL binary profiler dump to Chrome trace JSON")
+    parser.add_argument("input", help="binary dump written by lv_profiler_bin_dump()")
+    parser.add_argument("-o", "--output", help="output JSON file (default: stdout)")
+    parser.add_argument("--pid", type=int, default=1, help="process ID to show in the trace")
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as f:
+        trace, lost, dropped = convert(f.read(), args.pid)
+
+    if lost:
+        print("warning: %d events were overwritten before being flushed" % lost, file=sys.stderr)
+    if dropped:
+        print("warning: %d events of threads without a ring were dropped, increase LV_PROFILER_BIN_THREAD_MAX"
+              % dropped, file=sys.stderr)
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(trace, f)
+    else:
+        json.dump(trace, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
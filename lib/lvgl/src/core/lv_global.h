@@ -21,6 +21,7 @@ extern "C" {
 #include "../draw/sw/lv_draw_sw.h"
 #endif
 #include "../misc/lv_anim.h"
+#include "../misc/lv_array.h"
 #include "../misc/lv_area.h"
 #include "../misc/lv_color_op.h"
 #include "../misc/lv_ll.h"
@@ -42,6 +43,7 @@ extern "C" {
 
 #include "../misc/lv_timer_private.h"
 #include "../misc/lv_anim_private.h"
+#include "lv_obj_class_private.h"
 #include "../tick/lv_tick_private.h"
 #include "../draw/lv_draw_buf_private.h"
 #include "../draw/lv_draw_private.h"
@@ -120,6 +122,7 @@ typedef struct lv_global_t {
 
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
+    lv_cache_t * text_layout_cache;
 
     lv_draw_global_info_t draw_info;
 #if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
@@ -137,6 +140,15 @@ typedef struct lv_global_t {
     uint32_t log_last_log_time;
 #endif
 
+#if LV_USE_LOG && LV_LOG_DEFERRED
+    uint8_t log_ring[LV_LOG_DEFERRED_BUF_SIZE];
+    volatile uint32_t log_ring_head;
+    volatile uint32_t log_ring_tail;
+    uint32_t log_ring_ready;
+    uint32_t log_dropped_cnt;
+    uint32_t log_dropped_pending;
+#endif
+
 #if LV_USE_THEME_SIMPLE
     void * theme_simple;
 #endif
@@ -197,6 +209,10 @@ typedef struct lv_global_t {
     struct lv_profiler_builtin_ctx_t * profiler_context;
 #endif
 
+#if LV_USE_PROFILER && LV_USE_PROFILER_BIN
+    struct lv_profiler_bin_ctx_t * profiler_bin_context;
+#endif
+
 #if LV_USE_FILE_EXPLORER != 0
     lv_style_t fe_list_button_style;
 #endif
@@ -209,6 +225,15 @@ typedef struct lv_global_t {
     size_t ime_cand_len;
 #endif
 
+#if LV_OBJ_POOL_DEPTH
+    lv_obj_pool_t obj_pool;
+#endif
+
+#if LV_USE_OBSERVER
+    lv_array_t subject_pending;         /**< Coalescing subjects waiting for the next refresh*/
+    bool subject_flush_in_progress;
+#endif
+
 #if LV_USE_OBJ_ID_BUILTIN
     void * objid_array;
     uint32_t objid_count;
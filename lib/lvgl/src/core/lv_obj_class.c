@@ -12,11 +12,13 @@
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "../stdlib/lv_string.h"
+#include "lv_global.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define MY_CLASS (&lv_obj_class)
+#define obj_pool LV_GLOBAL_DEFAULT()->obj_pool
 
 /**********************
  *      TYPEDEFS
@@ -31,6 +33,7 @@
  **********************/
 static void lv_obj_construct(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static uint32_t get_instance_size(const lv_obj_class_t * class_p);
+static lv_obj_t * alloc_obj(const lv_obj_class_t * class_p, uint32_t size);
 
 /**********************
  *  STATIC VARIABLES
@@ -48,7 +51,7 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
 {
     LV_TRACE_OBJ_CREATE("Creating object with %p class on %p parent", (void *)class_p, (void *)parent);
     uint32_t s = get_instance_size(class_p);
-    lv_obj_t * obj = lv_malloc_zeroed(s);
+    lv_obj_t * obj = alloc_obj(class_p, s);
     if(obj == NULL) return NULL;
     obj->class_p = class_p;
     obj->parent = parent;
@@ -146,6 +149,60 @@ void lv_obj_destruct(lv_obj_t * obj)
     }
 }
 
+void lv_obj_class_free_obj(lv_obj_t * obj, const lv_obj_class_t * class_p)
+{
+#if LV_OBJ_POOL_DEPTH
+    /*Find the slot of the class or claim an unused one*/
+    lv_obj_pool_slot_t * slot = NULL;
+    uint32_t i;
+    for(i = 0; i < LV_OBJ_POOL_CLASS_CNT; i++) {
+        if(obj_pool.slots[i].class_p == class_p) {
+            slot = &obj_pool.slots[i];
+            break;
+        }
+        if(slot == NULL && obj_pool.slots[i].class_p == NULL) slot = &obj_pool.slots[i];
+    }
+
+    if(slot && slot->free_cnt < LV_OBJ_POOL_DEPTH) {
+        slot->class_p = class_p;
+        *(void **)obj = slot->free_head;
+        slot->free_head = obj;
+        slot->free_cnt++;
+        return;
+    }
+#else
+    LV_UNUSED(class_p);
+#endif
+
+    lv_free(obj);
+}
+
+void lv_obj_class_pool_flush(void)
+{
+#if LV_OBJ_POOL_DEPTH
+    uint32_t i;
+    for(i = 0; i < LV_OBJ_POOL_CLASS_CNT; i++) {
+        lv_obj_pool_slot_t * slot = &obj_pool.slots[i];
+        while(slot->free_head) {
+            void * next = *(void **)slot->free_head;
+            lv_free(slot->free_head);
+            slot->free_head = next;
+        }
+        slot->free_cnt = 0;
+        slot->class_p = NULL;
+    }
+#endif
+}
+
+uint32_t lv_obj_class_pool_get_reuse_count(void)
+{
+#if LV_OBJ_POOL_DEPTH
+    return obj_pool.reuse_cnt;
+#else
+    return 0;
+#endif
+}
+
 bool lv_obj_is_editable(lv_obj_t * obj)
 {
     const lv_obj_class_t * class_p = obj->class_p;
@@ -192,6 +249,30 @@ static void lv_obj_construct(const lv_obj_class_t * class_p, lv_obj_t * obj)
     if(obj->class_p->constructor_cb) obj->class_p->constructor_cb(class_p, obj);
 }
 
+static lv_obj_t * alloc_obj(const lv_obj_class_t * class_p, uint32_t size)
+{
+#if LV_OBJ_POOL_DEPTH
+    uint32_t i;
+    for(i = 0; i < LV_OBJ_POOL_CLASS_CNT; i++) {
+        lv_obj_pool_slot_t * slot = &obj_pool.slots[i];
+        if(slot->class_p != class_p) continue;
+
+        if(slot->free_cnt == 0) break;
+
+        lv_obj_t * obj = slot->free_head;
+        slot->free_head = *(void **)obj;
+        slot->free_cnt--;
+        obj_pool.reuse_cnt++;
+        lv_memzero(obj, size);
+        return obj;
+    }
+#else
+    LV_UNUSED(class_p);
+#endif
+
+    return lv_malloc_zeroed(size);
+}
+
 static uint32_t get_instance_size(const lv_obj_class_t * class_p)
 {
     /*Find a base in which instance size is set*/
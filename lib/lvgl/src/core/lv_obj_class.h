@@ -61,6 +61,17 @@ bool lv_obj_is_editable(lv_obj_t * obj);
 
 bool lv_obj_is_group_def(lv_obj_t * obj);
 
+/**
+ * Free the memory of the deleted objects kept for reuse (see `LV_OBJ_POOL_DEPTH`)
+ */
+void lv_obj_class_pool_flush(void);
+
+/**
+ * Get how many objects were created by reusing the memory of deleted ones
+ * @return      number of objects taken from the pool
+ */
+uint32_t lv_obj_class_pool_get_reuse_count(void);
+
 /**********************
  *      MACROS
  **********************/
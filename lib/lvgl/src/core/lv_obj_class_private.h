@@ -24,6 +24,22 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_OBJ_POOL_DEPTH
+/**
+ * Deleted objects of a class kept to reuse their memory
+ */
+typedef struct {
+    const lv_obj_class_t * class_p;     /**< NULL if the slot is unused*/
+    void * free_head;                   /**< Free objects linked through their first pointer*/
+    uint32_t free_cnt;
+} lv_obj_pool_slot_t;
+
+typedef struct {
+    lv_obj_pool_slot_t slots[LV_OBJ_POOL_CLASS_CNT];
+    uint32_t reuse_cnt;                 /**< Number of objects created from the pool*/
+} lv_obj_pool_t;
+#endif
+
 /**
  * Describe the common methods of every object.
  * Similar to a C++ class.
@@ -58,6 +74,9 @@ struct lv_obj_class_t {
     uint32_t group_def : 2;            /**< Value from ::lv_obj_class_group_def_t*/
     uint32_t instance_size : 16;
     uint32_t theme_inheritable : 1;    /**< Value from ::lv_obj_class_theme_inheritable_t*/
+    uint32_t scroll_blit : 1;          /**< 1: draws only a background under the children, so its rendered
+                                        *   content can be moved when scrolled (see `LV_USE_SCROLL_BLIT`).
+                                        *   Not inherited.*/
 };
 
 
@@ -67,6 +86,13 @@ struct lv_obj_class_t {
 
 void lv_obj_destruct(lv_obj_t * obj);
 
+/**
+ * Free the memory of a deleted object or keep it for the next object of the same class
+ * @param obj       pointer to an already destructed object
+ * @param class_p   the class the object was created with
+ */
+void lv_obj_class_free_obj(lv_obj_t * obj, const lv_obj_class_t * class_p);
+
 /**********************
  *      MACROS
  **********************/
@@ -556,6 +556,7 @@ static void obj_delete_core(lv_obj_t * obj)
     }
 
     /*All children deleted. Now clean up the object specific data*/
+    const lv_obj_class_t * class_p = obj->class_p;
     lv_obj_destruct(obj);
 
     /*Remove the screen for the screen list*/
@@ -587,7 +588,7 @@ static void obj_delete_core(lv_obj_t * obj)
     }
 
     /*Free the object itself*/
-    lv_free(obj);
+    lv_obj_class_free_obj(obj, class_p);
 }
 
 static lv_obj_tree_walk_res_t walk_core(lv_obj_t * obj, lv_obj_tree_walk_cb_t cb, void * user_data)
@@ -32,6 +32,12 @@
 /*Display being refreshed*/
 #define disp_refr LV_GLOBAL_DEFAULT()->disp_refresh
 
+/*Bits of the draw events in `lv_event_list_t::code_mask`*/
+#define SCROLL_BLIT_EVENT_RANGE(first, last) \
+    (((uint64_t)1 << ((last) + 1)) - ((uint64_t)1 << (first)))
+#define SCROLL_BLIT_DRAW_EVENT_MASK      SCROLL_BLIT_EVENT_RANGE(LV_EVENT_DRAW_MAIN_BEGIN, LV_EVENT_DRAW_TASK_ADDED)
+#define SCROLL_BLIT_DRAW_POST_EVENT_MASK SCROLL_BLIT_EVENT_RANGE(LV_EVENT_DRAW_POST_BEGIN, LV_EVENT_DRAW_POST_END)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -40,6 +46,7 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static uint64_t get_area_cost(lv_display_t * disp, const lv_area_t * area);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p);
@@ -51,6 +58,13 @@ static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h)
 static void draw_buf_flush(lv_display_t * disp);
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 static void wait_for_flushing(lv_display_t * disp);
+#if LV_USE_SCROLL_BLIT
+    static void refr_scroll_blit(void);
+    static bool scroll_blit_is_possible(lv_obj_t * obj);
+    static bool scroll_blit_is_covered(lv_obj_t * obj, const lv_area_t * area);
+    static bool scroll_blit_obj_is_on(lv_obj_t * obj, const lv_area_t * area);
+    static void scroll_blit_inv_static(lv_display_t * disp, lv_obj_t * obj, const lv_area_t * area);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -327,6 +341,81 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 }
 
+#if LV_USE_SCROLL_BLIT
+bool lv_refr_scroll_blit(lv_obj_t * obj, int32_t dx, int32_t dy)
+{
+    lv_display_t * disp = lv_obj_get_display(obj);
+    if(disp == NULL) return false;
+
+    /*Only in direct mode has the draw buffer the whole last frame*/
+    if(disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT) return false;
+    if(!lv_display_is_invalidation_enabled(disp)) return false;
+    if(lv_display_get_rotation(disp) != LV_DISPLAY_ROTATION_0) return false;
+    if(lv_color_format_get_bpp(disp->color_format) < 8) return false;
+
+    /*During screen load animations two screens are drawn*/
+    if(lv_obj_get_screen(obj) != disp->act_scr || disp->prev_scr) return false;
+    if(!scroll_blit_is_possible(obj)) return false;
+
+    /*The visible area can be a little larger than the object, but only the object's content is moved*/
+    lv_area_t area = obj->coords;
+    if(!lv_obj_area_is_visible(obj, &area)) return false;
+    if(!lv_area_intersect(&area, &area, &obj->coords)) return false;
+
+    lv_area_t scr_area;
+    lv_area_set(&scr_area, 0, 0, lv_display_get_horizontal_resolution(disp) - 1,
+                lv_display_get_vertical_resolution(disp) - 1);
+    if(!lv_area_intersect(&area, &area, &scr_area)) return false;
+    if(scroll_blit_is_covered(obj, &area)) return false;
+
+    /*Only one object can be moved in a refresh period*/
+    if(disp->scroll_blit_obj == NULL) {
+        disp->scroll_blit_obj = obj;
+        disp->scroll_blit_area = area;
+        disp->scroll_blit_ofs.x = 0;
+        disp->scroll_blit_ofs.y = 0;
+    }
+    else if(disp->scroll_blit_obj != obj || !lv_area_is_equal(&disp->scroll_blit_area, &area)) {
+        return false;
+    }
+
+    disp->scroll_blit_ofs.x += dx;
+    disp->scroll_blit_ofs.y += dy;
+
+    /*The border and the scrollbars stay in place, so redraw them and where their old pixels are moved*/
+    scroll_blit_inv_static(disp, obj, &area);
+
+    /*The old content of the already invalidated areas is moved too, so redraw where it lands.
+     *The moved copies are moved again by the next scroll steps.*/
+    uint32_t inv_p = disp->inv_p;
+    uint32_t i;
+    for(i = 0; i < inv_p && i < disp->inv_p; i++) {
+        lv_area_t moved;
+        if(!lv_area_intersect(&moved, &disp->inv_areas[i], &area)) continue;
+        lv_area_move(&moved, dx, dy);
+        if(lv_area_intersect(&moved, &moved, &area)) lv_inv_area(disp, &moved);
+    }
+
+    /*Redraw the newly visible strips*/
+    lv_area_t strip;
+    if(dy != 0) {
+        strip = area;
+        if(dy > 0) strip.y2 = LV_MIN(area.y2, area.y1 + dy - 1);
+        else strip.y1 = LV_MAX(area.y1, area.y2 + dy + 1);
+        lv_inv_area(disp, &strip);
+    }
+
+    if(dx != 0) {
+        strip = area;
+        if(dx > 0) strip.x2 = LV_MIN(area.x2, area.x1 + dx - 1);
+        else strip.x1 = LV_MAX(area.x1, area.x2 + dx + 1);
+        lv_inv_area(disp, &strip);
+    }
+
+    return true;
+}
+#endif
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -395,6 +484,9 @@ void lv_display_refr_timer(lv_timer_t * tmr)
 
     lv_refr_join_area();
     refr_sync_areas();
+#if LV_USE_SCROLL_BLIT
+    refr_scroll_blit();
+#endif
     refr_invalid_areas();
 
     if(disp_refr->inv_p == 0) goto refr_finish;
@@ -421,6 +513,10 @@ void lv_display_refr_timer(lv_timer_t * tmr)
 
 refr_finish:
 
+#if LV_USE_SCROLL_BLIT
+    disp_refr->scroll_blit_obj = NULL;
+#endif
+
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_cleanup();
 #endif
@@ -454,16 +550,17 @@ static void lv_refr_join_area(void)
                 continue;
             }
 
-            /*Check if the areas are on each other*/
-            if(lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
+            /*Without a flush cost separate areas can't be cheaper joined, so check only the ones on each other*/
+            if(disp_refr->refr_flush_cost == 0 &&
+               lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
                 continue;
             }
 
             lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
+            /*Join two area only if refreshing the joined area costs less*/
+            if(get_area_cost(disp_refr, &joined_area) < (get_area_cost(disp_refr, &disp_refr->inv_areas[join_in]) +
+                                                         get_area_cost(disp_refr, &disp_refr->inv_areas[join_from]))) {
                 lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
 
                 /*Mark 'join_form' is joined into 'join_in'*/
@@ -474,6 +571,33 @@ static void lv_refr_join_area(void)
     LV_PROFILER_END;
 }
 
+/**
+ * Estimate the cost of refreshing an area with the display's cost model.
+ * In partial mode an area is rendered and flushed in as many parts as the draw buffer requires.
+ * @param disp      pointer to a display
+ * @param area      pointer to an area
+ * @return          `flush_cost` for each flush plus `px_cost` for each pixel
+ */
+static uint64_t get_area_cost(lv_display_t * disp, const lv_area_t * area)
+{
+    int32_t w = lv_area_get_width(area);
+    int32_t h = lv_area_get_height(area);
+    uint64_t cost = (uint64_t)w * h * disp->refr_px_cost;
+    if(disp->refr_flush_cost == 0) return cost;
+
+    uint32_t flush_cnt = 1;
+    if(disp->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL && disp->buf_act) {
+        /*Same as `get_max_row()` but without the rounder, it's called too often for that*/
+        uint32_t stride = lv_draw_buf_width_to_stride(w, disp->color_format);
+        uint32_t overhead = LV_COLOR_INDEXED_PALETTE_SIZE(disp->color_format) * sizeof(lv_color32_t);
+        uint32_t max_row = disp->buf_act->data_size > overhead ? (disp->buf_act->data_size - overhead) / stride : 0;
+        if(max_row == 0) max_row = 1;
+        flush_cnt = (h + max_row - 1) / max_row;
+    }
+
+    return cost + (uint64_t)flush_cnt * disp->refr_flush_cost;
+}
+
 /**
  * Refresh the sync areas
  */
@@ -552,6 +676,253 @@ static void refr_sync_areas(void)
     LV_PROFILER_END;
 }
 
+#if LV_USE_SCROLL_BLIT
+/**
+ * Move the content of the scrolled object in the draw buffer and flush it.
+ * The invalidated areas are rendered over it later.
+ */
+static void refr_scroll_blit(void)
+{
+    if(disp_refr->scroll_blit_obj == NULL) return;
+    disp_refr->scroll_blit_obj = NULL;
+
+    /*If the display was changed since the scrolling redraw the whole area*/
+    lv_area_t area = disp_refr->scroll_blit_area;
+    if(disp_refr->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT ||
+       lv_display_get_rotation(disp_refr) != LV_DISPLAY_ROTATION_0) {
+        lv_inv_area(disp_refr, &area);
+        return;
+    }
+
+    /*The part of the area which gets content from the last frame*/
+    lv_point_t ofs = disp_refr->scroll_blit_ofs;
+    lv_area_t dest = area;
+    lv_area_move(&dest, ofs.x, ofs.y);
+    if(!lv_area_intersect(&dest, &dest, &area)) return;
+
+    /*Nothing to move if it's redrawn anyway*/
+    uint32_t i;
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(disp_refr->inv_area_joined[i]) continue;
+        if(lv_area_is_in(&dest, &disp_refr->inv_areas[i], 0)) return;
+    }
+
+    /*The flush of the last invalidated area marks the end of the frame, so there has to be one*/
+    if(disp_refr->inv_p == 0) {
+        lv_inv_area(disp_refr, &dest);
+        return;
+    }
+
+    LV_PROFILER_BEGIN;
+    wait_for_flushing(disp_refr);
+
+    /*With double buffering copy from the buffer on the screen, else move in place*/
+    lv_draw_buf_t * buf = disp_refr->buf_act;
+    const lv_draw_buf_t * src_buf = buf;
+    if(lv_display_is_double_buffered(disp_refr)) {
+        src_buf = buf == disp_refr->buf_1 ? disp_refr->buf_2 : disp_refr->buf_1;
+    }
+
+    uint32_t px_size = lv_color_format_get_size(disp_refr->color_format);
+    uint32_t stride = buf->header.stride;
+    uint32_t line_size = lv_area_get_width(&dest) * px_size;
+    uint8_t * dest_p = buf->data + dest.y1 * stride + dest.x1 * px_size;
+    const uint8_t * src_p = src_buf->data + (dest.y1 - ofs.y) * stride + (dest.x1 - ofs.x) * px_size;
+    int32_t h = lv_area_get_height(&dest);
+    int32_t y;
+
+    /*Moving down in the same buffer start with the last line to not overwrite the source*/
+    if(ofs.y > 0) {
+        for(y = h - 1; y >= 0; y--) {
+            lv_memmove(dest_p + y * stride, src_p + y * stride, line_size);
+        }
+    }
+    else {
+        for(y = 0; y < h; y++) {
+            lv_memmove(dest_p + y * stride, src_p + y * stride, line_size);
+        }
+    }
+
+    /*Send the moved content to the display*/
+    disp_refr->layer_head->draw_buf = buf;
+    disp_refr->refreshed_area = dest;
+    disp_refr->last_area = 0;
+    disp_refr->last_part = 0;
+    draw_buf_flush(disp_refr);
+
+    /*The other buffer needs to be synchronized on the next refresh as well*/
+    if(lv_display_is_double_buffered(disp_refr)) {
+        lv_area_t * sync_area = lv_ll_ins_tail(&disp_refr->sync_areas);
+        *sync_area = dest;
+    }
+
+    LV_PROFILER_END;
+}
+
+/**
+ * Check if an object draws only a plain background, border and scrollbars under its children
+ * and nothing prevents moving its rendered content
+ * @param obj   pointer to the scrolled object
+ * @return      true: the content of the object can be moved
+ */
+static bool scroll_blit_is_possible(lv_obj_t * obj)
+{
+    /*Only the classes drawing nothing else than a background under their children*/
+    if(!obj->class_p->scroll_blit) return false;
+
+    /*The user might draw anything in the draw events*/
+    if(obj->spec_attr && (obj->spec_attr->event_list.code_mask & SCROLL_BLIT_DRAW_EVENT_MASK)) return false;
+
+    /*The background needs to be the same everywhere to be moved with the content*/
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) < LV_OPA_MAX) return false;
+    if(lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN) < LV_OPA_MAX) return false;
+    if(lv_obj_get_style_radius(obj, LV_PART_MAIN) != 0) return false;
+    if(lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) != LV_GRAD_DIR_NONE) return false;
+    if(lv_obj_get_style_bg_grad(obj, LV_PART_MAIN) != NULL) return false;
+    if(lv_obj_get_style_bg_image_src(obj, LV_PART_MAIN) != NULL) return false;
+    if(lv_obj_get_style_outline_width(obj, LV_PART_MAIN) > 0 &&
+       lv_obj_get_style_outline_pad(obj, LV_PART_MAIN) < 0) return false;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return false;
+
+    /*Floating children are not moved by scrolling*/
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        if(lv_obj_has_flag(obj->spec_attr->children[i], LV_OBJ_FLAG_FLOATING)) return false;
+    }
+
+    /*Layers are blended to the buffer, the content can't be moved there*/
+    while(obj) {
+        if(lv_obj_get_layer_type(obj) != LV_LAYER_TYPE_NONE) return false;
+        obj = lv_obj_get_parent(obj);
+    }
+
+    return true;
+}
+
+/**
+ * Check if anything is drawn on an area of an object after the object
+ * @param obj   pointer to the scrolled object
+ * @param area  the visible area of the object
+ * @return      true: something else is drawn on the area
+ */
+static bool scroll_blit_is_covered(lv_obj_t * obj, const lv_area_t * area)
+{
+    uint32_t i;
+    lv_obj_t * parent = lv_obj_get_parent(obj);
+    while(parent) {
+        /*The siblings drawn later*/
+        uint32_t child_cnt = lv_obj_get_child_count(parent);
+        for(i = (uint32_t)lv_obj_get_index(obj) + 1; i < child_cnt; i++) {
+            if(scroll_blit_obj_is_on(parent->spec_attr->children[i], area)) return true;
+        }
+
+        /*The parent draws its scrollbars and maybe its border after its children*/
+        lv_area_t hor_area;
+        lv_area_t ver_area;
+        lv_obj_get_scrollbar_area(parent, &hor_area, &ver_area);
+        if(lv_area_is_on(&hor_area, area) || lv_area_is_on(&ver_area, area)) return true;
+        if(lv_obj_get_style_border_post(parent, LV_PART_MAIN) &&
+           lv_obj_get_style_border_width(parent, LV_PART_MAIN) > 0) return true;
+        if(parent->spec_attr && (parent->spec_attr->event_list.code_mask & SCROLL_BLIT_DRAW_POST_EVENT_MASK)) return true;
+
+        obj = parent;
+        parent = lv_obj_get_parent(parent);
+    }
+
+    /*The top and system layers are drawn over the screens*/
+    lv_display_t * disp = lv_obj_get_display(obj);
+    lv_obj_t * layers[2] = {disp->top_layer, disp->sys_layer};
+    for(i = 0; i < 2; i++) {
+        if(layers[i] == NULL) continue;
+        if(lv_obj_get_style_bg_opa(layers[i], LV_PART_MAIN) > LV_OPA_MIN) return true;
+
+        uint32_t child_cnt = lv_obj_get_child_count(layers[i]);
+        uint32_t j;
+        for(j = 0; j < child_cnt; j++) {
+            if(scroll_blit_obj_is_on(layers[i]->spec_attr->children[j], area)) return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Check if an object is drawn on an area
+ * @param obj   pointer to an object
+ * @param area  an area on the screen
+ * @return      true: the object or its children can be drawn on the area
+ */
+static bool scroll_blit_obj_is_on(lv_obj_t * obj, const lv_area_t * area)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return false;
+
+    lv_area_t coords = obj->coords;
+    int32_t ext_size = lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&coords, ext_size, ext_size);
+    lv_obj_get_transformed_area(obj, &coords, LV_OBJ_POINT_TRANSFORM_FLAG_RECURSIVE);
+
+    /*Children drawn out of the object*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        uint32_t child_cnt = lv_obj_get_child_count(obj);
+        uint32_t i;
+        for(i = 0; i < child_cnt; i++) {
+            if(scroll_blit_obj_is_on(obj->spec_attr->children[i], area)) return true;
+        }
+    }
+
+    return lv_area_is_on(&coords, area);
+}
+
+/**
+ * Invalidate the parts of an object which are not moved by scrolling: the border and the scrollbar tracks.
+ * @param disp  pointer to the display of the object
+ * @param obj   pointer to the scrolled object
+ * @param area  the visible area of the object
+ */
+static void scroll_blit_inv_static(lv_display_t * disp, lv_obj_t * obj, const lv_area_t * area)
+{
+    lv_area_t a;
+    int32_t border_w = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    if(border_w > 0 && lv_obj_get_style_border_opa(obj, LV_PART_MAIN) > LV_OPA_MIN) {
+        a = obj->coords;
+        a.y2 = a.y1 + border_w - 1;
+        if(lv_area_intersect(&a, &a, area)) lv_inv_area(disp, &a);
+        a = obj->coords;
+        a.y1 = a.y2 - border_w + 1;
+        if(lv_area_intersect(&a, &a, area)) lv_inv_area(disp, &a);
+        a = obj->coords;
+        a.x2 = a.x1 + border_w - 1;
+        if(lv_area_intersect(&a, &a, area)) lv_inv_area(disp, &a);
+        a = obj->coords;
+        a.x1 = a.x2 - border_w + 1;
+        if(lv_area_intersect(&a, &a, area)) lv_inv_area(disp, &a);
+    }
+
+    if(lv_obj_get_scrollbar_mode(obj) == LV_SCROLLBAR_MODE_OFF) return;
+
+    /*The scrollbars might appear or disappear, so redraw their whole tracks*/
+    int32_t thickness = lv_obj_get_style_width(obj, LV_PART_SCROLLBAR);
+    if(thickness <= 0) return;
+
+    a = obj->coords;
+    if(lv_obj_get_style_base_dir(obj, LV_PART_SCROLLBAR) == LV_BASE_DIR_RTL) {
+        a.x1 += lv_obj_get_style_pad_left(obj, LV_PART_SCROLLBAR);
+        a.x2 = a.x1 + thickness - 1;
+    }
+    else {
+        a.x2 -= lv_obj_get_style_pad_right(obj, LV_PART_SCROLLBAR);
+        a.x1 = a.x2 - thickness + 1;
+    }
+    if(lv_area_intersect(&a, &a, area)) lv_inv_area(disp, &a);
+
+    a = obj->coords;
+    a.y2 -= lv_obj_get_style_pad_bottom(obj, LV_PART_SCROLLBAR);
+    a.y1 = a.y2 - thickness + 1;
+    if(lv_area_intersect(&a, &a, area)) lv_inv_area(disp, &a);
+}
+#endif /*LV_USE_SCROLL_BLIT*/
+
 /**
  * Refresh the joined areas
  */
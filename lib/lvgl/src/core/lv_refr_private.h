@@ -64,6 +64,20 @@ void lv_refr_set_disp_refreshing(lv_display_t * disp);
  */
 void lv_display_refr_timer(lv_timer_t * timer);
 
+#if LV_USE_SCROLL_BLIT
+/**
+ * Move the already rendered content of a scrolled object in the draw buffer on the next refresh
+ * and invalidate only the newly visible strips instead of the whole object.
+ * Works only with `LV_DISPLAY_RENDER_MODE_DIRECT` and simple scrollable objects with a plain background
+ * which are not covered by other objects.
+ * @param obj   pointer to an object whose children were just moved by `dx` and `dy`
+ * @param dx    the horizontal movement of the children
+ * @param dy    the vertical movement of the children
+ * @return      true: the object will be moved; false: the object needs to be invalidated as usual
+ */
+bool lv_refr_scroll_blit(lv_obj_t * obj, int32_t dx, int32_t dy);
+#endif
+
 /**********************
  *      MACROS
  **********************/
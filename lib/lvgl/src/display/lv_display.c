@@ -89,6 +89,8 @@ lv_display_t * lv_display_create(int32_t hor_res, int32_t ver_res)
     disp->layer_head->color_format = disp->color_format;
 
     disp->inv_en_cnt = 1;
+    disp->refr_flush_cost = 0;
+    disp->refr_px_cost = 1;
     disp->last_activity_time = lv_tick_get();
 
     lv_ll_init(&disp->sync_areas, sizeof(lv_area_t));
@@ -504,6 +506,15 @@ bool lv_display_get_antialiasing(lv_display_t * disp)
     return disp->antialiasing;
 }
 
+void lv_display_set_refr_cost(lv_display_t * disp, uint32_t flush_cost, uint32_t px_cost)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->refr_flush_cost = flush_cost;
+    disp->refr_px_cost = px_cost;
+}
+
 LV_ATTRIBUTE_FLUSH_READY void lv_display_flush_ready(lv_display_t * disp)
 {
     disp->flushing = 0;
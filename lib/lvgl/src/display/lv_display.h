@@ -27,6 +27,12 @@ extern "C" {
 #define LV_ATTRIBUTE_FLUSH_READY
 #endif
 
+/** Estimated refresh costs of an SPI panel in ns (see `lv_display_set_refr_cost()`):
+ * about 40 us to set up an area (rendering, CASET/RASET/RAMWR, CS and DMA setup)
+ * and 0.5 us per RGB565 pixel at 40 MHz SPI clock including the rendering*/
+#define LV_DISPLAY_REFR_FLUSH_COST_SPI  40000
+#define LV_DISPLAY_REFR_PX_COST_SPI     500
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -307,6 +313,18 @@ void lv_display_set_antialiasing(lv_display_t * disp, bool en);
  */
 bool lv_display_get_antialiasing(lv_display_t * disp);
 
+/**
+ * Set the cost model used to join the invalidated areas before refreshing them.
+ * Two areas are joined if refreshing the joined area costs less than refreshing them separately,
+ * where an area costs `flush_cost` for each flush (one per draw buffer sized part in partial mode)
+ * plus `px_cost` for each pixel. With a flush cost, areas apart from each other can be joined too.
+ * The default (0, 1) joins only overlapping or touching areas if the joined area is smaller.
+ * @param disp          pointer to a display (NULL to use the default display)
+ * @param flush_cost    fixed cost of each flush, in any unit, e.g. `LV_DISPLAY_REFR_FLUSH_COST_SPI`
+ * @param px_cost       cost of each pixel, in the same unit, e.g. `LV_DISPLAY_REFR_PX_COST_SPI`
+ */
+void lv_display_set_refr_cost(lv_display_t * disp, uint32_t flush_cost, uint32_t px_cost);
+
 //! @cond Doxygen_Suppress
 
 /**
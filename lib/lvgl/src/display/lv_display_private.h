@@ -103,9 +103,20 @@ struct lv_display_t {
     uint32_t inv_p;
     int32_t inv_en_cnt;
 
+    /** Cost model of joining the invalidated areas, see `lv_display_set_refr_cost()`*/
+    uint32_t refr_flush_cost;
+    uint32_t refr_px_cost;
+
     /** Double buffer sync areas (redrawn during last refresh) */
     lv_ll_t sync_areas;
 
+#if LV_USE_SCROLL_BLIT
+    /** The object whose rendered content will be moved in the draw buffer on the next refresh, see `lv_refr_scroll_blit()`*/
+    lv_obj_t * scroll_blit_obj;
+    lv_area_t scroll_blit_area;     /**< The visible area of the object on the screen*/
+    lv_point_t scroll_blit_ofs;     /**< Sum of the scroll steps since the last refresh*/
+#endif
+
     lv_draw_buf_t _static_buf1; /**< Used when user pass in a raw buffer as display draw buffer */
     lv_draw_buf_t _static_buf2;
     /*---------------------
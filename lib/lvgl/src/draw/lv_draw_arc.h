@@ -38,6 +38,7 @@ typedef struct {
     const void * img_src;
     lv_opa_t opa;
     uint8_t rounded : 1;
+    uint8_t analytic : 1;   /**< Use the analytic rasterizer in the software renderer, see `LV_DRAW_SW_ARC_ANALYTIC`*/
 } lv_draw_arc_dsc_t;
 
 /**********************
@@ -16,6 +16,7 @@
 #include "../core/lv_obj_event.h"
 #include "../misc/lv_bidi_private.h"
 #include "../misc/lv_text_private.h"
+#include "../misc/cache/lv_text_layout_cache_private.h"
 #include "../misc/lv_assert.h"
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_string.h"
@@ -36,6 +37,8 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, const lv_text_layout_t * layout, uint32_t line_idx,
+                              uint32_t line_start, uint32_t line_end);
 static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
                         const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb);
 
@@ -153,9 +156,11 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
     const lv_font_t * font = dsc->font;
     int32_t w;
 
-    lv_area_t clipped_area;
-    bool clip_ok = lv_area_intersect(&clipped_area, coords, draw_unit->clip_area);
-    if(!clip_ok) return;
+    /*Glyphs can be drawn a little out of the text area, as much as a label's extra draw size*/
+    lv_area_t ext_area = *coords;
+    int32_t ext = lv_font_get_line_height(font) / 4;
+    lv_area_increase(&ext_area, ext, ext);
+    if(!lv_area_is_on(&ext_area, draw_unit->clip_area)) return;
 
     lv_text_align_t align = dsc->align;
     lv_base_dir_t base_dir = dsc->bidi_dir;
@@ -189,53 +194,73 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
     pos.y += y_ofs;
 
     uint32_t line_start     = 0;
+    uint32_t line_end;
+    uint32_t line_idx       = 0;
     int32_t last_line_start = -1;
 
-    /*Check the hint to use the cached info*/
-    if(dsc->hint && y_ofs == 0 && coords->y1 < 0) {
-        /*If the label changed too much recalculate the hint.*/
-        if(LV_ABS(dsc->hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
-            dsc->hint->line_start = -1;
+    /*With a cached layout the lines are known and the first visible line can be found directly*/
+    const lv_text_layout_t * layout = lv_text_layout_cache_acquire(dsc->text, font, dsc->letter_space, w, dsc->flag);
+    if(layout) {
+        if(pos.y + line_height_font < draw_unit->clip_area->y1 && line_height > 0) {
+            line_idx = (draw_unit->clip_area->y1 - pos.y - line_height_font + line_height - 1) / line_height;
+        }
+
+        if(line_idx >= layout->line_cnt) {
+            lv_text_layout_cache_release(layout);
+            return;
         }
-        last_line_start = dsc->hint->line_start;
-    }
 
-    /*Use the hint if it's valid*/
-    if(dsc->hint && last_line_start >= 0) {
-        line_start = last_line_start;
-        pos.y += dsc->hint->y;
+        pos.y += line_idx * line_height;
+        line_start = line_idx ? layout->lines[line_idx - 1].end : 0;
+        line_end = layout->lines[line_idx].end;
     }
+    else {
+        /*Check the hint to use the cached info*/
+        if(dsc->hint && y_ofs == 0 && coords->y1 < 0) {
+            /*If the label changed too much recalculate the hint.*/
+            if(LV_ABS(dsc->hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
+                dsc->hint->line_start = -1;
+            }
+            last_line_start = dsc->hint->line_start;
+        }
 
-    uint32_t line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL,
-                                                           dsc->flag);
+        /*Use the hint if it's valid*/
+        if(dsc->hint && last_line_start >= 0) {
+            line_start = last_line_start;
+            pos.y += dsc->hint->y;
+        }
 
-    /*Go the first visible line*/
-    while(pos.y + line_height_font < draw_unit->clip_area->y1) {
-        /*Go to next line*/
-        line_start = line_end;
-        line_end += lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
-        pos.y += line_height;
+        line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL,
+                                                      dsc->flag);
+
+        /*Go the first visible line*/
+        while(pos.y + line_height_font < draw_unit->clip_area->y1) {
+            /*Go to next line*/
+            line_start = line_end;
+            line_end += lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+            pos.y += line_height;
+
+            /*Save at the threshold coordinate*/
+            if(dsc->hint && pos.y >= -LV_LABEL_HINT_UPDATE_TH && dsc->hint->line_start < 0) {
+                dsc->hint->line_start = line_start;
+                dsc->hint->y          = pos.y - coords->y1;
+                dsc->hint->coord_y    = coords->y1;
+            }
 
-        /*Save at the threshold coordinate*/
-        if(dsc->hint && pos.y >= -LV_LABEL_HINT_UPDATE_TH && dsc->hint->line_start < 0) {
-            dsc->hint->line_start = line_start;
-            dsc->hint->y          = pos.y - coords->y1;
-            dsc->hint->coord_y    = coords->y1;
+            if(dsc->text[line_start] == '\0') return;
         }
-
-        if(dsc->text[line_start] == '\0') return;
     }
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+        line_width = get_line_width(dsc, layout, line_idx, line_start, line_end);
 
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+        line_width = get_line_width(dsc, layout, line_idx, line_start, line_end);
         pos.x += lv_area_get_width(coords) - line_width;
     }
 
@@ -346,20 +371,24 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
 #endif
         /*Go to next line*/
         line_start = line_end;
-        line_end += lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        if(layout) {
+            line_idx++;
+            if(line_idx < layout->line_cnt) line_end = layout->lines[line_idx].end;
+        }
+        else {
+            line_end += lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        }
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+            line_width = get_line_width(dsc, layout, line_idx, line_start, line_end);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+            line_width = get_line_width(dsc, layout, line_idx, line_start, line_end);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -370,6 +399,7 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
     }
 
     if(draw_letter_dsc._draw_buf) lv_draw_buf_destroy(draw_letter_dsc._draw_buf);
+    if(layout) lv_text_layout_cache_release(layout);
 
     LV_ASSERT_MEM_INTEGRITY();
 }
@@ -378,6 +408,23 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get the width of a line from the layout or by measuring it
+ * @param dsc           the label draw descriptor
+ * @param layout        the cached layout of the text or NULL
+ * @param line_idx      index of the line in the layout
+ * @param line_start    byte index of the first character of the line
+ * @param line_end      byte index after the last character of the line
+ * @return              width of the line in pixels
+ */
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, const lv_text_layout_t * layout, uint32_t line_idx,
+                              uint32_t line_start, uint32_t line_end)
+{
+    if(layout) return line_idx < layout->line_cnt ? layout->lines[line_idx].width : 0;
+
+    return lv_text_get_width(&dsc->text[line_start], line_end - line_start, dsc->font, dsc->letter_space);
+}
+
 static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
                         const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb)
 {
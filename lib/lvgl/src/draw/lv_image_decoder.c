@@ -12,6 +12,8 @@
 #include "../misc/lv_ll.h"
 #include "../stdlib/lv_string.h"
 #include "../core/lv_global.h"
+#include "../tick/lv_tick.h"
+#include "../misc/lv_timer.h"
 
 /*********************
  *      DEFINES
@@ -41,6 +43,10 @@ static lv_image_decoder_t * image_decoder_get_info(lv_image_decoder_dsc_t * dsc,
 
 static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc);
 
+#if LV_CACHE_STATS_DUMP_PERIOD
+    static void cache_stats_dump_timer_cb(lv_timer_t * timer);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -63,6 +69,10 @@ void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_coun
     /*Initialize the cache*/
     lv_image_cache_init(image_cache_size);
     lv_image_header_cache_init(image_header_count);
+
+#if LV_CACHE_STATS_DUMP_PERIOD
+    lv_timer_create(cache_stats_dump_timer_cb, LV_CACHE_STATS_DUMP_PERIOD, NULL);
+#endif
 }
 
 /**
@@ -126,8 +136,15 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
      * If decoder open failed, free the source and return error.
      * If decoder open succeed, add the image to cache if enabled.
      * */
+    uint32_t t_start = lv_tick_get_us();
     lv_result_t res = dsc->decoder->open_cb(dsc->decoder, dsc);
 
+    /*Let the cache know how expensive it would be to decode the image again.
+     *Most images decode in less than a millisecond, so it's measured in microseconds.*/
+    if(res == LV_RESULT_OK && dsc->cache_entry) {
+        lv_cache_set_entry_cost(img_cache_p, dsc->cache_entry, lv_tick_get_us() - t_start);
+    }
+
     /* Flush the D-Cache if enabled and the image was successfully opened */
     if(dsc->args.flush_cache && res == LV_RESULT_OK && dsc->decoded != NULL) {
         lv_draw_buf_flush_cache(dsc->decoded, NULL);
@@ -413,3 +430,13 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
 
     return LV_RESULT_INVALID;
 }
+
+#if LV_CACHE_STATS_DUMP_PERIOD
+static void cache_stats_dump_timer_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+
+    lv_cache_dump_stats(img_cache_p);
+    lv_cache_dump_stats(img_header_cache_p);
+}
+#endif
@@ -221,6 +221,43 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
     LV_PROFILER_END;
 }
 
+#if LV_DRAW_SW_COMPLEX
+void lv_draw_sw_blend_spans(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t * blend_dsc,
+                            const lv_draw_sw_mask_span_t spans[], uint32_t span_cnt)
+{
+    if(spans == NULL) {
+        lv_draw_sw_blend(draw_unit, blend_dsc);
+        return;
+    }
+
+    /*Keep the mask and source areas as the spans address only a part of them.
+     *They can be the same as `blend_area` which is changed below.*/
+    lv_area_t line_area = *blend_dsc->blend_area;
+    lv_area_t mask_area = blend_dsc->mask_area ? *blend_dsc->mask_area : line_area;
+    lv_area_t src_area;
+    lv_area_t span_area = line_area;
+
+    lv_draw_sw_blend_dsc_t span_dsc = *blend_dsc;
+    span_dsc.blend_area = &span_area;
+    span_dsc.mask_area = &mask_area;
+    if(blend_dsc->src_area) {
+        src_area = *blend_dsc->src_area;
+        span_dsc.src_area = &src_area;
+    }
+
+    uint32_t i;
+    for(i = 0; i < span_cnt; i++) {
+        if(spans[i].type == LV_DRAW_SW_MASK_SPAN_TRANSP) continue;
+
+        span_area.x1 = line_area.x1 + spans[i].x;
+        span_area.x2 = span_area.x1 + spans[i].len - 1;
+        span_dsc.mask_res = spans[i].type == LV_DRAW_SW_MASK_SPAN_COVER ? LV_DRAW_SW_MASK_RES_FULL_COVER :
+                            LV_DRAW_SW_MASK_RES_CHANGED;
+        lv_draw_sw_blend(draw_unit, &span_dsc);
+    }
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -39,6 +39,20 @@ extern "C" {
  */
 void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t * dsc);
 
+#if LV_DRAW_SW_COMPLEX
+/**
+ * Blend a masked line span by span: transparent spans are skipped, covered spans are filled
+ * without the mask and only the partial spans use the mask buffer.
+ * @param draw_unit     pointer to a draw unit
+ * @param dsc           pointer to an initialized blend descriptor of a single line
+ * @param spans         the spans of the line returned by `lv_draw_sw_mask_apply_spans()`.
+ *                      If `NULL` the whole line is blended with the mask buffer.
+ * @param span_cnt      number of spans
+ */
+void lv_draw_sw_blend_spans(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t * dsc,
+                            const lv_draw_sw_mask_span_t spans[], uint32_t span_cnt);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -38,6 +38,10 @@
  *********************/
 #define DRAW_UNIT_ID_SW     1
 
+/*The 90 and 270 degree rotations copy the pixels in tiles of this size
+ *to read and write only a few cache lines at a time instead of a whole column*/
+#define ROTATE_TILE_SIZE    32
+
 #ifndef LV_DRAW_SW_RGB565_SWAP
     #define LV_DRAW_SW_RGB565_SWAP(...) LV_RESULT_INVALID
 #endif
@@ -600,12 +604,18 @@ static void rotate270_argb8888(const uint32_t * src, uint32_t * dst, int32_t src
     src_stride /= sizeof(uint32_t);
     dst_stride /= sizeof(uint32_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t ty_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t tx_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < tx_end; ++x) {
+                uint32_t * dst_row = dst + x * dst_stride + src_height - 1;
+                const uint32_t * src_col = src + ty * src_stride + x;
+                for(int32_t y = ty; y < ty_end; ++y) {
+                    dst_row[-y] = *src_col;
+                    src_col += src_stride;
+                }
+            }
         }
     }
 }
@@ -639,12 +649,18 @@ static void rotate90_argb8888(const uint32_t * src, uint32_t * dst, int32_t src_
     src_stride /= sizeof(uint32_t);
     dst_stride /= sizeof(uint32_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t ty_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t tx_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < tx_end; ++x) {
+                uint32_t * dst_row = dst + (src_width - x - 1) * dst_stride;
+                const uint32_t * src_col = src + ty * src_stride + x;
+                for(int32_t y = ty; y < ty_end; ++y) {
+                    dst_row[y] = *src_col;
+                    src_col += src_stride;
+                }
+            }
         }
     }
 }
@@ -661,13 +677,20 @@ static void rotate90_rgb888(const uint8_t * src, uint8_t * dst, int32_t src_widt
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        for(int32_t y = 0; y < src_height; ++y) {
-            int32_t srcIndex = y * src_stride + x * 3;
-            int32_t dstIndex = (src_width - x - 1) * dst_stride + y * 3;
-            dst[dstIndex] = src[srcIndex];       /*Red*/
-            dst[dstIndex + 1] = src[srcIndex + 1]; /*Green*/
-            dst[dstIndex + 2] = src[srcIndex + 2]; /*Blue*/
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t ty_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t tx_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < tx_end; ++x) {
+                uint8_t * dst_row = dst + (src_width - x - 1) * dst_stride;
+                const uint8_t * src_col = src + ty * src_stride + x * 3;
+                for(int32_t y = ty; y < ty_end; ++y) {
+                    dst_row[y * 3] = src_col[0];        /*Red*/
+                    dst_row[y * 3 + 1] = src_col[1];    /*Green*/
+                    dst_row[y * 3 + 2] = src_col[2];    /*Blue*/
+                    src_col += src_stride;
+                }
+            }
         }
     }
 }
@@ -697,13 +720,20 @@ static void rotate270_rgb888(const uint8_t * src, uint8_t * dst, int32_t width,
         return ;
     }
 
-    for(int32_t x = 0; x < width; ++x) {
-        for(int32_t y = 0; y < height; ++y) {
-            int32_t srcIndex = y * src_stride + x * 3;
-            int32_t dstIndex = x * dst_stride + (height - y - 1) * 3;
-            dst[dstIndex] = src[srcIndex];       /*Red*/
-            dst[dstIndex + 1] = src[srcIndex + 1]; /*Green*/
-            dst[dstIndex + 2] = src[srcIndex + 2]; /*Blue*/
+    for(int32_t ty = 0; ty < height; ty += ROTATE_TILE_SIZE) {
+        int32_t ty_end = LV_MIN(ty + ROTATE_TILE_SIZE, height);
+        for(int32_t tx = 0; tx < width; tx += ROTATE_TILE_SIZE) {
+            int32_t tx_end = LV_MIN(tx + ROTATE_TILE_SIZE, width);
+            for(int32_t x = tx; x < tx_end; ++x) {
+                uint8_t * dst_row = dst + x * dst_stride + (height - 1) * 3;
+                const uint8_t * src_col = src + ty * src_stride + x * 3;
+                for(int32_t y = ty; y < ty_end; ++y) {
+                    dst_row[-y * 3] = src_col[0];       /*Red*/
+                    dst_row[-y * 3 + 1] = src_col[1];   /*Green*/
+                    dst_row[-y * 3 + 2] = src_col[2];   /*Blue*/
+                    src_col += src_stride;
+                }
+            }
         }
     }
 }
@@ -723,12 +753,18 @@ static void rotate270_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_w
     src_stride /= sizeof(uint16_t);
     dst_stride /= sizeof(uint16_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t ty_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t tx_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < tx_end; ++x) {
+                uint16_t * dst_row = dst + x * dst_stride + src_height - 1;
+                const uint16_t * src_col = src + ty * src_stride + x;
+                for(int32_t y = ty; y < ty_end; ++y) {
+                    dst_row[-y] = *src_col;
+                    src_col += src_stride;
+                }
+            }
         }
     }
 }
@@ -763,12 +799,18 @@ static void rotate90_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_wi
     src_stride /= sizeof(uint16_t);
     dst_stride /= sizeof(uint16_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t ty_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t tx_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < tx_end; ++x) {
+                uint16_t * dst_row = dst + (src_width - x - 1) * dst_stride;
+                const uint16_t * src_col = src + ty * src_stride + x;
+                for(int32_t y = ty; y < ty_end; ++y) {
+                    dst_row[y] = *src_col;
+                    src_col += src_stride;
+                }
+            }
         }
     }
 }
@@ -786,12 +828,18 @@ static void rotate90_l8(const uint8_t * src, uint8_t * dst, int32_t src_width, i
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t ty_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t tx_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < tx_end; ++x) {
+                uint8_t * dst_row = dst + (src_width - x - 1) * dst_stride;
+                const uint8_t * src_col = src + ty * src_stride + x;
+                for(int32_t y = ty; y < ty_end; ++y) {
+                    dst_row[y] = *src_col;
+                    src_col += src_stride;
+                }
+            }
         }
     }
 }
@@ -820,12 +868,18 @@ static void rotate270_l8(const uint8_t * src, uint8_t * dst, int32_t src_width,
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t ty_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t tx_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < tx_end; ++x) {
+                uint8_t * dst_row = dst + x * dst_stride + src_height - 1;
+                const uint8_t * src_col = src + ty * src_stride + x;
+                for(int32_t y = ty; y < ty_end; ++y) {
+                    dst_row[-y] = *src_col;
+                    src_col += src_stride;
+                }
+            }
         }
     }
 }
@@ -29,14 +29,60 @@ static void get_rounded_area(int16_t angle, int32_t radius, uint8_t thickness, l
  *********************/
 #define SPLIT_RADIUS_LIMIT 10  /*With radius greater than this the arc will drawn in quarters. A quarter is drawn only if there is arc in it*/
 #define SPLIT_ANGLE_GAP_LIMIT 60  /*With small gaps in the arc don't bother with splitting because there is nothing to skip.*/
+#define ANALYTIC_RADIUS_MAX 4096  /*Larger arcs are drawn with masks to keep the squared distances in 32 bit*/
+#define SIDE_FULL   (127 << (LV_TRIGO_SHIFT - 7))   /*Pixels farther inside than this from a side are fully covered by it*/
+#define SIDE_NONE   (-(128 << (LV_TRIGO_SHIFT - 7)))  /*Pixels farther outside than this from a side are not covered by it*/
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Precalculated parameters of the analytic rasterizer.
+ * The distances are in 1/2 pixel units relative to the center of the arc (which is a pixel corner),
+ * so the center of every pixel has integer coordinates.
+ */
+typedef struct {
+    int32_t cx;
+    int32_t cy;
+    int32_t r_out;          /**< Outer radius*/
+    int32_t r_in;           /**< Inner radius, 0 if there is no hole*/
+    uint32_t out_full_sq;   /**< Pixels closer than this (squared) are fully inside the outer circle*/
+    uint32_t out_none_sq;   /**< Pixels farther than this (squared) are fully outside the outer circle*/
+    uint32_t in_full_sq;    /**< Pixels farther than this (squared) are fully outside the hole*/
+    uint32_t in_none_sq;    /**< Pixels closer than this (squared) are fully in the hole*/
+    int32_t start_sin;
+    int32_t start_cos;
+    int32_t end_sin;
+    int32_t end_cos;
+    bool wide;              /**< The arc is larger than 180°: the union of the two half planes instead of the intersection*/
+    bool no_sides;          /**< The arc goes around (start and end are the same), only the ring is drawn*/
+    bool rounded;
+    int32_t cap_r;          /**< Radius of the rounded ends*/
+    uint32_t cap_full_sq;
+    uint32_t cap_none_sq;
+    lv_point_t cap_center[2];
+    lv_area_t cap_area[2];  /**< Absolute pixel areas of the rounded ends*/
+} arc_analytic_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void arc_analytic_init(arc_analytic_t * a, const lv_draw_arc_dsc_t * dsc, int32_t width,
+                              int32_t start_angle, int32_t end_angle);
+static lv_draw_sw_mask_res_t arc_analytic_line(const arc_analytic_t * a, lv_opa_t * mask_buf,
+                                               int32_t abs_x, int32_t abs_y, int32_t len);
+static void arc_analytic_half(const arc_analytic_t * a, lv_opa_t * mask_buf, int32_t abs_x, int32_t dy,
+                              int32_t x_start, int32_t x_end, int32_t full_start, int32_t full_end);
+static void LV_ATTRIBUTE_FAST_MEM arc_analytic_edge(const arc_analytic_t * a, lv_opa_t * mask_buf, int32_t abs_x,
+                                                    int32_t dy, int32_t x_start, int32_t x_end);
+static void LV_ATTRIBUTE_FAST_MEM arc_analytic_sides(const arc_analytic_t * a, lv_opa_t * mask_buf,
+                                                     int32_t abs_x, int32_t dy, int32_t x_start, int32_t x_end);
+static inline int32_t side_run(int32_t side, int32_t step, bool full);
+static void arc_analytic_cap(const arc_analytic_t * a, uint32_t cap_i, lv_opa_t * mask_buf, int32_t abs_x,
+                             int32_t abs_y, int32_t len);
+static inline int32_t ring_cov(const arc_analytic_t * a, uint32_t d_sq);
+static inline int32_t circle_cov(int32_t diff_sq, int32_t r);
 
 /**********************
  *  STATIC VARIABLES
@@ -90,24 +136,32 @@ void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, c
     while(start_angle >= 360) start_angle -= 360;
     while(end_angle >= 360) end_angle -= 360;
 
+    bool analytic = (LV_DRAW_SW_ARC_ANALYTIC || dsc->analytic) && dsc->radius <= ANALYTIC_RADIUS_MAX;
+    arc_analytic_t analytic_dsc;
+
     void * mask_list[4] = {0};
-    /*Create an angle mask*/
     lv_draw_sw_mask_angle_param_t mask_angle_param;
-    lv_draw_sw_mask_angle_init(&mask_angle_param, dsc->center.x, dsc->center.y, start_angle, end_angle);
-    mask_list[0] = &mask_angle_param;
-
-    /*Create an outer mask*/
     lv_draw_sw_mask_radius_param_t mask_out_param;
-    lv_draw_sw_mask_radius_init(&mask_out_param, &area_out, LV_RADIUS_CIRCLE, false);
-    mask_list[1] = &mask_out_param;
-
-    /*Create inner the mask*/
     lv_draw_sw_mask_radius_param_t mask_in_param;
     bool mask_in_param_valid = false;
-    if(lv_area_get_width(&area_in) > 0 && lv_area_get_height(&area_in) > 0) {
-        lv_draw_sw_mask_radius_init(&mask_in_param, &area_in, LV_RADIUS_CIRCLE, true);
-        mask_list[2] = &mask_in_param;
-        mask_in_param_valid = true;
+    if(analytic) {
+        arc_analytic_init(&analytic_dsc, dsc, width, start_angle, end_angle);
+    }
+    else {
+        /*Create an angle mask*/
+        lv_draw_sw_mask_angle_init(&mask_angle_param, dsc->center.x, dsc->center.y, start_angle, end_angle);
+        mask_list[0] = &mask_angle_param;
+
+        /*Create an outer mask*/
+        lv_draw_sw_mask_radius_init(&mask_out_param, &area_out, LV_RADIUS_CIRCLE, false);
+        mask_list[1] = &mask_out_param;
+
+        /*Create inner the mask*/
+        if(lv_area_get_width(&area_in) > 0 && lv_area_get_height(&area_in) > 0) {
+            lv_draw_sw_mask_radius_init(&mask_in_param, &area_in, LV_RADIUS_CIRCLE, true);
+            mask_list[2] = &mask_in_param;
+            mask_in_param_valid = true;
+        }
     }
 
     int32_t blend_h = lv_area_get_height(&clipped_area);
@@ -155,7 +209,7 @@ void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, c
     lv_opa_t * circle_mask = NULL;
     lv_area_t round_area_1;
     lv_area_t round_area_2;
-    if(dsc->rounded) {
+    if(dsc->rounded && !analytic) {
         circle_mask = lv_malloc(width * width);
         lv_memset(circle_mask, 0xff, width * width);
         lv_area_t circle_area = {0, 0, width - 1, width - 1};
@@ -179,25 +233,51 @@ void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, c
 
     }
 
+    lv_draw_sw_mask_span_t spans[LV_DRAW_SW_MASK_SPAN_MAX];
+    uint32_t span_cnt;
+
     blend_area.y2 = blend_area.y1;
     for(h = 0; h < blend_h; h++) {
-        lv_memset(mask_buf, 0xff, blend_w);
-        blend_dsc.mask_res = lv_draw_sw_mask_apply(mask_list, mask_buf, blend_area.x1, blend_area.y1, blend_w);
-
-        if(dsc->rounded) {
-            if(blend_area.y1 >= round_area_1.y1 && blend_area.y1 <= round_area_1.y2) {
-                if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_TRANSP) {
-                    lv_memzero(mask_buf, blend_w);
-                    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
-                }
-                add_circle(circle_mask, &blend_area, &round_area_1, mask_buf, width);
+        if(analytic) {
+            blend_dsc.mask_res = arc_analytic_line(&analytic_dsc, mask_buf, blend_area.x1, blend_area.y1, blend_w);
+        }
+        else {
+            /*The rounded ends and the A8 part of the image are mixed into the mask later so the spans can't be used.
+             *When opaque the blenders already handle the transparent and covered pixels quickly.*/
+            bool use_spans = img_mask == NULL && dsc->opa < LV_OPA_MAX;
+            if(dsc->rounded) {
+                if(blend_area.y1 >= round_area_1.y1 && blend_area.y1 <= round_area_1.y2) use_spans = false;
+                if(blend_area.y1 >= round_area_2.y1 && blend_area.y1 <= round_area_2.y2) use_spans = false;
+            }
+
+            if(use_spans) {
+                blend_dsc.mask_res = lv_draw_sw_mask_apply_spans(mask_list, mask_buf, blend_area.x1, blend_area.y1, blend_w,
+                                                                 spans, &span_cnt);
+                lv_draw_sw_blend_spans(draw_unit, &blend_dsc, spans, span_cnt);
+
+                blend_area.y1 ++;
+                blend_area.y2 ++;
+                continue;
             }
-            if(blend_area.y1 >= round_area_2.y1 && blend_area.y1 <= round_area_2.y2) {
-                if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_TRANSP) {
-                    lv_memzero(mask_buf, blend_w);
-                    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+
+            lv_memset(mask_buf, 0xff, blend_w);
+            blend_dsc.mask_res = lv_draw_sw_mask_apply(mask_list, mask_buf, blend_area.x1, blend_area.y1, blend_w);
+
+            if(dsc->rounded) {
+                if(blend_area.y1 >= round_area_1.y1 && blend_area.y1 <= round_area_1.y2) {
+                    if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_TRANSP) {
+                        lv_memzero(mask_buf, blend_w);
+                        blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+                    }
+                    add_circle(circle_mask, &blend_area, &round_area_1, mask_buf, width);
+                }
+                if(blend_area.y1 >= round_area_2.y1 && blend_area.y1 <= round_area_2.y2) {
+                    if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_TRANSP) {
+                        lv_memzero(mask_buf, blend_w);
+                        blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+                    }
+                    add_circle(circle_mask, &blend_area, &round_area_2, mask_buf, width);
                 }
-                add_circle(circle_mask, &blend_area, &round_area_2, mask_buf, width);
             }
         }
 
@@ -222,8 +302,10 @@ void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, c
         blend_area.y2 ++;
     }
 
-    lv_draw_sw_mask_free_param(&mask_angle_param);
-    lv_draw_sw_mask_free_param(&mask_out_param);
+    if(!analytic) {
+        lv_draw_sw_mask_free_param(&mask_angle_param);
+        lv_draw_sw_mask_free_param(&mask_out_param);
+    }
     if(mask_in_param_valid) {
         lv_draw_sw_mask_free_param(&mask_in_param);
     }
@@ -301,6 +383,291 @@ static void get_rounded_area(int16_t angle, int32_t radius, uint8_t thickness, l
     }
 }
 
+static void arc_analytic_init(arc_analytic_t * a, const lv_draw_arc_dsc_t * dsc, int32_t width,
+                              int32_t start_angle, int32_t end_angle)
+{
+    a->cx = dsc->center.x;
+    a->cy = dsc->center.y;
+    a->r_out = dsc->radius * 2;
+    a->r_in = dsc->width < dsc->radius ? (dsc->radius - dsc->width) * 2 : 0;
+
+    /*The pixels are fully covered/uncovered if their center is farther than 1/2 px from the edge*/
+    a->out_full_sq = (a->r_out - 1) * (a->r_out - 1);
+    a->out_none_sq = (a->r_out + 1) * (a->r_out + 1);
+    a->in_full_sq = (a->r_in + 1) * (a->r_in + 1);
+    a->in_none_sq = a->r_in > 0 ? (a->r_in - 1) * (a->r_in - 1) : 0;
+
+    a->start_sin = lv_trigo_sin(start_angle);
+    a->start_cos = lv_trigo_cos(start_angle);
+    a->end_sin = lv_trigo_sin(end_angle);
+    a->end_cos = lv_trigo_cos(end_angle);
+    int32_t sweep = end_angle - start_angle;
+    if(sweep <= 0) sweep += 360;
+    a->wide = sweep > 180;
+    /*E.g. 0..360 or 90..450 with an image: the two sides would be the same line and leave a seam*/
+    a->no_sides = start_angle == end_angle;
+
+    a->rounded = dsc->rounded;
+    if(a->rounded) {
+        /*The ends are circles with `width` diameter on the middle of the ring*/
+        a->cap_r = width;
+        a->cap_full_sq = (a->cap_r - 1) * (a->cap_r - 1);
+        a->cap_none_sq = (a->cap_r + 1) * (a->cap_r + 1);
+        int32_t r_mid = dsc->radius * 2 - width;
+        int32_t half = 1 << (LV_TRIGO_SHIFT - 1);
+        a->cap_center[0].x = (r_mid * a->start_cos + half) >> LV_TRIGO_SHIFT;
+        a->cap_center[0].y = (r_mid * a->start_sin + half) >> LV_TRIGO_SHIFT;
+        a->cap_center[1].x = (r_mid * a->end_cos + half) >> LV_TRIGO_SHIFT;
+        a->cap_center[1].y = (r_mid * a->end_sin + half) >> LV_TRIGO_SHIFT;
+
+        uint32_t i;
+        for(i = 0; i < 2; i++) {
+            a->cap_area[i].x1 = a->cx + ((a->cap_center[i].x - a->cap_r) >> 1) - 1;
+            a->cap_area[i].y1 = a->cy + ((a->cap_center[i].y - a->cap_r) >> 1) - 1;
+            a->cap_area[i].x2 = a->cx + ((a->cap_center[i].x + a->cap_r) >> 1) + 1;
+            a->cap_area[i].y2 = a->cy + ((a->cap_center[i].y + a->cap_r) >> 1) + 1;
+        }
+    }
+}
+
+/**
+ * Calculate the coverage of a line of the arc in one pass.
+ * The hole and the outside are only cleared, and inside the ring only the sides are checked.
+ */
+static lv_draw_sw_mask_res_t arc_analytic_line(const arc_analytic_t * a, lv_opa_t * mask_buf,
+                                               int32_t abs_x, int32_t abs_y, int32_t len)
+{
+    lv_memzero(mask_buf, len);
+
+    int32_t dy = 2 * (abs_y - a->cy) + 1;
+    uint32_t dy_sq = dy * dy;
+    bool visible = false;
+
+    if(dy_sq < a->out_none_sq) {
+        /*The square roots are rounded so add 1 px margin around the edges.
+         *The extra pixels are calculated one by one.*/
+        int32_t out_half = lv_sqrt32(a->out_none_sq - dy_sq) / 2 + 1;
+        int32_t x_start = LV_MAX(a->cx - out_half - abs_x, 0);
+        int32_t x_end = LV_MIN(a->cx + out_half + 1 - abs_x, len);
+
+        int32_t hole_half = dy_sq < a->in_none_sq ? lv_sqrt32(a->in_none_sq - dy_sq) / 2 - 1 : 0;
+        if(hole_half < 0) hole_half = 0;
+
+        /*Where the ring covers the pixels fully*/
+        int32_t full_out = dy_sq < a->out_full_sq ? lv_sqrt32(a->out_full_sq - dy_sq) / 2 - 1 : 0;
+        int32_t full_in = dy_sq < a->in_full_sq ? lv_sqrt32(a->in_full_sq - dy_sq) / 2 + 1 : 1;
+
+        int32_t center = a->cx - abs_x;
+        if(x_start < x_end) {
+            arc_analytic_half(a, mask_buf, abs_x, dy, x_start, LV_MIN(center - hole_half, x_end),
+                              center - full_out, center - full_in);
+            arc_analytic_half(a, mask_buf, abs_x, dy, LV_MAX(center + hole_half, x_start), x_end,
+                              center + full_in, center + full_out);
+            visible = true;
+        }
+    }
+
+    if(a->rounded) {
+        uint32_t i;
+        for(i = 0; i < 2; i++) {
+            if(abs_y < a->cap_area[i].y1 || abs_y > a->cap_area[i].y2) continue;
+            arc_analytic_cap(a, i, mask_buf, abs_x, abs_y, len);
+            visible = true;
+        }
+    }
+
+    return visible ? LV_DRAW_SW_MASK_RES_CHANGED : LV_DRAW_SW_MASK_RES_TRANSP;
+}
+
+/**
+ * Calculate the left or right half of the ring on a line.
+ * In `[full_start, full_end)` the ring covers the pixels fully so only the sides need to be checked.
+ */
+static void arc_analytic_half(const arc_analytic_t * a, lv_opa_t * mask_buf, int32_t abs_x, int32_t dy,
+                              int32_t x_start, int32_t x_end, int32_t full_start, int32_t full_end)
+{
+    if(x_start >= x_end) return;
+
+    full_start = LV_CLAMP(x_start, full_start, x_end);
+    full_end = LV_CLAMP(full_start, full_end, x_end);
+
+    arc_analytic_edge(a, mask_buf, abs_x, dy, x_start, full_start);
+    arc_analytic_sides(a, mask_buf, abs_x, dy, full_start, full_end);
+    arc_analytic_edge(a, mask_buf, abs_x, dy, full_end, x_end);
+}
+
+/**
+ * Calculate the coverage of the ring sector pixel by pixel on `[x_start, x_end)` of a line.
+ * Used on the anti-aliased edges of the ring.
+ */
+static void LV_ATTRIBUTE_FAST_MEM arc_analytic_edge(const arc_analytic_t * a, lv_opa_t * mask_buf, int32_t abs_x,
+                                                    int32_t dy, int32_t x_start, int32_t x_end)
+{
+    if(x_start >= x_end) return;
+
+    int32_t dx = 2 * (abs_x + x_start - a->cx) + 1;
+    uint32_t d_sq = dx * dx + dy * dy;
+    /*Signed distance from the start and end sides (positive inside) in 1/2 px << LV_TRIGO_SHIFT*/
+    int32_t side_start = a->start_cos * dy - a->start_sin * dx;
+    int32_t side_end = a->end_sin * dx - a->end_cos * dy;
+
+    int32_t x;
+    for(x = x_start; x < x_end; x++) {
+        int32_t cov = ring_cov(a, d_sq);
+        if(cov && !a->no_sides) {
+            /*1/2 px in the side distance is 128 opacity*/
+            int32_t cov_start = LV_CLAMP(0, 128 + (side_start >> (LV_TRIGO_SHIFT - 7)), 255);
+            int32_t cov_end = LV_CLAMP(0, 128 + (side_end >> (LV_TRIGO_SHIFT - 7)), 255);
+            int32_t cov_side = a->wide ? LV_MAX(cov_start, cov_end) : LV_MIN(cov_start, cov_end);
+            if(cov_side < cov) cov = cov_side;
+        }
+        mask_buf[x] = (lv_opa_t)cov;
+
+        d_sq += 4 * dx + 4;
+        dx += 2;
+        side_start -= 2 * a->start_sin;
+        side_end += 2 * a->end_sin;
+    }
+}
+
+/**
+ * Calculate the coverage of the sides of the sector on `[x_start, x_end)` of a line
+ * where the ring covers the pixels fully.
+ * The fully covered and transparent runs are found from the slope of the sides and filled at once.
+ */
+static void LV_ATTRIBUTE_FAST_MEM arc_analytic_sides(const arc_analytic_t * a, lv_opa_t * mask_buf,
+                                                     int32_t abs_x, int32_t dy, int32_t x_start, int32_t x_end)
+{
+    if(a->no_sides) {
+        if(x_start < x_end) lv_memset(&mask_buf[x_start], 0xff, x_end - x_start);
+        return;
+    }
+
+    int32_t dx = 2 * (abs_x + x_start - a->cx) + 1;
+    int32_t side_start = a->start_cos * dy - a->start_sin * dx;
+    int32_t side_end = a->end_sin * dx - a->end_cos * dy;
+    int32_t step_start = -2 * a->start_sin;
+    int32_t step_end = 2 * a->end_sin;
+
+    int32_t x = x_start;
+    while(x < x_end) {
+        int32_t cov_start = LV_CLAMP(0, 128 + (side_start >> (LV_TRIGO_SHIFT - 7)), 255);
+        int32_t cov_end = LV_CLAMP(0, 128 + (side_end >> (LV_TRIGO_SHIFT - 7)), 255);
+        int32_t cov = a->wide ? LV_MAX(cov_start, cov_end) : LV_MIN(cov_start, cov_end);
+
+        int32_t run = 0;
+        if(cov == 255 || cov == 0) {
+            bool full = cov == 255;
+            int32_t run_start = side_run(side_start, step_start, full);
+            int32_t run_end = side_run(side_end, step_end, full);
+            /*Intersection: covered while both sides cover, transparent while any side is out.
+             *Union: the other way around.*/
+            if(a->wide == full) run = LV_MAX(run_start, run_end);
+            else run = LV_MIN(run_start, run_end);
+        }
+
+        if(run > 1) {
+            if(run > x_end - x) run = x_end - x;
+            if(cov) lv_memset(&mask_buf[x], 0xff, run);
+        }
+        else {
+            run = 1;
+            mask_buf[x] = (lv_opa_t)cov;
+        }
+
+        x += run;
+        side_start += step_start * run;
+        side_end += step_end * run;
+    }
+}
+
+/**
+ * Get for how many pixels a side stays fully covering or fully outside
+ * @param side      the signed distance of the current pixel from the side
+ * @param step      change of `side` per pixel
+ * @param full      true: count the covered pixels, false: count the transparent pixels
+ * @return          the number of pixels, 0 if the current pixel isn't in the required state
+ */
+static inline int32_t side_run(int32_t side, int32_t step, bool full)
+{
+    if(full) {
+        if(side < SIDE_FULL) return 0;
+        if(step >= 0) return INT32_MAX;
+        return (side - SIDE_FULL) / -step + 1;
+    }
+    else {
+        if(side > SIDE_NONE) return 0;
+        if(step <= 0) return INT32_MAX;
+        return (SIDE_NONE - side) / step + 1;
+    }
+}
+
+/**
+ * Add the coverage of a rounded end to a line.
+ * It's clipped to the ring to not to bulge out where the end touches the edges.
+ */
+static void arc_analytic_cap(const arc_analytic_t * a, uint32_t cap_i, lv_opa_t * mask_buf, int32_t abs_x,
+                             int32_t abs_y, int32_t len)
+{
+    const lv_area_t * area = &a->cap_area[cap_i];
+    int32_t x_start = LV_MAX(area->x1 - abs_x, 0);
+    int32_t x_end = LV_MIN(area->x2 + 1 - abs_x, len);
+
+    int32_t ring_dx = 2 * (abs_x + x_start - a->cx) + 1;
+    int32_t ring_dy = 2 * (abs_y - a->cy) + 1;
+    uint32_t ring_d_sq = ring_dx * ring_dx + ring_dy * ring_dy;
+    int32_t dx = ring_dx - a->cap_center[cap_i].x;
+    int32_t dy = ring_dy - a->cap_center[cap_i].y;
+    uint32_t d_sq = dx * dx + dy * dy;
+
+    int32_t x;
+    for(x = x_start; x < x_end; x++) {
+        if(d_sq < a->cap_none_sq) {
+            int32_t cov = d_sq <= a->cap_full_sq ? 255 : circle_cov(d_sq - a->cap_r * a->cap_r, a->cap_r);
+            int32_t cov_ring = ring_cov(a, ring_d_sq);
+            if(cov_ring < cov) cov = cov_ring;
+            if(cov > mask_buf[x]) mask_buf[x] = (lv_opa_t)cov;
+        }
+
+        d_sq += 4 * dx + 4;
+        dx += 2;
+        ring_d_sq += 4 * ring_dx + 4;
+        ring_dx += 2;
+    }
+}
+
+/**
+ * Coverage of a pixel by the ring without the sides
+ * @param a         the arc's parameters
+ * @param d_sq      squared distance of the pixel's center from the center of the arc
+ * @return          0..255 opacity
+ */
+static inline int32_t ring_cov(const arc_analytic_t * a, uint32_t d_sq)
+{
+    if(d_sq >= a->out_none_sq || d_sq <= a->in_none_sq) return 0;
+
+    int32_t cov = d_sq <= a->out_full_sq ? 255 : circle_cov(d_sq - a->r_out * a->r_out, a->r_out);
+    if(d_sq < a->in_full_sq) {
+        int32_t cov_in = 255 - circle_cov(d_sq - a->r_in * a->r_in, a->r_in);
+        if(cov_in < cov) cov = cov_in;
+    }
+    return cov;
+}
+
+/**
+ * Coverage of a pixel on the edge of a circle
+ * @param diff_sq   squared distance of the pixel's center minus the squared radius
+ * @param r         radius of the circle
+ * @return          0..255 opacity, 128 if the center of the pixel is on the circle
+ */
+static inline int32_t circle_cov(int32_t diff_sq, int32_t r)
+{
+    /*The distance from the edge is approximately `diff_sq / (2 * r)` which is accurate enough
+     *in the 1 px wide anti-aliased band. In 1/2 px units it's 256 / 2 / 2 opacity per unit.*/
+    int32_t cov = 128 - (diff_sq * 64) / r;
+    return LV_CLAMP(0, cov, 255);
+}
+
 #else /*LV_DRAW_SW_COMPLEX*/
 
 void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, const lv_area_t * coords)
@@ -190,6 +190,12 @@ void draw_border_complex(lv_draw_unit_t * draw_unit, const lv_area_t * outer_are
 
     /*Draw the corners*/
     int32_t blend_w;
+    lv_draw_sw_mask_span_t span_buf[LV_DRAW_SW_MASK_SPAN_MAX];
+    uint32_t span_cnt;
+
+    /*When opaque the blenders already skip transparent and fill covered pixels quickly from the mask.
+     *With opacity every visible pixel is mixed so it's worth to split the lines to spans*/
+    lv_draw_sw_mask_span_t * spans = opa < LV_OPA_MAX ? span_buf : NULL;
 
     /*Left and right corner together if they are close to each other*/
     if(!split_hor) {
@@ -202,19 +208,20 @@ void draw_border_complex(lv_draw_unit_t * draw_unit, const lv_area_t * outer_are
             int32_t bottom_y = outer_area->y2 - h;
             if(top_y < draw_area.y1 && bottom_y > draw_area.y2) continue;   /*This line is clipped now*/
 
-            lv_memset(mask_buf, 0xff, draw_area_w);
-            blend_dsc.mask_res = lv_draw_sw_mask_apply(mask_list, mask_buf, blend_area.x1, top_y, draw_area_w);
+            if(spans == NULL) lv_memset(mask_buf, 0xff, draw_area_w);
+            blend_dsc.mask_res = lv_draw_sw_mask_apply_spans(mask_list, mask_buf, blend_area.x1, top_y, draw_area_w,
+                                                             spans, &span_cnt);
 
             if(top_y >= draw_area.y1) {
                 blend_area.y1 = top_y;
                 blend_area.y2 = top_y;
-                lv_draw_sw_blend(draw_unit, &blend_dsc);
+                lv_draw_sw_blend_spans(draw_unit, &blend_dsc, spans, span_cnt);
             }
 
             if(bottom_y <= draw_area.y2) {
                 blend_area.y1 = bottom_y;
                 blend_area.y2 = bottom_y;
-                lv_draw_sw_blend(draw_unit, &blend_dsc);
+                lv_draw_sw_blend_spans(draw_unit, &blend_dsc, spans, span_cnt);
             }
         }
     }
@@ -229,9 +236,10 @@ void draw_border_complex(lv_draw_unit_t * draw_unit, const lv_area_t * outer_are
                     blend_area.y1 = h;
                     blend_area.y2 = h;
 
-                    lv_memset(mask_buf, 0xff, blend_w);
-                    blend_dsc.mask_res = lv_draw_sw_mask_apply(mask_list, mask_buf, blend_area.x1, h, blend_w);
-                    lv_draw_sw_blend(draw_unit, &blend_dsc);
+                    if(spans == NULL) lv_memset(mask_buf, 0xff, blend_w);
+                    blend_dsc.mask_res = lv_draw_sw_mask_apply_spans(mask_list, mask_buf, blend_area.x1, h, blend_w,
+                                                                     spans, &span_cnt);
+                    lv_draw_sw_blend_spans(draw_unit, &blend_dsc, spans, span_cnt);
                 }
             }
 
@@ -240,9 +248,10 @@ void draw_border_complex(lv_draw_unit_t * draw_unit, const lv_area_t * outer_are
                     blend_area.y1 = h;
                     blend_area.y2 = h;
 
-                    lv_memset(mask_buf, 0xff, blend_w);
-                    blend_dsc.mask_res = lv_draw_sw_mask_apply(mask_list, mask_buf, blend_area.x1, h, blend_w);
-                    lv_draw_sw_blend(draw_unit, &blend_dsc);
+                    if(spans == NULL) lv_memset(mask_buf, 0xff, blend_w);
+                    blend_dsc.mask_res = lv_draw_sw_mask_apply_spans(mask_list, mask_buf, blend_area.x1, h, blend_w,
+                                                                     spans, &span_cnt);
+                    lv_draw_sw_blend_spans(draw_unit, &blend_dsc, spans, span_cnt);
                 }
             }
         }
@@ -260,9 +269,10 @@ void draw_border_complex(lv_draw_unit_t * draw_unit, const lv_area_t * outer_are
                     blend_area.y1 = h;
                     blend_area.y2 = h;
 
-                    lv_memset(mask_buf, 0xff, blend_w);
-                    blend_dsc.mask_res = lv_draw_sw_mask_apply(mask_list, mask_buf, blend_area.x1, h, blend_w);
-                    lv_draw_sw_blend(draw_unit, &blend_dsc);
+                    if(spans == NULL) lv_memset(mask_buf, 0xff, blend_w);
+                    blend_dsc.mask_res = lv_draw_sw_mask_apply_spans(mask_list, mask_buf, blend_area.x1, h, blend_w,
+                                                                     spans, &span_cnt);
+                    lv_draw_sw_blend_spans(draw_unit, &blend_dsc, spans, span_cnt);
                 }
             }
 
@@ -271,9 +281,10 @@ void draw_border_complex(lv_draw_unit_t * draw_unit, const lv_area_t * outer_are
                     blend_area.y1 = h;
                     blend_area.y2 = h;
 
-                    lv_memset(mask_buf, 0xff, blend_w);
-                    blend_dsc.mask_res = lv_draw_sw_mask_apply(mask_list, mask_buf, blend_area.x1, h, blend_w);
-                    lv_draw_sw_blend(draw_unit, &blend_dsc);
+                    if(spans == NULL) lv_memset(mask_buf, 0xff, blend_w);
+                    blend_dsc.mask_res = lv_draw_sw_mask_apply_spans(mask_list, mask_buf, blend_area.x1, h, blend_w,
+                                                                     spans, &span_cnt);
+                    lv_draw_sw_blend_spans(draw_unit, &blend_dsc, spans, span_cnt);
                 }
             }
         }
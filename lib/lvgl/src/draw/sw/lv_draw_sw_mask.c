@@ -26,10 +26,32 @@
 #define circle_cache_mutex              LV_GLOBAL_DEFAULT()->draw_info.circle_cache_mutex
 #define _circle_cache                   LV_GLOBAL_DEFAULT()->sw_circle_cache
 
+/*Shorter transparent or covered runs are blended as part of a partial span*/
+#define SPAN_MIN_LEN                    16
+
+/*Maximum number of coverage runs of a mask and of the intersection of the masks on a line*/
+#define MASK_EDGE_MAX                   3
+#define MASK_RUN_MAX                    (2 * MASK_EDGE_MAX + 1)
+#define LINE_RUN_MAX                    24
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*A range of a line where the coverage of a mask can change. Outside of the edges it's the same on the whole range.*/
+typedef struct {
+    int32_t x1;
+    int32_t x2;     /*Excluded*/
+} mask_edge_t;
+
+/*Coverage of a part of a line*/
+typedef struct {
+    int32_t x;
+    int32_t len;
+    lv_draw_sw_mask_span_type_t type;
+    uint32_t masks;     /*A bit for each mask which is partial here, only these are applied on the pixels*/
+} mask_run_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -65,6 +87,20 @@ static void circ_calc_aa4(lv_draw_sw_mask_radius_circle_dsc_t * c, int32_t radiu
 static lv_opa_t * get_next_line(lv_draw_sw_mask_radius_circle_dsc_t * c, int32_t y, int32_t * len,
                                 int32_t * x_start);
 static inline lv_opa_t /* LV_ATTRIBUTE_FAST_MEM */ mask_mix(lv_opa_t mask_act, lv_opa_t mask_new);
+static int32_t /* LV_ATTRIBUTE_FAST_MEM */ angle_mask_split(const lv_draw_sw_mask_angle_param_t * p, int32_t rel_y);
+
+static uint32_t line_mask_edges(const lv_draw_sw_mask_line_param_t * p, int32_t abs_y, mask_edge_t edges[]);
+static uint32_t mask_edges(const lv_draw_sw_mask_common_dsc_t * dsc, int32_t abs_y, mask_edge_t edges[]);
+static uint32_t radius_mask_runs(lv_draw_sw_mask_radius_param_t * p, uint32_t mask_bit, int32_t abs_x, int32_t abs_y,
+                                 int32_t len, mask_run_t runs[]);
+static void add_clipped_run(mask_run_t runs[], uint32_t * cnt, int32_t x1, int32_t x2, int32_t len,
+                            lv_draw_sw_mask_span_type_t type, uint32_t masks);
+static uint32_t mask_runs(lv_draw_sw_mask_common_dsc_t * dsc, uint32_t mask_bit, int32_t abs_x, int32_t abs_y,
+                          int32_t len, mask_run_t runs[]);
+static uint32_t intersect_runs(const mask_run_t a[], uint32_t a_cnt, const mask_run_t b[], uint32_t b_cnt,
+                               mask_run_t res[]);
+static void add_run(mask_run_t runs[], uint32_t * cnt, uint32_t max_cnt, int32_t x, int32_t len,
+                    lv_draw_sw_mask_span_type_t type, uint32_t masks);
 
 /**********************
  *  STATIC VARIABLES
@@ -107,6 +143,107 @@ lv_draw_sw_mask_res_t LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_apply(void * masks[]
     return changed ? LV_DRAW_SW_MASK_RES_CHANGED : LV_DRAW_SW_MASK_RES_FULL_COVER;
 }
 
+lv_draw_sw_mask_res_t LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_apply_spans(void * masks[], lv_opa_t * mask_buf,
+                                                                        int32_t abs_x, int32_t abs_y, int32_t len,
+                                                                        lv_draw_sw_mask_span_t spans[],
+                                                                        uint32_t * span_cnt)
+{
+    *span_cnt = 0;
+    if(spans == NULL) return lv_draw_sw_mask_apply(masks, mask_buf, abs_x, abs_y, len);
+
+    /*Intersect the coverage runs of the masks*/
+    mask_run_t run_buf[2][LINE_RUN_MAX];
+    mask_run_t * runs = run_buf[0];
+    uint32_t run_cnt = 1;
+    runs[0].x = 0;
+    runs[0].len = len;
+    runs[0].type = LV_DRAW_SW_MASK_SPAN_COVER;
+    runs[0].masks = 0;
+
+    uint32_t i;
+    for(i = 0; masks[i]; i++) {
+        mask_run_t m_runs[MASK_RUN_MAX];
+        uint32_t m_run_cnt = mask_runs(masks[i], 1U << LV_MIN(i, 31), abs_x, abs_y, len, m_runs);
+
+        mask_run_t * res = runs == run_buf[0] ? run_buf[1] : run_buf[0];
+        run_cnt = intersect_runs(runs, run_cnt, m_runs, m_run_cnt, res);
+        runs = res;
+        if(run_cnt == 1 && runs[0].type == LV_DRAW_SW_MASK_SPAN_TRANSP) return LV_DRAW_SW_MASK_RES_TRANSP;
+    }
+
+    if(run_cnt == 1 && runs[0].type == LV_DRAW_SW_MASK_SPAN_COVER) {
+        spans[0].x = 0;
+        spans[0].len = len;
+        spans[0].type = LV_DRAW_SW_MASK_SPAN_COVER;
+        *span_cnt = 1;
+        return LV_DRAW_SW_MASK_RES_FULL_COVER;
+    }
+
+    /*Short transparent and covered runs are blended with the partial ones next to them.
+     *If there are too many spans the rest of the line is partial.*/
+    uint32_t cnt = 0;
+    for(i = 0; i < run_cnt; i++) {
+        lv_draw_sw_mask_span_type_t type = runs[i].type;
+        if(type != LV_DRAW_SW_MASK_SPAN_PARTIAL && runs[i].len < SPAN_MIN_LEN) type = LV_DRAW_SW_MASK_SPAN_PARTIAL;
+
+        if(cnt > 0 && (spans[cnt - 1].type == type || cnt == LV_DRAW_SW_MASK_SPAN_MAX)) {
+            if(spans[cnt - 1].type != type) spans[cnt - 1].type = LV_DRAW_SW_MASK_SPAN_PARTIAL;
+            spans[cnt - 1].len = runs[i].x + runs[i].len - spans[cnt - 1].x;
+        }
+        else {
+            spans[cnt].x = runs[i].x;
+            spans[cnt].len = runs[i].len;
+            spans[cnt].type = type;
+            cnt++;
+        }
+    }
+
+    /*Only the pixels of the partial spans are written to the mask buffer*/
+    uint32_t span_i = 0;
+    for(i = 0; i < run_cnt; i++) {
+        while(runs[i].x >= spans[span_i].x + spans[span_i].len) span_i++;
+        if(spans[span_i].type != LV_DRAW_SW_MASK_SPAN_PARTIAL) continue;
+
+        lv_opa_t * buf = &mask_buf[runs[i].x];
+        if(runs[i].type == LV_DRAW_SW_MASK_SPAN_TRANSP) {
+            lv_memzero(buf, runs[i].len);
+            continue;
+        }
+
+        if(runs[i].type == LV_DRAW_SW_MASK_SPAN_COVER) {
+            lv_memset(buf, 0xff, runs[i].len);
+            continue;
+        }
+
+        /*The masks estimate some pixels from the ends of the area they get, so they are applied
+         *a little into the transparent runs around too, which are cleared anyway.*/
+        int32_t ext_left = 0;
+        int32_t ext_right = 0;
+        if(i > 0 && runs[i - 1].type == LV_DRAW_SW_MASK_SPAN_TRANSP) ext_left = LV_MIN(runs[i - 1].len, SPAN_MIN_LEN);
+        if(i + 1 < run_cnt && runs[i + 1].type == LV_DRAW_SW_MASK_SPAN_TRANSP) {
+            ext_right = LV_MIN(runs[i + 1].len, SPAN_MIN_LEN);
+        }
+        buf -= ext_left;
+        int32_t buf_len = ext_left + runs[i].len + ext_right;
+
+        lv_memset(buf, 0xff, buf_len);
+        uint32_t m;
+        for(m = 0; masks[m]; m++) {
+            if((runs[i].masks & (1U << LV_MIN(m, 31))) == 0) continue;
+
+            lv_draw_sw_mask_common_dsc_t * dsc = masks[m];
+            if(dsc->cb(buf, abs_x + runs[i].x - ext_left, abs_y, buf_len, dsc) == LV_DRAW_SW_MASK_RES_TRANSP) {
+                lv_memzero(buf, buf_len);
+                break;
+            }
+        }
+        lv_memzero(buf, ext_left);
+    }
+
+    *span_cnt = cnt;
+    return LV_DRAW_SW_MASK_RES_CHANGED;
+}
+
 void lv_draw_sw_mask_free_param(void * p)
 {
     lv_mutex_lock(&circle_cache_mutex);
@@ -714,25 +851,10 @@ static lv_draw_sw_mask_res_t LV_ATTRIBUTE_FAST_MEM lv_draw_mask_angle(lv_opa_t *
             return LV_DRAW_SW_MASK_RES_FULL_COVER;
         }
 
-        /*Start angle mask can work only from the end of end angle mask*/
-        int32_t end_angle_first = (rel_y * p->end_line.xy_steep) >> 10;
-        int32_t start_angle_last = ((rel_y + 1) * p->start_line.xy_steep) >> 10;
-
-        /*Do not let the line end cross the vertex else it will affect the opposite part*/
-        if(p->cfg.start_angle > 270 && p->cfg.start_angle <= 359 && start_angle_last < 0) start_angle_last = 0;
-        else if(p->cfg.start_angle > 0 && p->cfg.start_angle <= 90 && start_angle_last < 0) start_angle_last = 0;
-        else if(p->cfg.start_angle > 90 && p->cfg.start_angle < 270 && start_angle_last > 0) start_angle_last = 0;
-
-        if(p->cfg.end_angle > 270 && p->cfg.end_angle <= 359 && start_angle_last < 0) start_angle_last = 0;
-        else if(p->cfg.end_angle > 0 &&   p->cfg.end_angle <= 90 && start_angle_last < 0) start_angle_last = 0;
-        else if(p->cfg.end_angle > 90 &&  p->cfg.end_angle < 270 && start_angle_last > 0) start_angle_last = 0;
-
-        int32_t dist = (end_angle_first - start_angle_last) >> 1;
-
         lv_draw_sw_mask_res_t res1 = LV_DRAW_SW_MASK_RES_FULL_COVER;
         lv_draw_sw_mask_res_t res2 = LV_DRAW_SW_MASK_RES_FULL_COVER;
 
-        int32_t tmp = start_angle_last + dist - rel_x;
+        int32_t tmp = angle_mask_split(p, rel_y) - rel_x;
         if(tmp > len) tmp = len;
         if(tmp > 0) {
             res1 = lv_draw_mask_line(&mask_buf[0], abs_x, abs_y, tmp, &p->start_line);
@@ -756,25 +878,10 @@ static lv_draw_sw_mask_res_t LV_ATTRIBUTE_FAST_MEM lv_draw_mask_angle(lv_opa_t *
             return LV_DRAW_SW_MASK_RES_FULL_COVER;
         }
 
-        /*Start angle mask can work only from the end of end angle mask*/
-        int32_t end_angle_first = (rel_y * p->end_line.xy_steep) >> 10;
-        int32_t start_angle_last = ((rel_y + 1) * p->start_line.xy_steep) >> 10;
-
-        /*Do not let the line end cross the vertex else it will affect the opposite part*/
-        if(p->cfg.start_angle > 270 && p->cfg.start_angle <= 359 && start_angle_last < 0) start_angle_last = 0;
-        else if(p->cfg.start_angle > 0 && p->cfg.start_angle <= 90 && start_angle_last < 0) start_angle_last = 0;
-        else if(p->cfg.start_angle > 90 && p->cfg.start_angle < 270 && start_angle_last > 0) start_angle_last = 0;
-
-        if(p->cfg.end_angle > 270 && p->cfg.end_angle <= 359 && start_angle_last < 0) start_angle_last = 0;
-        else if(p->cfg.end_angle > 0 &&   p->cfg.end_angle <= 90 && start_angle_last < 0) start_angle_last = 0;
-        else if(p->cfg.end_angle > 90 &&  p->cfg.end_angle < 270 && start_angle_last > 0) start_angle_last = 0;
-
-        int32_t dist = (end_angle_first - start_angle_last) >> 1;
-
         lv_draw_sw_mask_res_t res1 = LV_DRAW_SW_MASK_RES_FULL_COVER;
         lv_draw_sw_mask_res_t res2 = LV_DRAW_SW_MASK_RES_FULL_COVER;
 
-        int32_t tmp = start_angle_last + dist - rel_x;
+        int32_t tmp = angle_mask_split(p, rel_y) - rel_x;
         if(tmp > len) tmp = len;
         if(tmp > 0) {
             res1 = lv_draw_mask_line(&mask_buf[0], abs_x, abs_y, tmp, (lv_draw_sw_mask_line_param_t *)&p->end_line);
@@ -1233,4 +1340,276 @@ static inline lv_opa_t LV_ATTRIBUTE_FAST_MEM mask_mix(lv_opa_t mask_act, lv_opa_
     return LV_UDIV255(mask_act * mask_new);
 }
 
+/*Start angle mask can work only from the end of end angle mask.
+ *Return where the line is split between them, relative to the vertex*/
+static int32_t LV_ATTRIBUTE_FAST_MEM angle_mask_split(const lv_draw_sw_mask_angle_param_t * p, int32_t rel_y)
+{
+    int32_t end_angle_first = (rel_y * p->end_line.xy_steep) >> 10;
+    int32_t start_angle_last = ((rel_y + 1) * p->start_line.xy_steep) >> 10;
+
+    /*Do not let the line end cross the vertex else it will affect the opposite part*/
+    if(p->cfg.start_angle > 270 && p->cfg.start_angle <= 359 && start_angle_last < 0) start_angle_last = 0;
+    else if(p->cfg.start_angle > 0 && p->cfg.start_angle <= 90 && start_angle_last < 0) start_angle_last = 0;
+    else if(p->cfg.start_angle > 90 && p->cfg.start_angle < 270 && start_angle_last > 0) start_angle_last = 0;
+
+    if(p->cfg.end_angle > 270 && p->cfg.end_angle <= 359 && start_angle_last < 0) start_angle_last = 0;
+    else if(p->cfg.end_angle > 0 &&   p->cfg.end_angle <= 90 && start_angle_last < 0) start_angle_last = 0;
+    else if(p->cfg.end_angle > 90 &&  p->cfg.end_angle < 270 && start_angle_last > 0) start_angle_last = 0;
+
+    int32_t dist = (end_angle_first - start_angle_last) >> 1;
+
+    return start_angle_last + dist;
+}
+
+static uint32_t line_mask_edges(const lv_draw_sw_mask_line_param_t * p, int32_t abs_y, mask_edge_t edges[])
+{
+    if(p->steep == 0) {
+        /*Horizontal lines cover or clear the whole line*/
+        if(p->flat) return 0;
+
+        /*Vertical lines have a sharp edge*/
+        edges[0].x1 = p->origo.x - 2;
+        edges[0].x2 = p->origo.x + 2;
+        return 1;
+    }
+
+    /*The anti-aliased pixels are where the line crosses the row and a few pixels around it.
+     *Flat lines fade out over the width of a row more, so the rows around are also added.*/
+    int32_t rel_y = abs_y - p->origo.y;
+    int32_t x_top = (int32_t)(((int64_t)(rel_y - 1) * p->xy_steep) >> 10);
+    int32_t x_bottom = (int32_t)(((int64_t)(rel_y + 2) * p->xy_steep) >> 10);
+    edges[0].x1 = p->origo.x + LV_MIN(x_top, x_bottom) - 2;
+    edges[0].x2 = p->origo.x + LV_MAX(x_top, x_bottom) + 3;
+    return 1;
+}
+
+/*Get the ranges of a line where a mask is not the same on every pixel.
+ *The edges can be wider than needed but each of them has to contain all the changes.*/
+static uint32_t mask_edges(const lv_draw_sw_mask_common_dsc_t * dsc, int32_t abs_y, mask_edge_t edges[])
+{
+    switch(dsc->type) {
+        case LV_DRAW_SW_MASK_TYPE_LINE:
+            return line_mask_edges((const lv_draw_sw_mask_line_param_t *)dsc, abs_y, edges);
+
+        case LV_DRAW_SW_MASK_TYPE_ANGLE: {
+                const lv_draw_sw_mask_angle_param_t * p = (const lv_draw_sw_mask_angle_param_t *)dsc;
+                uint32_t cnt = line_mask_edges(&p->start_line, abs_y, edges);
+                cnt += line_mask_edges(&p->end_line, abs_y, &edges[cnt]);
+
+                /*Where the line is split between the start and end line masks*/
+                if((p->cfg.start_angle < 180 && p->cfg.end_angle < 180 &&
+                    p->cfg.start_angle != 0  && p->cfg.end_angle != 0 && p->cfg.start_angle > p->cfg.end_angle) ||
+                   (p->cfg.start_angle > 180 && p->cfg.end_angle > 180 && p->cfg.start_angle > p->cfg.end_angle)) {
+                    int32_t split = p->cfg.vertex_p.x + angle_mask_split(p, abs_y - p->cfg.vertex_p.y);
+                    edges[cnt].x1 = split - 1;
+                    edges[cnt].x2 = split + 1;
+                    cnt++;
+                }
+                return cnt;
+            }
+
+        case LV_DRAW_SW_MASK_TYPE_FADE: {
+                /*The same opacity on the whole row of the area*/
+                const lv_area_t * coords = &((const lv_draw_sw_mask_fade_param_t *)dsc)->cfg.coords;
+                if(abs_y < coords->y1 || abs_y > coords->y2) return 0;
+                edges[0].x1 = coords->x1 - 1;
+                edges[0].x2 = coords->x1 + 1;
+                edges[1].x1 = coords->x2;
+                edges[1].x2 = coords->x2 + 2;
+                return 2;
+            }
+
+        case LV_DRAW_SW_MASK_TYPE_MAP: {
+                const lv_area_t * coords = &((const lv_draw_sw_mask_map_param_t *)dsc)->cfg.coords;
+                if(abs_y < coords->y1 || abs_y > coords->y2) return 0;
+                edges[0].x1 = coords->x1 - 1;
+                edges[0].x2 = coords->x2 + 2;
+                return 1;
+            }
+
+        default:
+            edges[0].x1 = INT32_MIN / 2;
+            edges[0].x2 = INT32_MAX / 2;
+            return 1;
+    }
+}
+
+/*Split a line to transparent, covered and partial runs by a mask.
+ *The edges are partial and the parts between them are probed with one pixel.*/
+static uint32_t radius_mask_runs(lv_draw_sw_mask_radius_param_t * p, uint32_t mask_bit, int32_t abs_x, int32_t abs_y,
+                                 int32_t len, mask_run_t runs[])
+{
+    /*The rectangle is exact so the runs can be calculated without testing pixels*/
+    const lv_area_t * rect = &p->cfg.rect;
+    int32_t radius = p->cfg.radius;
+    lv_draw_sw_mask_span_type_t in = p->cfg.outer ? LV_DRAW_SW_MASK_SPAN_TRANSP : LV_DRAW_SW_MASK_SPAN_COVER;
+    lv_draw_sw_mask_span_type_t out = p->cfg.outer ? LV_DRAW_SW_MASK_SPAN_COVER : LV_DRAW_SW_MASK_SPAN_TRANSP;
+    uint32_t cnt = 0;
+
+    if(abs_y < rect->y1 || abs_y > rect->y2) {
+        add_run(runs, &cnt, MASK_RUN_MAX, 0, len, out, 0);
+        return cnt;
+    }
+
+    /*Where `lv_draw_mask_radius()` handles the line as a plain rectangle*/
+    if((abs_x >= rect->x1 + radius && abs_x + len <= rect->x2 - radius) ||
+       (abs_y >= rect->y1 + radius && abs_y <= rect->y2 - radius)) {
+        add_clipped_run(runs, &cnt, INT32_MIN / 2, rect->x1 - abs_x, len, out, 0);
+        add_clipped_run(runs, &cnt, rect->x1 - abs_x, rect->x2 - abs_x + 1, len, in, 0);
+        add_clipped_run(runs, &cnt, rect->x2 - abs_x + 1, INT32_MAX / 2, len, out, 0);
+        return cnt;
+    }
+
+    /*The anti-aliased pixels of the corners, calculated like in `lv_draw_mask_radius()`*/
+    int32_t cir_y;
+    if(abs_y - rect->y1 < radius) cir_y = radius - (abs_y - rect->y1) - 1;
+    else cir_y = (abs_y - rect->y1) - (lv_area_get_height(rect) - radius);
+    int32_t aa_len;
+    int32_t x_start;
+    get_next_line(p->circle, cir_y, &aa_len, &x_start);
+    int32_t cir_x_left = rect->x1 + radius - x_start - 1 - abs_x;
+    int32_t cir_x_right = rect->x1 + lv_area_get_width(rect) - radius + x_start - abs_x;
+
+    int32_t left_x1 = cir_x_left - aa_len + 1;
+    int32_t left_x2 = cir_x_left + 1;
+    int32_t right_x1 = cir_x_right;
+    int32_t right_x2 = cir_x_right + aa_len;
+    if(left_x2 > right_x1) {
+        /*Small circles: the two sides overlap*/
+        left_x1 = LV_MIN(left_x1, right_x1);
+        right_x2 = LV_MAX(left_x2, right_x2);
+        left_x2 = right_x1 = left_x1;
+    }
+
+    add_clipped_run(runs, &cnt, INT32_MIN / 2, left_x1, len, out, 0);
+    add_clipped_run(runs, &cnt, left_x1, left_x2, len, LV_DRAW_SW_MASK_SPAN_PARTIAL, mask_bit);
+    add_clipped_run(runs, &cnt, left_x2, right_x1, len, in, 0);
+    add_clipped_run(runs, &cnt, right_x1, right_x2, len, LV_DRAW_SW_MASK_SPAN_PARTIAL, mask_bit);
+    add_clipped_run(runs, &cnt, right_x2, INT32_MAX / 2, len, out, 0);
+    return cnt;
+}
+
+static void add_clipped_run(mask_run_t runs[], uint32_t * cnt, int32_t x1, int32_t x2, int32_t len,
+                            lv_draw_sw_mask_span_type_t type, uint32_t masks)
+{
+    x1 = LV_CLAMP(0, x1, len);
+    x2 = LV_CLAMP(0, x2, len);
+    if(x2 > x1) add_run(runs, cnt, MASK_RUN_MAX, x1, x2 - x1, type, masks);
+}
+
+static uint32_t mask_runs(lv_draw_sw_mask_common_dsc_t * dsc, uint32_t mask_bit, int32_t abs_x, int32_t abs_y,
+                          int32_t len, mask_run_t runs[])
+{
+    if(dsc->type == LV_DRAW_SW_MASK_TYPE_RADIUS) {
+        return radius_mask_runs((lv_draw_sw_mask_radius_param_t *)dsc, mask_bit, abs_x, abs_y, len, runs);
+    }
+
+    mask_edge_t edges[MASK_EDGE_MAX];
+    uint32_t edge_cnt = mask_edges(dsc, abs_y, edges);
+
+    /*Make them relative to the line and sort them*/
+    uint32_t i;
+    for(i = 0; i < edge_cnt; i++) {
+        edges[i].x1 = LV_CLAMP(0, edges[i].x1 - abs_x, len);
+        edges[i].x2 = LV_CLAMP(0, edges[i].x2 - abs_x, len);
+
+        uint32_t j;
+        for(j = i; j > 0 && edges[j].x1 < edges[j - 1].x1; j--) {
+            mask_edge_t tmp = edges[j];
+            edges[j] = edges[j - 1];
+            edges[j - 1] = tmp;
+        }
+    }
+
+    uint32_t cnt = 0;
+    int32_t x = 0;
+    for(i = 0; i <= edge_cnt; i++) {
+        int32_t edge_x1 = i < edge_cnt ? edges[i].x1 : len;
+        if(edge_x1 > x) {
+            lv_draw_sw_mask_span_type_t type;
+            if(dsc->type == LV_DRAW_SW_MASK_TYPE_LINE && ((lv_draw_sw_mask_line_param_t *)dsc)->steep != 0 &&
+               cnt > 0 && runs[0].type != LV_DRAW_SW_MASK_SPAN_PARTIAL) {
+                /*The two sides of a sloped line are the opposite of each other*/
+                type = runs[0].type == LV_DRAW_SW_MASK_SPAN_TRANSP ? LV_DRAW_SW_MASK_SPAN_COVER :
+                       LV_DRAW_SW_MASK_SPAN_TRANSP;
+            }
+            else {
+                lv_opa_t opa = LV_OPA_COVER;
+                lv_draw_sw_mask_res_t res = dsc->cb(&opa, abs_x + x, abs_y, 1, dsc);
+                if(res == LV_DRAW_SW_MASK_RES_TRANSP || opa == LV_OPA_TRANSP) type = LV_DRAW_SW_MASK_SPAN_TRANSP;
+                else if(opa == LV_OPA_COVER) type = LV_DRAW_SW_MASK_SPAN_COVER;
+                else type = LV_DRAW_SW_MASK_SPAN_PARTIAL;
+            }
+            add_run(runs, &cnt, MASK_RUN_MAX, x, edge_x1 - x, type,
+                    type == LV_DRAW_SW_MASK_SPAN_PARTIAL ? mask_bit : 0);
+            x = edge_x1;
+        }
+
+        if(i < edge_cnt && edges[i].x2 > x) {
+            add_run(runs, &cnt, MASK_RUN_MAX, x, edges[i].x2 - x, LV_DRAW_SW_MASK_SPAN_PARTIAL, mask_bit);
+            x = edges[i].x2;
+        }
+    }
+
+    return cnt;
+}
+
+/*Intersect the runs of two masks: transparent where any of them is transparent,
+ *covered where both are covered and partial elsewhere*/
+static uint32_t intersect_runs(const mask_run_t a[], uint32_t a_cnt, const mask_run_t b[], uint32_t b_cnt,
+                               mask_run_t res[])
+{
+    uint32_t cnt = 0;
+    uint32_t i = 0;
+    uint32_t j = 0;
+    int32_t x = 0;
+    while(i < a_cnt && j < b_cnt) {
+        int32_t a_end = a[i].x + a[i].len;
+        int32_t b_end = b[j].x + b[j].len;
+        int32_t end = LV_MIN(a_end, b_end);
+
+        if(a[i].type == LV_DRAW_SW_MASK_SPAN_TRANSP || b[j].type == LV_DRAW_SW_MASK_SPAN_TRANSP) {
+            add_run(res, &cnt, LINE_RUN_MAX, x, end - x, LV_DRAW_SW_MASK_SPAN_TRANSP, 0);
+        }
+        else if(a[i].type == LV_DRAW_SW_MASK_SPAN_COVER && b[j].type == LV_DRAW_SW_MASK_SPAN_COVER) {
+            add_run(res, &cnt, LINE_RUN_MAX, x, end - x, LV_DRAW_SW_MASK_SPAN_COVER, 0);
+        }
+        else {
+            add_run(res, &cnt, LINE_RUN_MAX, x, end - x, LV_DRAW_SW_MASK_SPAN_PARTIAL, a[i].masks | b[j].masks);
+        }
+
+        x = end;
+        if(a_end == end) i++;
+        if(b_end == end) j++;
+    }
+
+    return cnt;
+}
+
+/*Append a run or extend the last one if it has the same type.
+ *If there is no more space the last run is extended and becomes partial.*/
+static void add_run(mask_run_t runs[], uint32_t * cnt, uint32_t max_cnt, int32_t x, int32_t len,
+                    lv_draw_sw_mask_span_type_t type, uint32_t masks)
+{
+    if(*cnt > 0) {
+        mask_run_t * last = &runs[*cnt - 1];
+        if(last->type == type || *cnt == max_cnt) {
+            /*Where transparent and covered parts are merged every mask has to be applied*/
+            if(last->type != type) {
+                last->type = LV_DRAW_SW_MASK_SPAN_PARTIAL;
+                last->masks = UINT32_MAX;
+            }
+            last->len = x + len - last->x;
+            last->masks |= masks;
+            return;
+        }
+    }
+
+    runs[*cnt].x = x;
+    runs[*cnt].len = len;
+    runs[*cnt].type = type;
+    runs[*cnt].masks = masks;
+    (*cnt)++;
+}
+
 #endif /*LV_DRAW_SW_COMPLEX*/
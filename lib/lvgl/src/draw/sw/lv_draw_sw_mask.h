@@ -28,6 +28,9 @@ extern "C" {
 # define LV_MASK_MAX_NUM     1
 #endif
 
+/** Maximum number of spans `lv_draw_sw_mask_apply_spans()` splits a line to*/
+#define LV_DRAW_SW_MASK_SPAN_MAX    8
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -56,6 +59,19 @@ typedef enum {
     LV_DRAW_SW_MASK_LINE_SIDE_BOTTOM,
 } lv_draw_sw_mask_line_side_t;
 
+typedef enum {
+    LV_DRAW_SW_MASK_SPAN_TRANSP,    /**< Every pixel is transparent, nothing to draw*/
+    LV_DRAW_SW_MASK_SPAN_COVER,     /**< Every pixel is fully covered, can be filled without a mask*/
+    LV_DRAW_SW_MASK_SPAN_PARTIAL,   /**< The opacity of the pixels is in the mask buffer*/
+} lv_draw_sw_mask_span_type_t;
+
+/** A run of pixels with the same kind of coverage in a masked line*/
+typedef struct {
+    int32_t x;                          /**< Start of the span relative to the start of the line*/
+    int32_t len;                        /**< Length of the span in pixels*/
+    lv_draw_sw_mask_span_type_t type;
+} lv_draw_sw_mask_span_t;
+
 /**
  * A common callback type for every mask type.
  * Used internally by the library.
@@ -91,6 +107,29 @@ lv_draw_sw_mask_res_t /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_mask_apply(void * m
                                                                         int32_t abs_y,
                                                                         int32_t len);
 
+/**
+ * Get the coverage of a line as runs of transparent, fully covered and partially covered pixels.
+ * Each mask gives the ranges where its coverage can change (radius masks give their runs directly),
+ * the rest is tested with one pixel.
+ * The runs of the masks are intersected and only the partial runs are calculated pixel by pixel.
+ * Short runs are merged into partial spans as blending them one by one would cost more than
+ * the per pixel blending.
+ * @param masks the masks list to apply, must be ended with NULL pointer in array.
+ * @param mask_buf store the result mask here. Has to be `len` byte long. Only the pixels of the partial
+ *                 spans are set. If `spans` is `NULL` it should be initialized with `0xFF`.
+ * @param abs_x absolute X coordinate where the line to calculate start
+ * @param abs_y absolute Y coordinate where the line to calculate start
+ * @param len length of the line to calculate (in pixel count)
+ * @param spans store the spans here. Has to be `LV_DRAW_SW_MASK_SPAN_MAX` long.
+ *              If `NULL` the masks are applied on the whole line like `lv_draw_sw_mask_apply()`.
+ * @param span_cnt store the number of spans here. 0 if the whole line is transparent.
+ * @return same as `lv_draw_sw_mask_apply()`
+ */
+lv_draw_sw_mask_res_t /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_mask_apply_spans(void * masks[], lv_opa_t * mask_buf,
+                                                                              int32_t abs_x, int32_t abs_y, int32_t len,
+                                                                              lv_draw_sw_mask_span_t spans[],
+                                                                              uint32_t * span_cnt);
+
 //! @endcond
 
 /**
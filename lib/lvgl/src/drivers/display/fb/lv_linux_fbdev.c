@@ -65,6 +65,10 @@ typedef struct {
     long int screensize;
     int fbfd;
     bool force_refresh;
+#if LV_LINUX_FBDEV_PAGE_FLIP
+    bool page_flip;
+    lv_draw_buf_t fb_bufs[2];
+#endif
 } lv_linux_fb_t;
 
 /**********************
@@ -73,6 +77,10 @@ typedef struct {
 
 static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * color_p);
 static uint32_t tick_get_cb(void);
+#if LV_LINUX_FBDEV_PAGE_FLIP
+    static bool page_flip_init(lv_linux_fb_t * dsc);
+    static void page_flip(lv_display_t * disp, uint8_t * color_p);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -176,6 +184,10 @@ void lv_linux_fbdev_set_file(lv_display_t * disp, const char * file)
         perror("Error reading variable information");
         return;
     }
+
+#if LV_LINUX_FBDEV_PAGE_FLIP
+    dsc->page_flip = page_flip_init(dsc);
+#endif
 #endif /* LV_LINUX_FBDEV_BSD */
 
     LV_LOG_INFO("%dx%d, %dbpp", dsc->vinfo.xres, dsc->vinfo.yres, dsc->vinfo.bits_per_pixel);
@@ -213,6 +225,34 @@ void lv_linux_fbdev_set_file(lv_display_t * disp, const char * file)
     int32_t hor_res = dsc->vinfo.xres;
     int32_t ver_res = dsc->vinfo.yres;
     int32_t width = dsc->vinfo.width;
+
+    lv_display_set_resolution(disp, hor_res, ver_res);
+
+    if(width > 0) {
+        lv_display_set_dpi(disp, DIV_ROUND_UP(hor_res * 254, width * 10));
+    }
+
+    LV_LOG_INFO("Resolution is set to %" LV_PRId32 "x%" LV_PRId32 " at %" LV_PRId32 "dpi",
+                hor_res, ver_res, lv_display_get_dpi(disp));
+
+#if LV_LINUX_FBDEV_PAGE_FLIP
+    if(dsc->page_flip) {
+        /* Render straight into the two halves of the framebuffer with its own line length as stride.
+         * Start with the hidden half so that the first frame isn't drawn on the screen.
+         * LVGL keeps the two halves in sync so each frame only renders the changed areas.*/
+        lv_color_format_t cf = lv_display_get_color_format(disp);
+        uint32_t fb_size = dsc->finfo.line_length * ver_res;
+        uint8_t * fbp = (uint8_t *)dsc->fbp;
+        lv_draw_buf_init(&dsc->fb_bufs[0], hor_res, ver_res, cf, dsc->finfo.line_length, fbp + fb_size, fb_size);
+        lv_draw_buf_init(&dsc->fb_bufs[1], hor_res, ver_res, cf, dsc->finfo.line_length, fbp, fb_size);
+        lv_display_set_draw_buffers(disp, &dsc->fb_bufs[0], &dsc->fb_bufs[1]);
+        lv_display_set_render_mode(disp, LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_FULL ?
+                                   LV_DISPLAY_RENDER_MODE_FULL : LV_DISPLAY_RENDER_MODE_DIRECT);
+        LV_LOG_INFO("Rendering directly into the framebuffer with page flipping");
+        return;
+    }
+#endif
+
     uint32_t draw_buf_size = hor_res * (dsc->vinfo.bits_per_pixel >> 3);
     if(LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_PARTIAL) {
         draw_buf_size *= LV_LINUX_FBDEV_BUFFER_SIZE;
@@ -229,15 +269,7 @@ void lv_linux_fbdev_set_file(lv_display_t * disp, const char * file)
         draw_buf_2 = malloc(draw_buf_size);
     }
 
-    lv_display_set_resolution(disp, hor_res, ver_res);
     lv_display_set_buffers(disp, draw_buf, draw_buf_2, draw_buf_size, LV_LINUX_FBDEV_RENDER_MODE);
-
-    if(width > 0) {
-        lv_display_set_dpi(disp, DIV_ROUND_UP(hor_res * 254, width * 10));
-    }
-
-    LV_LOG_INFO("Resolution is set to %" LV_PRId32 "x%" LV_PRId32 " at %" LV_PRId32 "dpi",
-                hor_res, ver_res, lv_display_get_dpi(disp));
 }
 
 void lv_linux_fbdev_set_force_refresh(lv_display_t * disp, bool enabled)
@@ -259,6 +291,15 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
         return;
     }
 
+#if LV_LINUX_FBDEV_PAGE_FLIP
+    if(dsc->page_flip) {
+        /* The pixels are already in the framebuffer, only the visible half has to be changed */
+        if(lv_display_flush_is_last(disp)) page_flip(disp, color_p);
+        lv_display_flush_ready(disp);
+        return;
+    }
+#endif
+
     int32_t w = lv_area_get_width(area);
     int32_t h = lv_area_get_height(area);
     lv_color_format_t cf = lv_display_get_color_format(disp);
@@ -269,17 +310,18 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
 
     /* Not all framebuffer kernel drivers support hardware rotation, so we need to handle it in software here */
     if(rotation != LV_DISPLAY_ROTATION_0 && LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_PARTIAL) {
-        /* (Re)allocate temporary buffer if needed */
-        size_t buf_size = w * h * px_size;
-        if(!dsc->rotated_buf || dsc->rotated_buf_size != buf_size) {
-            dsc->rotated_buf = realloc(dsc->rotated_buf, buf_size);
-            dsc->rotated_buf_size = buf_size;
-        }
-
         /* Rotate the pixel buffer */
         uint32_t w_stride = lv_draw_buf_width_to_stride(w, cf);
         uint32_t h_stride = lv_draw_buf_width_to_stride(h, cf);
 
+        /* Grow the temporary buffer if needed. The areas are flushed with various sizes
+         * so keep the largest instead of reallocating for each flush. */
+        size_t buf_size = LV_MAX(w_stride * h, h_stride * w);
+        if(!dsc->rotated_buf || dsc->rotated_buf_size < buf_size) {
+            dsc->rotated_buf = realloc(dsc->rotated_buf, buf_size);
+            dsc->rotated_buf_size = buf_size;
+        }
+
         switch(rotation) {
             case LV_DISPLAY_ROTATION_0:
                 break;
@@ -348,6 +390,78 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
     lv_display_flush_ready(disp);
 }
 
+#if LV_LINUX_FBDEV_PAGE_FLIP
+
+/**
+ * Make the virtual resolution twice as high as the screen to have room for two frames.
+ * Called after reading the screen info, before mapping the framebuffer.
+ * @param dsc   the framebuffer descriptor
+ * @return      true if page flipping can be used
+ */
+static bool page_flip_init(lv_linux_fb_t * dsc)
+{
+    if(LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_PARTIAL) {
+        LV_LOG_WARN("Page flipping requires direct or full render mode");
+        return false;
+    }
+
+    if(dsc->vinfo.yres_virtual < dsc->vinfo.yres * 2 || dsc->vinfo.yoffset != 0 || dsc->vinfo.xoffset != 0) {
+        dsc->vinfo.yres_virtual = dsc->vinfo.yres * 2;
+        dsc->vinfo.xoffset = 0;
+        dsc->vinfo.yoffset = 0;
+        dsc->vinfo.activate = FB_ACTIVATE_NOW;
+        if(ioctl(dsc->fbfd, FBIOPUT_VSCREENINFO, &dsc->vinfo) == -1) {
+            perror("ioctl(FBIOPUT_VSCREENINFO)");
+        }
+
+        /* The driver can adjust or ignore the request, so read back what it has set*/
+        if(ioctl(dsc->fbfd, FBIOGET_VSCREENINFO, &dsc->vinfo) == -1 ||
+           ioctl(dsc->fbfd, FBIOGET_FSCREENINFO, &dsc->finfo) == -1) {
+            perror("Error reading screen information");
+            return false;
+        }
+    }
+
+    if(dsc->vinfo.yres_virtual < dsc->vinfo.yres * 2 ||
+       dsc->finfo.smem_len < dsc->finfo.line_length * dsc->vinfo.yres * 2 ||
+       dsc->finfo.ypanstep == 0) {
+        LV_LOG_WARN("The framebuffer can't hold or pan between two frames, falling back to copying");
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Show the half of the framebuffer which was rendered last.
+ * @param disp      pointer to a display
+ * @param color_p   the start of the rendered half
+ */
+static void page_flip(lv_display_t * disp, uint8_t * color_p)
+{
+    lv_linux_fb_t * dsc = lv_display_get_driver_data(disp);
+
+    dsc->vinfo.yoffset = color_p == dsc->fb_bufs[0].data ? dsc->vinfo.yres : 0;
+    if(ioctl(dsc->fbfd, FBIOPAN_DISPLAY, &dsc->vinfo) == -1) {
+        perror("ioctl(FBIOPAN_DISPLAY)");
+        return;
+    }
+
+    if(dsc->force_refresh) {
+        dsc->vinfo.activate |= FB_ACTIVATE_NOW | FB_ACTIVATE_FORCE;
+        if(ioctl(dsc->fbfd, FBIOPUT_VSCREENINFO, &(dsc->vinfo)) == -1) {
+            perror("Error setting var screen info");
+        }
+    }
+
+    /* LVGL renders the next frame into the half which was shown until now. Wait until the
+     * panning has taken effect to avoid tearing. Not all drivers support it, so ignore the errors.*/
+    uint32_t crtc = 0;
+    ioctl(dsc->fbfd, FBIO_WAITFORVSYNC, &crtc);
+}
+
+#endif /*LV_LINUX_FBDEV_PAGE_FLIP*/
+
 static uint32_t tick_get_cb(void)
 {
     struct timespec t;
@@ -0,0 +1,130 @@
+/**
+ * @file lv_gc9a01.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_gc9a01.h"
+
+#if LV_USE_GC9A01
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define CMD_INREGEN1    0xFE    /* Inter register enable 1 */
+#define CMD_INREGEN2    0xEF    /* Inter register enable 2 */
+#define CMD_DFUNCTR     0xB6    /* Display function control */
+#define CMD_PWCTR2      0xC3    /* Power control 2 */
+#define CMD_PWCTR3      0xC4    /* Power control 3 */
+#define CMD_PWCTR4      0xC9    /* Power control 4 */
+#define CMD_FRAMERATE   0xE8    /* Frame rate */
+#define CMD_GAMMA1      0xF0    /* Set gamma 1 */
+#define CMD_GAMMA2      0xF1    /* Set gamma 2 */
+#define CMD_GAMMA3      0xF2    /* Set gamma 3 */
+#define CMD_GAMMA4      0xF3    /* Set gamma 4 */
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC CONSTANTS
+ **********************/
+
+/* init commands based on the Adafruit GC9A01A driver (undocumented registers from the vendor's sequence) */
+static const uint8_t init_cmd_list[] = {
+    CMD_INREGEN2,   0,
+    0xEB,           1,  0x14,
+    CMD_INREGEN1,   0,
+    CMD_INREGEN2,   0,
+    0xEB,           1,  0x14,
+    0x84,           1,  0x40,
+    0x85,           1,  0xFF,
+    0x86,           1,  0xFF,
+    0x87,           1,  0xFF,
+    0x88,           1,  0x0A,
+    0x89,           1,  0x21,
+    0x8A,           1,  0x00,
+    0x8B,           1,  0x80,
+    0x8C,           1,  0x01,
+    0x8D,           1,  0x01,
+    0x8E,           1,  0xFF,
+    0x8F,           1,  0xFF,
+    CMD_DFUNCTR,    2,  0x00, 0x00,
+    0x90,           4,  0x08, 0x08, 0x08, 0x08,
+    0xBD,           1,  0x06,
+    0xBC,           1,  0x00,
+    0xFF,           3,  0x60, 0x01, 0x04,
+    CMD_PWCTR2,     1,  0x13,
+    CMD_PWCTR3,     1,  0x13,
+    CMD_PWCTR4,     1,  0x22,
+    0xBE,           1,  0x11,
+    0xE1,           2,  0x10, 0x0E,
+    0xDF,           3,  0x21, 0x0C, 0x02,
+    CMD_GAMMA1,     6,  0x45, 0x09, 0x08, 0x08, 0x26, 0x2A,
+    CMD_GAMMA2,     6,  0x43, 0x70, 0x72, 0x36, 0x37, 0x6F,
+    CMD_GAMMA3,     6,  0x45, 0x09, 0x08, 0x08, 0x26, 0x2A,
+    CMD_GAMMA4,     6,  0x43, 0x70, 0x72, 0x36, 0x37, 0x6F,
+    0xED,           2,  0x1B, 0x0B,
+    0xAE,           1,  0x77,
+    0xCD,           1,  0x63,
+    0x70,           9,  0x07, 0x07, 0x04, 0x0E, 0x0F, 0x09, 0x07, 0x08, 0x03,
+    CMD_FRAMERATE,  1,  0x34,
+    0x62,           12, 0x18, 0x0D, 0x71, 0xED, 0x70, 0x70, 0x18, 0x0F, 0x71, 0xEF, 0x70, 0x70,
+    0x63,           12, 0x18, 0x11, 0x71, 0xF1, 0x70, 0x70, 0x18, 0x13, 0x71, 0xF3, 0x70, 0x70,
+    0x64,           7,  0x28, 0x29, 0xF1, 0x01, 0xF1, 0x00, 0x07,
+    0x66,           10, 0x3C, 0x00, 0xCD, 0x67, 0x45, 0x45, 0x10, 0x00, 0x00, 0x00,
+    0x67,           10, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x54, 0x10, 0x32, 0x98,
+    0x74,           7,  0x10, 0x85, 0x80, 0x00, 0x00, 0x4E, 0x00,
+    0x98,           2,  0x3E, 0x07,
+    LV_LCD_CMD_ENTER_INVERT_MODE, 0,    /* the panels are built for inverted colors */
+    LV_LCD_CMD_DELAY_MS, LV_LCD_CMD_EOF
+};
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_display_t * lv_gc9a01_create(uint32_t hor_res, uint32_t ver_res, lv_lcd_flag_t flags,
+                                lv_gc9a01_send_cmd_cb_t send_cmd_cb, lv_gc9a01_send_color_cb_t send_color_cb)
+{
+    lv_display_t * disp = lv_lcd_generic_mipi_create(hor_res, ver_res, flags, send_cmd_cb, send_color_cb);
+    lv_lcd_generic_mipi_send_cmd_list(disp, init_cmd_list);
+    return disp;
+}
+
+void lv_gc9a01_set_gap(lv_display_t * disp, uint16_t x, uint16_t y)
+{
+    lv_lcd_generic_mipi_set_gap(disp, x, y);
+}
+
+void lv_gc9a01_set_invert(lv_display_t * disp, bool invert)
+{
+    lv_lcd_generic_mipi_set_invert(disp, invert);
+}
+
+void lv_gc9a01_send_cmd_list(lv_display_t * disp, const uint8_t * cmd_list)
+{
+    lv_lcd_generic_mipi_send_cmd_list(disp, cmd_list);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#endif /*LV_USE_GC9A01*/
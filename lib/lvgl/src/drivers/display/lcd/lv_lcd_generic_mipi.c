@@ -31,6 +31,7 @@ static void set_swap_xy(lv_lcd_generic_mipi_driver_t * drv, bool swap);
 static void set_rotation(lv_lcd_generic_mipi_driver_t * drv, lv_display_rotation_t rot);
 static void res_chg_event_cb(lv_event_t * e);
 static lv_lcd_generic_mipi_driver_t * get_driver(lv_display_t * disp);
+static uint8_t * add_window_cmd(uint8_t * cmd_list, uint8_t cmd, uint8_t * saved, const uint8_t * param, bool force);
 static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 
 /**********************
@@ -63,6 +64,7 @@ lv_display_t * lv_lcd_generic_mipi_create(uint32_t hor_res, uint32_t ver_res, lv
     drv->disp = disp;
     drv->send_cmd = send_cmd_cb;
     drv->send_color = send_color_cb;
+    drv->send_batch = NULL;
     lv_display_set_driver_data(disp, (void *)drv);
 
     /* init controller */
@@ -77,11 +79,18 @@ lv_display_t * lv_lcd_generic_mipi_create(uint32_t hor_res, uint32_t ver_res, lv
     return disp;
 }
 
+void lv_lcd_generic_mipi_set_send_batch_cb(lv_display_t * disp, lv_lcd_send_batch_cb_t send_batch_cb)
+{
+    lv_lcd_generic_mipi_driver_t * drv = get_driver(disp);
+    drv->send_batch = send_batch_cb;
+}
+
 void lv_lcd_generic_mipi_set_gap(lv_display_t * disp, uint16_t x, uint16_t y)
 {
     lv_lcd_generic_mipi_driver_t * drv = get_driver(disp);
     drv->x_gap = x;
     drv->y_gap = y;
+    drv->window_valid = false;
 }
 
 void lv_lcd_generic_mipi_set_invert(lv_display_t * disp, bool invert)
@@ -115,6 +124,7 @@ void lv_lcd_generic_mipi_set_gamma_curve(lv_display_t * disp, uint8_t gamma)
 void lv_lcd_generic_mipi_send_cmd_list(lv_display_t * disp, const uint8_t * cmd_list)
 {
     lv_lcd_generic_mipi_driver_t * drv = get_driver(disp);
+    drv->window_valid = false;      /* the list may reset the controller or change the window */
     while(1) {
         uint8_t cmd = *cmd_list++;
         uint8_t num = *cmd_list++;
@@ -170,6 +180,7 @@ static void init(lv_lcd_generic_mipi_driver_t * drv, lv_lcd_flag_t flags)
 {
     drv->x_gap = 0;
     drv->y_gap = 0;
+    drv->window_valid = false;
 
     /* init color mode and RGB order */
     drv->madctl_reg = flags & LV_LCD_FLAG_BGR ? LV_LCD_BIT_RGB_ORDER__BGR : LV_LCD_BIT_RGB_ORDER__RGB;
@@ -263,24 +274,61 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_m
     y_start += drv->y_gap;
     y_end += drv->y_gap;
 
-    /* define an area of frame memory where MCU can access */
-    send_cmd(drv, LV_LCD_CMD_SET_COLUMN_ADDRESS, (uint8_t[]) {
+    /* define an area of frame memory where MCU can access, skip the addresses already set (e.g. same columns
+     * for all the stripes of a partial refresh) */
+    uint8_t * cmd_list = drv->window_cmds;
+    cmd_list = add_window_cmd(cmd_list, LV_LCD_CMD_SET_COLUMN_ADDRESS, drv->caset, (uint8_t[]) {
         (x_start >> 8) & 0xFF,
         x_start & 0xFF,
         ((x_end - 1) >> 8) & 0xFF,
         (x_end - 1) & 0xFF,
-    }, 4);
-    send_cmd(drv, LV_LCD_CMD_SET_PAGE_ADDRESS, (uint8_t[]) {
+    }, !drv->window_valid);
+    cmd_list = add_window_cmd(cmd_list, LV_LCD_CMD_SET_PAGE_ADDRESS, drv->raset, (uint8_t[]) {
         (y_start >> 8) & 0xFF,
         y_start & 0xFF,
         ((y_end - 1) >> 8) & 0xFF,
         (y_end - 1) & 0xFF,
-    }, 4);
+    }, !drv->window_valid);
+    drv->window_valid = true;
+    *cmd_list++ = LV_LCD_CMD_WRITE_MEMORY_START;
+    *cmd_list++ = 0;
+
     /* transfer frame buffer */
     size_t len = (x_end - x_start) * (y_end - y_start) * lv_color_format_get_size(lv_display_get_color_format(disp));
+    size_t cmd_list_size = cmd_list - drv->window_cmds;
+    if(drv->send_batch) {
+        drv->send_batch(disp, drv->window_cmds, cmd_list_size, px_map, len);
+        return;
+    }
+
+    for(size_t i = 0; i + 2 < cmd_list_size; i += 2 + drv->window_cmds[i + 1]) {
+        send_cmd(drv, drv->window_cmds[i], &drv->window_cmds[i + 2], drv->window_cmds[i + 1]);
+    }
     send_color(drv, LV_LCD_CMD_WRITE_MEMORY_START, px_map, len);
 }
 
+/**
+ * Add a window setup command to the command list of a flush unless its parameters are already set
+ * @param cmd_list      end of the command list
+ * @param cmd           command byte
+ * @param saved         parameters sent last time, updated to the new ones
+ * @param param         4 bytes of parameters
+ * @param force         true: add the command even if the parameters didn't change
+ * @return              new end of the command list
+ */
+static uint8_t * add_window_cmd(uint8_t * cmd_list, uint8_t cmd, uint8_t * saved, const uint8_t * param, bool force)
+{
+    if(!force && lv_memcmp(saved, param, 4) == 0) {
+        return cmd_list;
+    }
+
+    lv_memcpy(saved, param, 4);
+    *cmd_list++ = cmd;
+    *cmd_list++ = 4;
+    lv_memcpy(cmd_list, param, 4);
+    return cmd_list + 4;
+}
+
 /**
  * Set rotation taking into account the current mirror and swap settings
  * @param drv           LCD driver object
@@ -309,6 +357,7 @@ static void set_rotation(lv_lcd_generic_mipi_driver_t * drv, lv_display_rotation
     send_cmd(drv, LV_LCD_CMD_SET_ADDRESS_MODE, (uint8_t[]) {
         drv->madctl_reg
     }, 1);
+    drv->window_valid = false;
 }
 
 /**
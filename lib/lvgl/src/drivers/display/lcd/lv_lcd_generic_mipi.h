@@ -9,6 +9,7 @@
  * ST7789
  * ST7796
  * ILI9341
+ * GC9A01
  * ILI9488 (NOTE: in SPI mode ILI9488 only supports RGB666 mode, which is currently not supported)
  *
  * any probably many more
@@ -153,6 +154,20 @@ typedef void (*lv_lcd_send_cmd_cb_t)(lv_display_t * disp, const uint8_t * cmd, s
 typedef void (*lv_lcd_send_color_cb_t)(lv_display_t * disp, const uint8_t * cmd, size_t cmd_size, uint8_t * param,
                                        size_t param_size);
 
+/**
+ * Prototype of a platform-dependent callback to transfer the window setup commands and the pixel data of a flush
+ * to the LCD controller in one transaction (e.g. with the chip select kept active and chained DMA descriptors).
+ * Call `lv_display_flush_ready()` when the transfer is finished, the command list stays valid until then.
+ * @param disp          display object
+ * @param cmd_list      commands in the format of `lv_lcd_generic_mipi_send_cmd_list()` (command, number of parameters,
+ *                      parameters), the last one is `LV_LCD_CMD_WRITE_MEMORY_START` whose parameters are the pixels
+ * @param cmd_list_size number of bytes of the command list
+ * @param px_map        pixel data
+ * @param px_size       number of bytes of the pixel data
+ */
+typedef void (*lv_lcd_send_batch_cb_t)(lv_display_t * disp, const uint8_t * cmd_list, size_t cmd_list_size,
+                                       uint8_t * px_map, size_t px_size);
+
 /**
  * Generic MIPI compatible LCD driver
  */
@@ -160,6 +175,7 @@ typedef struct {
     lv_display_t      *     disp;          /* the associated LVGL display object */
     lv_lcd_send_cmd_cb_t    send_cmd;       /* platform-specific implementation to send a command to the LCD controller */
     lv_lcd_send_color_cb_t  send_color;     /* platform-specific implementation to send pixel data to the LCD controller */
+    lv_lcd_send_batch_cb_t  send_batch;     /* optional platform-specific implementation to send a whole flush in one transaction */
     uint16_t                x_gap;          /* x offset of the (0,0) pixel in VRAM */
     uint16_t                y_gap;          /* y offset of the (0,0) pixel in VRAM */
     uint8_t                 madctl_reg;     /* current value of MADCTL register */
@@ -167,6 +183,10 @@ typedef struct {
     bool                    mirror_x;
     bool                    mirror_y;
     bool                    swap_xy;
+    bool                    window_valid;   /* the column and page address below are set in the LCD controller */
+    uint8_t                 caset[4];       /* last column address sent */
+    uint8_t                 raset[4];       /* last page address sent */
+    uint8_t                 window_cmds[14]; /* command list of the current flush, kept until the transfer is finished */
 } lv_lcd_generic_mipi_driver_t;
 
 /**********************
@@ -185,6 +205,14 @@ typedef struct {
 lv_display_t * lv_lcd_generic_mipi_create(uint32_t hor_res, uint32_t ver_res, lv_lcd_flag_t flags,
                                           lv_lcd_send_cmd_cb_t send_cmd_cb, lv_lcd_send_color_cb_t send_color_cb);
 
+/**
+ * Send the window setup commands and the pixel data of each flush with one callback instead of
+ * 'send_cmd' and 'send_color', so that the platform can transfer them in one transaction
+ * @param disp          display object
+ * @param send_batch_cb platform-dependent function to send a flush (NULL to use 'send_cmd' and 'send_color' again)
+ */
+void lv_lcd_generic_mipi_set_send_batch_cb(lv_display_t * disp, lv_lcd_send_batch_cb_t send_batch_cb);
+
 /**
  * Set gap, i.e., the offset of the (0,0) pixel in the VRAM
  * @param disp          display object
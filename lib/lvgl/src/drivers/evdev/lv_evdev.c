@@ -13,11 +13,13 @@
 #include <fcntl.h>
 #include <errno.h>
 #include <string.h>
+#include <time.h>
 #include <sys/param.h> /*To detect BSD*/
 #ifdef BSD
     #include <dev/evdev/input.h>
 #else
     #include <linux/input.h>
+    #include <sys/epoll.h>
 #endif /*BSD*/
 #include "../../misc/lv_assert.h"
 #include "../../misc/lv_math.h"
@@ -43,6 +45,10 @@ typedef struct {
     int root_y;
     int key;
     lv_indev_state_t state;
+    lv_indev_state_t reported_state;
+    /*Statistics*/
+    clockid_t clock_id;
+    uint32_t latency_us;
 } lv_evdev_t;
 
 /**********************
@@ -108,15 +114,34 @@ static lv_point_t _evdev_process_pointer(lv_indev_t * indev, int x, int y)
     return p;
 }
 
+static uint64_t _evdev_event_time_us(const struct input_event * in)
+{
+#ifdef input_event_sec
+    return (uint64_t)in->input_event_sec * 1000000 + in->input_event_usec;
+#else
+    return (uint64_t)in->time.tv_sec * 1000000 + in->time.tv_usec;
+#endif
+}
+
 static void _evdev_read(lv_indev_t * indev, lv_indev_data_t * data)
 {
     lv_evdev_t * dsc = lv_indev_get_driver_data(indev);
     LV_ASSERT_NULL(dsc);
 
-    /*Update dsc with buffered events*/
+    /*Update dsc with buffered events. Motion is coalesced so only the last position of
+     *the batch is reported, but each press and release is reported on its own.*/
     struct input_event in = { 0 };
+    uint64_t oldest_us = 0;
     while(read(dsc->fd, &in, sizeof(in)) > 0) {
-        if(in.type == EV_REL) {
+        if(oldest_us == 0) oldest_us = _evdev_event_time_us(&in);
+
+        if(in.type == EV_SYN) {
+            if(in.code == SYN_REPORT && dsc->state != dsc->reported_state) {
+                data->continue_reading = true; /*Keep following events in buffer for now*/
+                break;
+            }
+        }
+        else if(in.type == EV_REL) {
             if(in.code == REL_X) dsc->root_x += in.value;
             else if(in.code == REL_Y) dsc->root_y += in.value;
         }
@@ -144,6 +169,15 @@ static void _evdev_read(lv_indev_t * indev, lv_indev_data_t * data)
         }
     }
 
+    if(oldest_us) {
+        struct timespec now;
+        clock_gettime(dsc->clock_id, &now);
+        uint64_t now_us = (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+        dsc->latency_us = now_us > oldest_us ? (uint32_t)LV_MIN(now_us - oldest_us, UINT32_MAX) : 0;
+    }
+
+    dsc->reported_state = dsc->state;
+
     /*Process and store in data*/
     switch(lv_indev_get_type(indev)) {
         case LV_INDEV_TYPE_KEYPAD:
@@ -164,22 +198,39 @@ static void _evdev_read(lv_indev_t * indev, lv_indev_data_t * data)
  **********************/
 
 lv_indev_t * lv_evdev_create(lv_indev_type_t indev_type, const char * dev_path)
+{
+    int fd = open(dev_path, O_RDONLY | O_NOCTTY | O_CLOEXEC);
+    if(fd < 0) {
+        LV_LOG_ERROR("open failed: %s", strerror(errno));
+        return NULL;
+    }
+
+    return lv_evdev_create_fd(indev_type, fd);
+}
+
+lv_indev_t * lv_evdev_create_fd(lv_indev_type_t indev_type, int fd)
 {
     lv_evdev_t * dsc = lv_malloc_zeroed(sizeof(lv_evdev_t));
     LV_ASSERT_MALLOC(dsc);
-    if(dsc == NULL) return NULL;
+    if(dsc == NULL) goto err_after_open;
 
-    dsc->fd = open(dev_path, O_RDONLY | O_NOCTTY | O_CLOEXEC);
-    if(dsc->fd < 0) {
-        LV_LOG_ERROR("open failed: %s", strerror(errno));
-        goto err_after_malloc;
-    }
+    dsc->fd = fd;
 
-    if(fcntl(dsc->fd, F_SETFL, O_NONBLOCK) < 0) {
+    int flags = fcntl(dsc->fd, F_GETFL);
+    if(flags < 0 || fcntl(dsc->fd, F_SETFL, flags | O_NONBLOCK) < 0) {
         LV_LOG_ERROR("fcntl failed: %s", strerror(errno));
-        goto err_after_open;
+        goto err_after_malloc;
     }
 
+    /* Ask for monotonic event timestamps to measure the latency. The kernel uses
+     * CLOCK_REALTIME by default, and other kind of files keep what the writer puts there. */
+    dsc->clock_id = CLOCK_MONOTONIC;
+#ifdef EVIOCSCLOCKID
+    if(ioctl(dsc->fd, EVIOCSCLOCKID, &dsc->clock_id) != 0) dsc->clock_id = CLOCK_REALTIME;
+#else
+    dsc->clock_id = CLOCK_REALTIME;
+#endif
+
     /* Detect the minimum and maximum values of the input device for calibration. */
 
     if(indev_type == LV_INDEV_TYPE_POINTER) {
@@ -201,19 +252,50 @@ lv_indev_t * lv_evdev_create(lv_indev_type_t indev_type, const char * dev_path)
     }
 
     lv_indev_t * indev = lv_indev_create();
-    if(indev == NULL) goto err_after_open;
+    if(indev == NULL) goto err_after_malloc;
     lv_indev_set_type(indev, indev_type);
     lv_indev_set_read_cb(indev, _evdev_read);
     lv_indev_set_driver_data(indev, dsc);
     return indev;
 
-err_after_open:
-    close(dsc->fd);
 err_after_malloc:
     lv_free(dsc);
+err_after_open:
+    close(fd);
     return NULL;
 }
 
+lv_result_t lv_evdev_set_epoll(lv_indev_t * indev, int epoll_fd)
+{
+    lv_evdev_t * dsc = lv_indev_get_driver_data(indev);
+    LV_ASSERT_NULL(dsc);
+
+#ifdef BSD
+    LV_UNUSED(epoll_fd);
+    LV_LOG_WARN("epoll is not available");
+    return LV_RESULT_INVALID;
+#else
+    /*Level triggered, so a batch left in the buffer after a press or release wakes up the loop again*/
+    struct epoll_event ev = { 0 };
+    ev.events = EPOLLIN;
+    ev.data.ptr = indev;
+    if(epoll_ctl(epoll_fd, EPOLL_CTL_ADD, dsc->fd, &ev) != 0) {
+        LV_LOG_ERROR("epoll_ctl failed: %s", strerror(errno));
+        return LV_RESULT_INVALID;
+    }
+
+    lv_indev_set_mode(indev, LV_INDEV_MODE_EVENT);
+    return LV_RESULT_OK;
+#endif /*BSD*/
+}
+
+uint32_t lv_evdev_get_latency(lv_indev_t * indev)
+{
+    lv_evdev_t * dsc = lv_indev_get_driver_data(indev);
+    LV_ASSERT_NULL(dsc);
+    return dsc->latency_us;
+}
+
 void lv_evdev_set_swap_axes(lv_indev_t * indev, bool swap_axes)
 {
     lv_evdev_t * dsc = lv_indev_get_driver_data(indev);
@@ -30,6 +30,32 @@ extern "C" {
  */
 lv_indev_t * lv_evdev_create(lv_indev_type_t indev_type, const char * dev_path);
 
+/**
+ * Create evdev input device from an already opened file.
+ * Any file delivering `struct input_event`s works, e.g. a pipe with synthetic events.
+ * @param type LV_INDEV_TYPE_POINTER or LV_INDEV_TYPE_KEYPAD
+ * @param fd file descriptor to read from. It's closed when the device is deleted or the creation fails.
+ * @return pointer to input device or NULL on error
+ */
+lv_indev_t * lv_evdev_create_fd(lv_indev_type_t indev_type, int fd);
+
+/**
+ * Add the device to an epoll set of the main loop and read it only when input is pending
+ * instead of polling it periodically. The events' `data.ptr` is set to `indev`;
+ * when `epoll_wait()` reports it, call `lv_indev_read(indev)`. Not available on BSD.
+ * @param indev evdev input device
+ * @param epoll_fd the epoll set created by `epoll_create1()`
+ * @return LV_RESULT_OK: the device was added and switched to event mode; LV_RESULT_INVALID: error
+ */
+lv_result_t lv_evdev_set_epoll(lv_indev_t * indev, int epoll_fd);
+
+/**
+ * Get the time the oldest event of the last read batch spent in the buffer before it was read.
+ * @param indev evdev input device
+ * @return the latency in microseconds
+ */
+uint32_t lv_evdev_get_latency(lv_indev_t * indev);
+
 /**
  * Set whether coordinates of pointer device should be swapped. Defaults to
  * false.
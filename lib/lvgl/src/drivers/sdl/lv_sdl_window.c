@@ -45,6 +45,10 @@ typedef struct {
     uint8_t * buf2;
     uint8_t * rotated_buf;
     size_t rotated_buf_size;
+    lv_area_t dirty_areas[LV_INV_BUF_SIZE];
+    uint32_t dirty_cnt;
+    uint64_t uploaded_bytes;
+    uint8_t dirty_full : 1;
 #endif
     uint8_t zoom;
     uint8_t ignore_size_chg;
@@ -59,6 +63,7 @@ static void window_create(lv_display_t * disp);
 static void window_update(lv_display_t * disp);
 #if LV_USE_DRAW_SDL == 0
     static void texture_resize(lv_display_t * disp);
+    static void texture_add_dirty_area(lv_sdl_window_t * dsc, const lv_area_t * area);
     static void * sdl_draw_buf_realloc_aligned(void * ptr, size_t new_size);
     static void sdl_draw_buf_free(void * ptr);
 #endif
@@ -186,6 +191,17 @@ void * lv_sdl_window_get_renderer(lv_display_t * disp)
     return dsc->renderer;
 }
 
+uint64_t lv_sdl_window_get_uploaded_bytes(lv_display_t * disp)
+{
+#if LV_USE_DRAW_SDL == 0
+    lv_sdl_window_t * dsc = lv_display_get_driver_data(disp);
+    return dsc->uploaded_bytes;
+#else
+    LV_UNUSED(disp);
+    return 0;
+#endif
+}
+
 void lv_sdl_quit(void)
 {
     if(inited) {
@@ -221,10 +237,11 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_m
             int32_t h = lv_area_get_height(area);
             uint32_t w_stride = lv_draw_buf_width_to_stride(w, cf);
             uint32_t h_stride = lv_draw_buf_width_to_stride(h, cf);
-            size_t buf_size = w * h * px_size;
+            size_t buf_size = LV_MAX(w_stride * h, h_stride * w);
 
-            /* (Re)allocate temporary buffer if needed */
-            if(!dsc->rotated_buf || dsc->rotated_buf_size != buf_size) {
+            /* Grow the temporary buffer if needed. The areas are flushed with various sizes
+             * so keep the largest instead of reallocating for each flush. */
+            if(!dsc->rotated_buf || dsc->rotated_buf_size < buf_size) {
                 dsc->rotated_buf = sdl_draw_buf_realloc_aligned(dsc->rotated_buf, buf_size);
                 dsc->rotated_buf_size = buf_size;
             }
@@ -266,6 +283,8 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_m
         }
     }
 
+    texture_add_dirty_area(dsc, area);
+
     /* TYPICALLY YOU DO NOT NEED THIS
      * If it was the last part to refresh update the texture of the window.*/
     if(lv_display_flush_is_last(disp)) {
@@ -376,9 +395,25 @@ static void window_update(lv_display_t * disp)
 {
     lv_sdl_window_t * dsc = lv_display_get_driver_data(disp);
 #if LV_USE_DRAW_SDL == 0
-    int32_t hor_res = disp->hor_res;
-    uint32_t stride = lv_draw_buf_width_to_stride(hor_res, lv_display_get_color_format(disp));
-    SDL_UpdateTexture(dsc->texture, NULL, dsc->fb_act, stride);
+    /*Upload only the areas flushed since the last update. The rest of the texture is still valid.*/
+    lv_color_format_t cf = lv_display_get_color_format(disp);
+    uint32_t px_size = lv_color_format_get_size(cf);
+    uint32_t stride = lv_draw_buf_width_to_stride(disp->hor_res, cf);
+    if(dsc->dirty_full) {
+        SDL_UpdateTexture(dsc->texture, NULL, dsc->fb_act, stride);
+        dsc->uploaded_bytes += (uint64_t)disp->hor_res * disp->ver_res * px_size;
+    }
+    else {
+        uint32_t i;
+        for(i = 0; i < dsc->dirty_cnt; i++) {
+            const lv_area_t * a = &dsc->dirty_areas[i];
+            SDL_Rect rect = {a->x1, a->y1, lv_area_get_width(a), lv_area_get_height(a)};
+            SDL_UpdateTexture(dsc->texture, &rect, dsc->fb_act + a->y1 * stride + a->x1 * px_size, stride);
+            dsc->uploaded_bytes += (uint64_t)rect.w * rect.h * px_size;
+        }
+    }
+    dsc->dirty_cnt = 0;
+    dsc->dirty_full = 0;
 
     SDL_RenderClear(dsc->renderer);
 
@@ -424,6 +459,36 @@ static void texture_resize(lv_display_t * disp)
     dsc->texture = SDL_CreateTexture(dsc->renderer, px_format,
                                      SDL_TEXTUREACCESS_STATIC, disp->hor_res, disp->ver_res);
     SDL_SetTextureBlendMode(dsc->texture, SDL_BLENDMODE_BLEND);
+
+    /*The new texture is empty so upload everything on the next update*/
+    dsc->dirty_full = 1;
+}
+
+/**
+ * Remember an area of the frame buffer which needs to be uploaded to the texture.
+ * The strips of a partially rendered area are merged back into one rectangle.
+ * @param dsc       the window descriptor
+ * @param area      the flushed area in texture coordinates
+ */
+static void texture_add_dirty_area(lv_sdl_window_t * dsc, const lv_area_t * area)
+{
+    if(dsc->dirty_full) return;
+
+    if(dsc->dirty_cnt > 0) {
+        lv_area_t * last = &dsc->dirty_areas[dsc->dirty_cnt - 1];
+        if(last->x1 == area->x1 && last->x2 == area->x2 && last->y2 + 1 == area->y1) {
+            last->y2 = area->y2;
+            return;
+        }
+    }
+
+    if(dsc->dirty_cnt < LV_INV_BUF_SIZE) {
+        dsc->dirty_areas[dsc->dirty_cnt] = *area;
+        dsc->dirty_cnt++;
+    }
+    else {
+        dsc->dirty_full = 1;
+    }
 }
 
 static void * sdl_draw_buf_realloc_aligned(void * ptr, size_t new_size)
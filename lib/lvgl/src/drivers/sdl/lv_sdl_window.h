@@ -47,6 +47,14 @@ void lv_sdl_window_set_title(lv_display_t * disp, const char * title);
 
 void * lv_sdl_window_get_renderer(lv_display_t * disp);
 
+/**
+ * Get the number of bytes uploaded to the window's texture so far.
+ * Only the areas flushed in a frame are uploaded, so it shows how much of the screen was redrawn.
+ * @param disp      pointer to a display created by `lv_sdl_window_create`
+ * @return          the uploaded bytes, or 0 if LV_USE_DRAW_SDL renders into the texture directly
+ */
+uint64_t lv_sdl_window_get_uploaded_bytes(lv_display_t * disp);
+
 void lv_sdl_quit(void);
 
 /**********************
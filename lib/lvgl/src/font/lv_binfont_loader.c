@@ -49,6 +49,12 @@ typedef struct font_header_bin {
     uint16_t underline_thickness;
 } font_header_bin_t;
 
+/*Allocated as the `dsc` of the font. The tables of the font can point into `map`*/
+typedef struct {
+    lv_font_fmt_txt_dsc_t dsc;  /*Must be the first member*/
+    lv_fs_map_t map;            /*Mapping of the whole font file, `data` is NULL if the file is not mapped*/
+} binfont_dsc_t;
+
 typedef struct cmap_table_bin {
     uint32_t data_offset;
     uint32_t range_start;
@@ -64,6 +70,10 @@ typedef struct cmap_table_bin {
  **********************/
 static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp);
 static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font);
+static const void * get_mapped(const lv_font_fmt_txt_dsc_t * font_dsc, uint32_t pos, uint32_t size, uint32_t align);
+static const void * read_mapped(lv_fs_file_t * fp, const lv_font_fmt_txt_dsc_t * font_dsc, uint32_t size,
+                                uint32_t align);
+static void free_table(const lv_font_fmt_txt_dsc_t * font_dsc, const void * table);
 int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start);
 
 static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
@@ -124,17 +134,17 @@ void lv_binfont_destroy(lv_font_t * font)
     if(dsc->kern_classes == 0) {
         const lv_font_fmt_txt_kern_pair_t * kern_dsc = dsc->kern_dsc;
         if(NULL != kern_dsc) {
-            lv_free((void *)kern_dsc->glyph_ids);
-            lv_free((void *)kern_dsc->values);
+            free_table(dsc, kern_dsc->glyph_ids);
+            free_table(dsc, kern_dsc->values);
             lv_free((void *)kern_dsc);
         }
     }
     else {
         const lv_font_fmt_txt_kern_classes_t * kern_dsc = dsc->kern_dsc;
         if(NULL != kern_dsc) {
-            lv_free((void *)kern_dsc->class_pair_values);
-            lv_free((void *)kern_dsc->left_class_mapping);
-            lv_free((void *)kern_dsc->right_class_mapping);
+            free_table(dsc, kern_dsc->class_pair_values);
+            free_table(dsc, kern_dsc->left_class_mapping);
+            free_table(dsc, kern_dsc->right_class_mapping);
             lv_free((void *)kern_dsc);
         }
     }
@@ -142,16 +152,20 @@ void lv_binfont_destroy(lv_font_t * font)
     const lv_font_fmt_txt_cmap_t * cmaps = dsc->cmaps;
     if(NULL != cmaps) {
         for(int i = 0; i < dsc->cmap_num; ++i) {
-            lv_free((void *)cmaps[i].glyph_id_ofs_list);
-            lv_free((void *)cmaps[i].unicode_list);
+            free_table(dsc, cmaps[i].glyph_id_ofs_list);
+            free_table(dsc, cmaps[i].unicode_list);
         }
         lv_free((void *)cmaps);
     }
 
-    lv_free((void *)dsc->glyph_bitmap);
+    free_table(dsc, dsc->glyph_bitmap);
     lv_free((void *)dsc->glyph_dsc);
+    lv_fs_unmap(&((binfont_dsc_t *)dsc)->map);
     lv_free((void *)dsc);
     lv_free(font);
+
+    /*Another font can be created at the same address*/
+    lv_text_layout_cache_drop_all();
 }
 
 /**********************
@@ -167,6 +181,42 @@ static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp)
     return it;
 }
 
+/*Get `size` bytes from `pos` of the mapped file. NULL if the file is not mapped or the data is not aligned*/
+static const void * get_mapped(const lv_font_fmt_txt_dsc_t * font_dsc, uint32_t pos, uint32_t size, uint32_t align)
+{
+    const lv_fs_map_t * map = &((const binfont_dsc_t *)font_dsc)->map;
+    if(map->data == NULL || pos > map->size || size > map->size - pos) return NULL;
+
+    const uint8_t * data = (const uint8_t *)map->data + pos;
+    if((lv_uintptr_t)data & (align - 1)) return NULL;
+
+    return data;
+}
+
+/*Like `get_mapped` from the current position of the file, which is moved after the data if it's mapped*/
+static const void * read_mapped(lv_fs_file_t * fp, const lv_font_fmt_txt_dsc_t * font_dsc, uint32_t size,
+                                uint32_t align)
+{
+    uint32_t pos;
+    if(((const binfont_dsc_t *)font_dsc)->map.data == NULL || lv_fs_tell(fp, &pos) != LV_FS_RES_OK) return NULL;
+
+    const void * data = get_mapped(font_dsc, pos, size, align);
+    if(data == NULL || lv_fs_seek(fp, pos + size, LV_FS_SEEK_SET) != LV_FS_RES_OK) return NULL;
+
+    return data;
+}
+
+/*Free a table unless it points into the mapped file*/
+static void free_table(const lv_font_fmt_txt_dsc_t * font_dsc, const void * table)
+{
+    const lv_fs_map_t * map = &((const binfont_dsc_t *)font_dsc)->map;
+    const uint8_t * p = table;
+    const uint8_t * data = map->data;
+    if(data && p >= data && p < data + map->size) return;
+
+    lv_free((void *)table);
+}
+
 static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res)
 {
     unsigned int value = 0;
@@ -238,6 +288,13 @@ static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_ds
         switch(cmap_table[i].format_type) {
             case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL: {
                     uint8_t ids_size = (uint8_t)(sizeof(uint8_t) * cmap_table[i].data_entries_count);
+                    const uint8_t * mapped = read_mapped(fp, font_dsc, ids_size, 1);
+                    if(mapped) {
+                        cmap->glyph_id_ofs_list = mapped;
+                        cmap->list_length = cmap->range_length;
+                        break;
+                    }
+
                     uint8_t * glyph_id_ofs_list = lv_malloc(ids_size);
 
                     cmap->glyph_id_ofs_list = glyph_id_ofs_list;
@@ -254,16 +311,29 @@ static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_ds
             case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
             case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY: {
                     uint32_t list_size = sizeof(uint16_t) * cmap_table[i].data_entries_count;
-                    uint16_t * unicode_list = (uint16_t *)lv_malloc(list_size);
-
-                    cmap->unicode_list = unicode_list;
                     cmap->list_length = cmap_table[i].data_entries_count;
 
-                    if(lv_fs_read(fp, unicode_list, list_size, NULL) != LV_FS_RES_OK) {
-                        return false;
+                    const uint16_t * mapped = read_mapped(fp, font_dsc, list_size, sizeof(uint16_t));
+                    if(mapped) {
+                        cmap->unicode_list = mapped;
+                    }
+                    else {
+                        uint16_t * unicode_list = (uint16_t *)lv_malloc(list_size);
+
+                        cmap->unicode_list = unicode_list;
+
+                        if(lv_fs_read(fp, unicode_list, list_size, NULL) != LV_FS_RES_OK) {
+                            return false;
+                        }
                     }
 
                     if(cmap_table[i].format_type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
+                        mapped = read_mapped(fp, font_dsc, sizeof(uint16_t) * cmap->list_length, sizeof(uint16_t));
+                        if(mapped) {
+                            cmap->glyph_id_ofs_list = mapped;
+                            break;
+                        }
+
                         uint16_t * buf = lv_malloc(sizeof(uint16_t) * cmap->list_length);
 
                         cmap->glyph_id_ofs_list = buf;
@@ -328,6 +398,18 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
 
     int cur_bmp_size = 0;
 
+    /*Byte aligned bitmaps are used from the mapped file directly if `bitmap_index` can address the whole table*/
+    const uint8_t * mapped_bmp = NULL;
+    int header_bits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
+#if LV_FONT_FMT_TXT_LARGE == 0
+    bool index_fits = (uint32_t)glyph_length < (1UL << 20);
+#else
+    bool index_fits = true;
+#endif
+    if(header_bits % 8 == 0 && index_fits) {
+        mapped_bmp = get_mapped(font_dsc, start, glyph_length, 1);
+    }
+
     for(unsigned int i = 0; i < loca_count; ++i) {
         lv_font_fmt_txt_glyph_dsc_t * gdsc = &glyph_dsc[i];
 
@@ -384,12 +466,22 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
             gdsc->ofs_y = 0;
         }
 
+        if(mapped_bmp) {
+            gdsc->bitmap_index = glyph_offset[i] + nbits / 8;
+            continue;
+        }
+
         gdsc->bitmap_index = cur_bmp_size;
         if(gdsc->box_w * gdsc->box_h != 0) {
             cur_bmp_size += bmp_size;
         }
     }
 
+    if(mapped_bmp) {
+        font_dsc->glyph_bitmap = mapped_bmp;
+        return glyph_length;
+    }
+
     uint8_t * glyph_bmp = (uint8_t *)lv_malloc(sizeof(uint8_t) * cur_bmp_size);
 
     font_dsc->glyph_bitmap = glyph_bmp;
@@ -458,13 +550,17 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
  */
 static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
 {
-    lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)
-                                       lv_malloc(sizeof(lv_font_fmt_txt_dsc_t));
+    binfont_dsc_t * binfont_dsc = lv_malloc_zeroed(sizeof(binfont_dsc_t));
+    LV_ASSERT_MALLOC(binfont_dsc);
+    if(binfont_dsc == NULL) return false;
 
-    lv_memset(font_dsc, 0, sizeof(lv_font_fmt_txt_dsc_t));
+    lv_font_fmt_txt_dsc_t * font_dsc = &binfont_dsc->dsc;
 
     font->dsc = font_dsc;
 
+    /*If the driver can map the file the tables which need no conversion are used from the mapping*/
+    lv_fs_map(fp, &binfont_dsc->map);
+
     /*header*/
     int32_t header_length = read_label(fp, 0, "head");
     if(header_length < 0) {
@@ -596,20 +692,25 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
             ids_size = sizeof(int16_t) * 2 * glyph_entries;
         }
 
-        uint8_t * glyph_ids = lv_malloc(ids_size);
-        int8_t * values = lv_malloc(glyph_entries);
-
         kern_pair->glyph_ids_size = format;
         kern_pair->pair_cnt = glyph_entries;
-        kern_pair->glyph_ids = glyph_ids;
-        kern_pair->values = values;
 
-        if(lv_fs_read(fp, glyph_ids, ids_size, NULL) != LV_FS_RES_OK) {
-            return -1;
+        kern_pair->glyph_ids = read_mapped(fp, font_dsc, ids_size, format == 0 ? 1 : sizeof(uint16_t));
+        if(kern_pair->glyph_ids == NULL) {
+            uint8_t * glyph_ids = lv_malloc(ids_size);
+            kern_pair->glyph_ids = glyph_ids;
+            if(lv_fs_read(fp, glyph_ids, ids_size, NULL) != LV_FS_RES_OK) {
+                return -1;
+            }
         }
 
-        if(lv_fs_read(fp, values, glyph_entries, NULL) != LV_FS_RES_OK) {
-            return -1;
+        kern_pair->values = read_mapped(fp, font_dsc, glyph_entries, 1);
+        if(kern_pair->values == NULL) {
+            int8_t * values = lv_malloc(glyph_entries);
+            kern_pair->values = values;
+            if(lv_fs_read(fp, values, glyph_entries, NULL) != LV_FS_RES_OK) {
+                return -1;
+            }
         }
     }
     else if(3 == kern_format_type) { /*array M*N of classes*/
@@ -633,20 +734,34 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
 
         int kern_values_length = sizeof(int8_t) * kern_table_rows * kern_table_cols;
 
-        uint8_t * kern_left = lv_malloc(kern_class_mapping_length);
-        uint8_t * kern_right = lv_malloc(kern_class_mapping_length);
-        int8_t * kern_values = lv_malloc(kern_values_length);
-
-        kern_classes->left_class_mapping  = kern_left;
-        kern_classes->right_class_mapping = kern_right;
         kern_classes->left_class_cnt = kern_table_rows;
         kern_classes->right_class_cnt = kern_table_cols;
-        kern_classes->class_pair_values = kern_values;
 
-        if(lv_fs_read(fp, kern_left, kern_class_mapping_length, NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, kern_right, kern_class_mapping_length, NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, kern_values, kern_values_length, NULL) != LV_FS_RES_OK) {
-            return -1;
+        uint32_t tables_pos;
+        const uint8_t * mapped = NULL;
+        if(lv_fs_tell(fp, &tables_pos) == LV_FS_RES_OK) {
+            mapped = get_mapped(font_dsc, tables_pos, 2 * kern_class_mapping_length + kern_values_length, 1);
+        }
+
+        if(mapped) {
+            kern_classes->left_class_mapping  = mapped;
+            kern_classes->right_class_mapping = mapped + kern_class_mapping_length;
+            kern_classes->class_pair_values = (const int8_t *)mapped + 2 * kern_class_mapping_length;
+        }
+        else {
+            uint8_t * kern_left = lv_malloc(kern_class_mapping_length);
+            uint8_t * kern_right = lv_malloc(kern_class_mapping_length);
+            int8_t * kern_values = lv_malloc(kern_values_length);
+
+            kern_classes->left_class_mapping  = kern_left;
+            kern_classes->right_class_mapping = kern_right;
+            kern_classes->class_pair_values = kern_values;
+
+            if(lv_fs_read(fp, kern_left, kern_class_mapping_length, NULL) != LV_FS_RES_OK ||
+               lv_fs_read(fp, kern_right, kern_class_mapping_length, NULL) != LV_FS_RES_OK ||
+               lv_fs_read(fp, kern_values, kern_values_length, NULL) != LV_FS_RES_OK) {
+                return -1;
+            }
         }
     }
     else {
@@ -10,6 +10,7 @@
 #include "lv_bin_decoder.h"
 #include "../../draw/lv_draw_image.h"
 #include "../../draw/lv_draw_buf.h"
+#include "../../draw/lv_draw_buf_private.h"
 #include "../../stdlib/lv_string.h"
 #include "../../stdlib/lv_sprintf.h"
 #include "../../libs/rle/lv_rle.h"
@@ -31,6 +32,12 @@
 
 #define image_cache_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->image_cache_draw_buf_handlers)
 
+#define COMPRESSED_HEADER_SIZE  12
+
+#if LV_BIN_DECODER_STREAM
+    #define STREAM_IN_BUF_SIZE  256  /*Window of compressed file data kept in RAM while streaming*/
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -47,6 +54,31 @@ typedef struct lv_image_compressed_t {
     const uint8_t * data; /*Compressed data*/
 } lv_image_compressed_t;
 
+#if LV_BIN_DECODER_STREAM
+/**
+ * Resumable state of the RLE decompressor. A copy is saved at the start of
+ * every row block so decompression can restart near any row.
+ */
+typedef struct {
+    uint32_t in_ofs;        /*Offset of the next unread byte in the compressed data*/
+    uint32_t run_left;      /*Bytes left to output from the current run*/
+    uint8_t px[4];          /*Block repeated by the current run*/
+    uint8_t literal;        /*1: the current run copies bytes from the input; 0: it repeats `px`*/
+} rle_state_t;
+
+typedef struct {
+    rle_state_t state;          /*Current position of the decompressor*/
+    int32_t row;                /*Row `state` will output next*/
+    rle_state_t * checkpoints;  /*State at the first row of each row block*/
+    uint32_t checkpoint_cnt;    /*Number of row blocks reached so far*/
+    uint8_t blk_size;           /*RLE block size in bytes*/
+    uint8_t * row_buf;          /*One decompressed row of the image*/
+    uint8_t * in_buf;           /*Window of the compressed data, only for files*/
+    uint32_t in_buf_ofs;        /*Offset of `in_buf` in the compressed data*/
+    uint32_t in_buf_len;        /*Number of valid bytes in `in_buf`*/
+} stream_data_t;
+#endif
+
 typedef struct {
     lv_fs_file_t * f;
     lv_color32_t * palette;
@@ -56,8 +88,20 @@ typedef struct {
     lv_draw_buf_t * decompressed;       /*Decompressed data could be used directly, thus must also be draw buf*/
     lv_draw_buf_t c_array;              /*An C-array image that need to be converted to a draw buf*/
     lv_draw_buf_t * decoded_partial;    /*A draw buf for decoded image via get_area_cb*/
+#if LV_BIN_DECODER_STREAM
+    stream_data_t * stream;             /*Row-block decompressor of a streamed compressed image*/
+#endif
 } decoder_data_t;
 
+/**
+ * A draw buf pointing into a mapped file. Destroying it releases the mapping,
+ * so the image cache can own it like a decoded image.
+ */
+typedef struct {
+    lv_draw_buf_t buf;                  /*Must be the first, `lv_draw_buf_destroy()` frees this struct*/
+    lv_fs_map_t map;
+} mapped_buf_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -72,15 +116,29 @@ static lv_result_t decode_alpha_only(lv_image_decoder_t * decoder, lv_image_deco
 static lv_result_t decode_indexed_line(lv_color_format_t color_format, const lv_color32_t * palette, int32_t x,
                                        int32_t w_px, const uint8_t * in, lv_color32_t * out);
 static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static lv_result_t map_file(lv_image_decoder_dsc_t * dsc);
+static void mapped_buf_free_cb(void * map);
 
 static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, void * buff, uint32_t btr, uint32_t * br);
 
 static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image_compressed_t * compressed);
 
+#if LV_BIN_DECODER_STREAM
+    static lv_result_t stream_open(lv_image_decoder_dsc_t * dsc);
+    static lv_result_t stream_get_area(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
+                                       lv_area_t * decoded_area);
+    static void stream_free(decoder_data_t * decoder_data);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
 
+/*Only free is needed: the pixels are never allocated or written*/
+static const lv_draw_buf_handlers_t mapped_buf_handlers = {
+    .buf_free_cb = mapped_buf_free_cb,
+};
+
 /**********************
  *      MACROS
  **********************/
@@ -215,8 +273,16 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
 
         lv_color_format_t cf = dsc->header.cf;
 
-        if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
+        if(map_file(dsc) == LV_RESULT_OK) {
+            res = LV_RESULT_OK; /*Cached like a decoded image, so the file is mapped only once*/
+        }
+        else if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
+#if LV_BIN_DECODER_STREAM
+            res = stream_open(dsc);
+            if(res != LV_RESULT_OK) res = decode_compressed(decoder, dsc);
+#else
             res = decode_compressed(decoder, dsc);
+#endif
         }
         else if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
             if(dsc->args.use_indexed) {
@@ -256,7 +322,12 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
 
         lv_color_format_t cf = image->header.cf;
         if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
+#if LV_BIN_DECODER_STREAM
+            res = stream_open(dsc);
+            if(res != LV_RESULT_OK) res = decode_compressed(decoder, dsc);
+#else
             res = decode_compressed(decoder, dsc);
+#endif
         }
         else if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
             /*Need decoder data to store converted image*/
@@ -348,7 +419,9 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
     lv_image_cache_data_t search_key;
     search_key.src_type = dsc->src_type;
     search_key.src = dsc->src;
-    search_key.slot.size = dsc->decoded->data_size;
+    /*A mapped image uses only its descriptor from the RAM, the pixels are in the page cache*/
+    search_key.slot.size = dsc->decoded->handlers == &mapped_buf_handlers ? sizeof(mapped_buf_t) :
+                           dsc->decoded->data_size;
 
     lv_cache_entry_t * cache_entry = lv_image_decoder_add_to_cache(decoder, &search_key, dsc->decoded, dsc->user_data);
     if(cache_entry == NULL) {
@@ -402,6 +475,10 @@ lv_result_t lv_bin_decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
         return LV_RESULT_INVALID;
     }
 
+#if LV_BIN_DECODER_STREAM
+    if(decoder_data->stream) return stream_get_area(dsc, full_area, decoded_area);
+#endif
+
     lv_fs_file_t * f = decoder_data->f;
     uint32_t bpp = lv_color_format_get_bpp(cf);
     int32_t w_px = lv_area_get_width(full_area);
@@ -546,6 +623,9 @@ static void free_decoder_data(lv_image_decoder_dsc_t * dsc)
 
     if(decoder_data->decoded) lv_draw_buf_destroy(decoder_data->decoded);
     if(decoder_data->decompressed) lv_draw_buf_destroy(decoder_data->decompressed);
+#if LV_BIN_DECODER_STREAM
+    stream_free(decoder_data);
+#endif
     lv_free(decoder_data->palette);
     lv_free(decoder_data);
     dsc->user_data = NULL;
@@ -766,6 +846,63 @@ static lv_result_t load_indexed(lv_image_decoder_t * decoder, lv_image_decoder_d
 #endif
 }
 
+/**
+ * Use the pixels of an uncompressed true color image directly from the mapped file.
+ * Only possible if the file system driver can map files.
+ * The draw buf is stored in `decoder_data->decoded`, so it's cached or destroyed like a decoded image.
+ */
+static lv_result_t map_file(lv_image_decoder_dsc_t * dsc)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    lv_color_format_t cf = dsc->header.cf;
+
+    if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) return LV_RESULT_INVALID;
+    if(cf != LV_COLOR_FORMAT_ARGB8888 && cf != LV_COLOR_FORMAT_XRGB8888 && cf != LV_COLOR_FORMAT_RGB888
+       && cf != LV_COLOR_FORMAT_RGB565 && cf != LV_COLOR_FORMAT_RGB565A8 && cf != LV_COLOR_FORMAT_ARGB8565) {
+        return LV_RESULT_INVALID;
+    }
+
+    mapped_buf_t * mapped = lv_malloc_zeroed(sizeof(mapped_buf_t));
+    if(mapped == NULL) return LV_RESULT_INVALID;
+
+    lv_fs_map_t * map = &mapped->map;
+    if(lv_fs_map(decoder_data->f, map) != LV_FS_RES_OK) {
+        lv_free(mapped);
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t len = dsc->header.stride * dsc->header.h;
+    if(cf == LV_COLOR_FORMAT_RGB565A8) {
+        len += (dsc->header.stride / 2) * dsc->header.h; /*A8 mask*/
+    }
+
+    const uint8_t * data = (const uint8_t *)map->data + sizeof(lv_image_header_t);
+    lv_draw_buf_t * decoded = &mapped->buf;
+    if(map->size < sizeof(lv_image_header_t) + len || ((lv_uintptr_t)data & (LV_DRAW_BUF_ALIGN - 1))
+       || lv_draw_buf_init(decoded, dsc->header.w, dsc->header.h, cf, dsc->header.stride, (void *)data,
+                           len) != LV_RESULT_OK) {
+        lv_fs_unmap(map);
+        lv_free(mapped);
+        return LV_RESULT_INVALID;
+    }
+
+    /*The mapping is read only, post processing needs to copy it.
+     *`lv_draw_buf_destroy()` passes `unaligned_data` to `mapped_buf_free_cb()`*/
+    decoded->header.flags = (dsc->header.flags & ~LV_IMAGE_FLAGS_MODIFIABLE) | LV_IMAGE_FLAGS_ALLOCATED;
+    decoded->handlers = &mapped_buf_handlers;
+    decoded->unaligned_data = map;
+
+    decoder_data->decoded = decoded;
+    dsc->decoded = decoded;
+
+    return LV_RESULT_OK;
+}
+
+static void mapped_buf_free_cb(void * map)
+{
+    lv_fs_unmap(map);
+}
+
 #if LV_BIN_DECODER_RAM_LOAD
 static lv_result_t decode_rgb(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
 {
@@ -915,10 +1052,10 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
         }
 
         compressed_len -= sizeof(lv_image_header_t);
-        compressed_len -= 12;
+        compressed_len -= COMPRESSED_HEADER_SIZE;
 
         /*Read compress header*/
-        len = 12;
+        len = COMPRESSED_HEADER_SIZE;
         fs_res = fs_read_file_at(f, sizeof(lv_image_header_t), compressed, len, &rn);
         if(fs_res != LV_FS_RES_OK || rn != len) {
             LV_LOG_WARN("Read compressed header failed: %d", fs_res);
@@ -951,9 +1088,13 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
     else if(dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
         lv_image_dsc_t * image = (lv_image_dsc_t *)dsc->src;
         compressed_len = image->data_size;
+        if(compressed_len < COMPRESSED_HEADER_SIZE) {
+            LV_LOG_WARN("Compressed image too short: %" LV_PRIu32, compressed_len);
+            return LV_RESULT_INVALID;
+        }
 
         /*Read compress header*/
-        len = 12;
+        len = COMPRESSED_HEADER_SIZE;
         compressed_len -= len;
         lv_memcpy(compressed, image->data, len);
         compressed->data = image->data + len;
@@ -1155,3 +1296,379 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
     decoder_data->decompressed = decompressed; /*Free on decoder close*/
     return LV_RESULT_OK;
 }
+
+#if LV_BIN_DECODER_STREAM
+
+/**
+ * Get a pointer to the compressed data at `ofs`.
+ * Variable images are read in place, files through a small window buffer.
+ * @param dsc       pointer to the decoder descriptor
+ * @param ofs       offset in the compressed data
+ * @param avail     store the number of bytes readable from the returned pointer
+ * @return          pointer to the data or NULL on error or end of data
+ */
+static const uint8_t * stream_input(lv_image_decoder_dsc_t * dsc, uint32_t ofs, uint32_t * avail)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    const lv_image_compressed_t * compressed = &decoder_data->compressed;
+    stream_data_t * stream = decoder_data->stream;
+
+    if(ofs >= compressed->compressed_size) return NULL;
+
+    if(compressed->data) {
+        *avail = compressed->compressed_size - ofs;
+        return compressed->data + ofs;
+    }
+
+    if(ofs < stream->in_buf_ofs || ofs >= stream->in_buf_ofs + stream->in_buf_len) {
+        uint32_t btr = LV_MIN(STREAM_IN_BUF_SIZE, compressed->compressed_size - ofs);
+        uint32_t br;
+        uint32_t pos = sizeof(lv_image_header_t) + COMPRESSED_HEADER_SIZE + ofs;
+        lv_fs_res_t res = fs_read_file_at(decoder_data->f, pos, stream->in_buf, btr, &br);
+        if(res != LV_FS_RES_OK || br != btr) {
+            LV_LOG_WARN("Read compressed data failed: %d", res);
+            stream->in_buf_len = 0;
+            return NULL;
+        }
+        stream->in_buf_ofs = ofs;
+        stream->in_buf_len = br;
+    }
+
+    *avail = stream->in_buf_ofs + stream->in_buf_len - ofs;
+    return stream->in_buf + (ofs - stream->in_buf_ofs);
+}
+
+/**
+ * Continue RLE decompression from the current state.
+ * @param dsc       pointer to the decoder descriptor
+ * @param out       store the decompressed bytes here, or NULL to skip them
+ * @param len       number of bytes to decompress
+ * @return          LV_RESULT_OK: no error; LV_RESULT_INVALID: corrupt or truncated data
+ */
+static lv_result_t stream_decompress(lv_image_decoder_dsc_t * dsc, uint8_t * out, uint32_t len)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    stream_data_t * stream = decoder_data->stream;
+    rle_state_t * state = &stream->state;
+    uint32_t blk_size = stream->blk_size;
+    const uint8_t * in;
+    uint32_t avail;
+
+    while(len) {
+        if(state->run_left == 0) {
+            in = stream_input(dsc, state->in_ofs, &avail);
+            if(in == NULL) return LV_RESULT_INVALID;
+
+            uint8_t ctrl_byte = in[0];
+            state->in_ofs++;
+            state->literal = (ctrl_byte & 0x80) ? 1 : 0;
+            state->run_left = blk_size * (ctrl_byte & 0x7f);
+
+            if(!state->literal) {
+                /*The repeated block follows the control byte*/
+                uint32_t i;
+                for(i = 0; i < blk_size; i++) {
+                    in = stream_input(dsc, state->in_ofs, &avail);
+                    if(in == NULL) return LV_RESULT_INVALID;
+                    state->px[i] = in[0];
+                    state->in_ofs++;
+                }
+            }
+            continue;
+        }
+
+        uint32_t n = LV_MIN(len, state->run_left);
+        if(state->literal) {
+            uint32_t copied = 0;
+            while(copied < n) {
+                in = stream_input(dsc, state->in_ofs, &avail);
+                if(in == NULL) return LV_RESULT_INVALID;
+
+                uint32_t chunk = LV_MIN(avail, n - copied);
+                if(out) lv_memcpy(out + copied, in, chunk);
+                state->in_ofs += chunk;
+                copied += chunk;
+            }
+        }
+        else if(out) {
+            if(blk_size == 1) {
+                lv_memset(out, state->px[0], n);
+            }
+            else {
+                /*A run may have been interrupted in the middle of a block at the end of a row*/
+                uint32_t phase = (blk_size - state->run_left % blk_size) % blk_size;
+                uint32_t i;
+                for(i = 0; i < n; i++) {
+                    out[i] = state->px[phase];
+                    phase++;
+                    if(phase == blk_size) phase = 0;
+                }
+            }
+        }
+
+        state->run_left -= n;
+        len -= n;
+        if(out) out += n;
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Decompress the next row and save a checkpoint if a new row block starts.
+ * @param dsc       pointer to the decoder descriptor
+ * @param out       store the row here, or NULL to skip it
+ * @return          LV_RESULT_OK: no error; LV_RESULT_INVALID: corrupt or truncated data
+ */
+static lv_result_t stream_decompress_row(lv_image_decoder_dsc_t * dsc, uint8_t * out)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    stream_data_t * stream = decoder_data->stream;
+
+    if(stream->row >= (int32_t)dsc->header.h) return LV_RESULT_INVALID;
+
+    uint32_t block = stream->row / LV_BIN_DECODER_STREAM_ROWS;
+    if(stream->row % LV_BIN_DECODER_STREAM_ROWS == 0 && block == stream->checkpoint_cnt) {
+        stream->checkpoints[block] = stream->state;
+        stream->checkpoint_cnt++;
+    }
+
+    if(stream_decompress(dsc, out, dsc->header.stride) != LV_RESULT_OK) return LV_RESULT_INVALID;
+
+    stream->row++;
+    return LV_RESULT_OK;
+}
+
+/**
+ * Move the decompressor to the start of a row.
+ * Restarts from the closest saved checkpoint if the row is behind the current position
+ * or a checkpoint is closer than it.
+ * @param dsc       pointer to the decoder descriptor
+ * @param row       the row to seek to
+ * @return          LV_RESULT_OK: no error; LV_RESULT_INVALID: corrupt or truncated data
+ */
+static lv_result_t stream_seek_row(lv_image_decoder_dsc_t * dsc, int32_t row)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    stream_data_t * stream = decoder_data->stream;
+
+    if(row == stream->row) return LV_RESULT_OK;
+
+    if(stream->checkpoint_cnt > 0) {
+        uint32_t block = row / LV_BIN_DECODER_STREAM_ROWS;
+        if(block >= stream->checkpoint_cnt) block = stream->checkpoint_cnt - 1;
+
+        int32_t block_row = block * LV_BIN_DECODER_STREAM_ROWS;
+        if(row < stream->row || block_row > stream->row) {
+            stream->state = stream->checkpoints[block];
+            stream->row = block_row;
+        }
+    }
+
+    while(stream->row < row) {
+        if(stream_decompress_row(dsc, NULL) != LV_RESULT_OK) return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Prepare a compressed image to be decompressed row block by row block in `get_area_cb`
+ * instead of into a full size buffer. Only RLE compressed images are supported
+ * as LZ4 needs the previously decompressed data as dictionary.
+ * @param dsc       pointer to the decoder descriptor
+ * @return          LV_RESULT_OK: the image will be streamed; LV_RESULT_INVALID: not supported
+ */
+static lv_result_t stream_open(lv_image_decoder_dsc_t * dsc)
+{
+    lv_color_format_t cf = dsc->header.cf;
+    bool supported = LV_COLOR_FORMAT_IS_INDEXED(cf)
+                     || cf == LV_COLOR_FORMAT_ARGB8888  \
+                     || cf == LV_COLOR_FORMAT_XRGB8888  \
+                     || cf == LV_COLOR_FORMAT_RGB888    \
+                     || cf == LV_COLOR_FORMAT_RGB565    \
+                     || cf == LV_COLOR_FORMAT_ARGB8565;
+    if(!supported || dsc->args.use_indexed) return LV_RESULT_INVALID;
+
+    decoder_data_t * decoder_data = get_decoder_data(dsc);
+    if(decoder_data == NULL) return LV_RESULT_INVALID;
+
+    lv_image_compressed_t * compressed = &decoder_data->compressed;
+    lv_memzero(compressed, sizeof(lv_image_compressed_t));
+
+    /*The compressed data is read in place later, so validate its size as `decode_compressed` does*/
+    uint32_t compressed_len;
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        lv_fs_file_t * f = decoder_data->f;
+        if(lv_fs_seek(f, 0, LV_FS_SEEK_END) != LV_FS_RES_OK ||
+           lv_fs_tell(f, &compressed_len) != LV_FS_RES_OK) {
+            LV_LOG_WARN("Failed to get compressed file len");
+            return LV_RESULT_INVALID;
+        }
+
+        if(compressed_len < sizeof(lv_image_header_t) + COMPRESSED_HEADER_SIZE) {
+            LV_LOG_WARN("Compressed file too short: %" LV_PRIu32, compressed_len);
+            return LV_RESULT_INVALID;
+        }
+        compressed_len -= sizeof(lv_image_header_t) + COMPRESSED_HEADER_SIZE;
+
+        uint32_t rn;
+        lv_fs_res_t fs_res = fs_read_file_at(f, sizeof(lv_image_header_t), compressed,
+                                             COMPRESSED_HEADER_SIZE, &rn);
+        if(fs_res != LV_FS_RES_OK || rn != COMPRESSED_HEADER_SIZE) {
+            LV_LOG_WARN("Read compressed header failed: %d", fs_res);
+            return LV_RESULT_INVALID;
+        }
+    }
+    else if(dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
+        const lv_image_dsc_t * image = dsc->src;
+        if(image->data_size < COMPRESSED_HEADER_SIZE) {
+            LV_LOG_WARN("Compressed image too short: %" LV_PRIu32, image->data_size);
+            return LV_RESULT_INVALID;
+        }
+        compressed_len = image->data_size - COMPRESSED_HEADER_SIZE;
+
+        lv_memcpy(compressed, image->data, COMPRESSED_HEADER_SIZE);
+        compressed->data = image->data + COMPRESSED_HEADER_SIZE; /*Read in place, e.g. from flash*/
+    }
+    else {
+        return LV_RESULT_INVALID;
+    }
+
+    if(compressed->compressed_size != compressed_len) {
+        LV_LOG_WARN("Compressed size mismatch: %" LV_PRIu32" != %" LV_PRIu32, compressed->compressed_size, compressed_len);
+        compressed->data = NULL;
+        return LV_RESULT_INVALID;
+    }
+
+    if(compressed->method != LV_IMAGE_COMPRESS_RLE) {
+        compressed->data = NULL;
+        return LV_RESULT_INVALID;
+    }
+
+#if LV_USE_RLE
+    uint32_t block_cnt = (dsc->header.h + LV_BIN_DECODER_STREAM_ROWS - 1) / LV_BIN_DECODER_STREAM_ROWS;
+    stream_data_t * stream = lv_malloc_zeroed(sizeof(stream_data_t));
+    if(stream == NULL) goto exit_with_err;
+    decoder_data->stream = stream; /*Now free_decoder_data will take care of it*/
+
+    stream->checkpoints = lv_malloc(block_cnt * sizeof(rle_state_t));
+    stream->row_buf = lv_malloc(dsc->header.stride);
+    if(stream->checkpoints == NULL || stream->row_buf == NULL) goto exit_with_err;
+
+    if(compressed->data == NULL) {
+        stream->in_buf = lv_malloc(STREAM_IN_BUF_SIZE);
+        if(stream->in_buf == NULL) goto exit_with_err;
+    }
+
+    /*Same block size as used by `decompress_image`*/
+    stream->blk_size = (lv_color_format_get_bpp(cf) + 7) >> 3;
+
+    if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
+        /*The palette is compressed together with the pixels, decompress it once*/
+        uint32_t palette_len = sizeof(lv_color32_t) * LV_COLOR_INDEXED_PALETTE_SIZE(cf);
+        decoder_data->palette = lv_malloc(palette_len);
+        if(decoder_data->palette == NULL) goto exit_with_err;
+
+        if(stream_decompress(dsc, (uint8_t *)decoder_data->palette, palette_len) != LV_RESULT_OK) {
+            LV_LOG_WARN("Decompress palette failed");
+            goto exit_with_err;
+        }
+
+        dsc->palette = decoder_data->palette;
+        dsc->palette_size = LV_COLOR_INDEXED_PALETTE_SIZE(cf);
+    }
+
+    return LV_RESULT_OK;
+
+exit_with_err:
+    LV_LOG_WARN("No memory to stream compressed image");
+    stream_free(decoder_data);
+    lv_free(decoder_data->palette);
+    decoder_data->palette = NULL;
+    compressed->data = NULL;
+    return LV_RESULT_INVALID;
+#else
+    compressed->data = NULL;
+    return LV_RESULT_INVALID;
+#endif
+}
+
+static lv_result_t stream_get_area(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
+                                   lv_area_t * decoded_area)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    stream_data_t * stream = decoder_data->stream;
+    lv_color_format_t cf = dsc->header.cf;
+    lv_color_format_t cf_decoded = LV_COLOR_FORMAT_IS_INDEXED(cf) ? LV_COLOR_FORMAT_ARGB8888 : cf;
+    uint32_t bpp = lv_color_format_get_bpp(cf);
+    int32_t w_px = lv_area_get_width(full_area);
+
+    if(decoded_area->y1 == LV_COORD_MIN) {
+        *decoded_area = *full_area;
+        decoded_area->y2 = full_area->y1 - 1;
+    }
+
+    /*Go on with the next row block*/
+    decoded_area->y1 = decoded_area->y2 + 1;
+    if(decoded_area->y1 > full_area->y2) return LV_RESULT_INVALID;
+    decoded_area->y2 = LV_MIN(decoded_area->y1 + LV_BIN_DECODER_STREAM_ROWS - 1, full_area->y2);
+    int32_t h_px = lv_area_get_height(decoded_area);
+
+    lv_draw_buf_t * decoded = lv_draw_buf_reshape(decoder_data->decoded_partial, cf_decoded, w_px, h_px,
+                                                  LV_STRIDE_AUTO);
+    if(decoded == NULL) {
+        if(decoder_data->decoded_partial != NULL) {
+            lv_draw_buf_destroy(decoder_data->decoded_partial);
+            decoder_data->decoded_partial = NULL;
+        }
+        decoded = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, w_px, LV_BIN_DECODER_STREAM_ROWS, cf_decoded,
+                                        LV_STRIDE_AUTO);
+        if(decoded == NULL) return LV_RESULT_INVALID;
+        decoder_data->decoded_partial = decoded; /*Free on decoder close*/
+        lv_draw_buf_reshape(decoded, cf_decoded, w_px, h_px, LV_STRIDE_AUTO);
+    }
+
+    if(stream_seek_row(dsc, decoded_area->y1) != LV_RESULT_OK) return LV_RESULT_INVALID;
+
+    /*Whole rows can be decompressed directly to the output*/
+    bool direct = !LV_COLOR_FORMAT_IS_INDEXED(cf) && decoded_area->x1 == 0 && w_px == (int32_t)dsc->header.w &&
+                  decoded->header.stride == dsc->header.stride;
+    uint8_t * out = decoded->data;
+    int32_t y;
+    for(y = 0; y < h_px; y++) {
+        if(direct) {
+            if(stream_decompress_row(dsc, out) != LV_RESULT_OK) return LV_RESULT_INVALID;
+        }
+        else {
+            if(stream_decompress_row(dsc, stream->row_buf) != LV_RESULT_OK) return LV_RESULT_INVALID;
+
+            const uint8_t * in = stream->row_buf + decoded_area->x1 * bpp / 8;
+            if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
+                int32_t x_fraction = decoded_area->x1 % (8 / bpp);
+                decode_indexed_line(cf, dsc->palette, x_fraction, w_px, in, (lv_color32_t *)out);
+            }
+            else {
+                lv_memcpy(out, in, w_px * bpp / 8);
+            }
+        }
+        out += decoded->header.stride;
+    }
+
+    dsc->decoded = decoded; /*Return decoded image*/
+    return LV_RESULT_OK;
+}
+
+static void stream_free(decoder_data_t * decoder_data)
+{
+    stream_data_t * stream = decoder_data->stream;
+    if(stream == NULL) return;
+
+    lv_free(stream->checkpoints);
+    lv_free(stream->row_buf);
+    lv_free(stream->in_buf);
+    lv_free(stream);
+    decoder_data->stream = NULL;
+}
+
+#endif /*LV_BIN_DECODER_STREAM*/
@@ -194,6 +194,9 @@ void lv_freetype_font_delete(lv_font_t * font)
     /* invalidate magic number */
     lv_memzero(dsc, sizeof(lv_freetype_font_dsc_t));
     lv_free(dsc);
+
+    /*Another font can be created at the same address*/
+    lv_text_layout_cache_drop_all();
 }
 
 lv_freetype_context_t * lv_freetype_get_context(void)
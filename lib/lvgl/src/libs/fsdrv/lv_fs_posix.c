@@ -16,6 +16,10 @@
 #include <dirent.h>
 #include <unistd.h>
 #include <errno.h>
+#if LV_FS_POSIX_MMAP
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
 #include "../../core/lv_global.h"
 
 /*********************
@@ -57,6 +61,10 @@ static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
 static void * fs_dir_open(lv_fs_drv_t * drv, const char * path);
 static lv_fs_res_t fs_dir_read(lv_fs_drv_t * drv, void * dir_p, char * fn, uint32_t fn_len);
 static lv_fs_res_t fs_dir_close(lv_fs_drv_t * drv, void * dir_p);
+#if LV_FS_POSIX_MMAP
+    static const void * fs_map(lv_fs_drv_t * drv, void * file_p, uint32_t * size);
+    static void fs_unmap(lv_fs_drv_t * drv, const void * data, uint32_t size);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -97,6 +105,11 @@ void lv_fs_posix_init(void)
     fs_drv_p->dir_open_cb = fs_dir_open;
     fs_drv_p->dir_read_cb = fs_dir_read;
 
+#if LV_FS_POSIX_MMAP
+    fs_drv_p->map_cb = fs_map;
+    fs_drv_p->unmap_cb = fs_unmap;
+#endif
+
     lv_fs_drv_register(fs_drv_p);
 }
 
@@ -332,6 +345,55 @@ static lv_fs_res_t fs_dir_close(lv_fs_drv_t * drv, void * dir_p)
 
     return LV_FS_RES_OK;
 }
+
+#if LV_FS_POSIX_MMAP
+/**
+ * Map a whole file read-only into the memory
+ * @param drv       pointer to a driver where this function belongs
+ * @param file_p    a file handle variable
+ * @param size      pointer to store the size of the file
+ * @return          pointer to the mapped content or NULL on error
+ */
+static const void * fs_map(lv_fs_drv_t * drv, void * file_p, uint32_t * size)
+{
+    LV_UNUSED(drv);
+
+    int fd = FILEP2FD(file_p);
+    struct stat st;
+    if(fstat(fd, &st) < 0) {
+        LV_LOG_WARN("Could not stat file: %d, errno: %d", fd, errno);
+        return NULL;
+    }
+
+    /*Empty files can't be mapped and lv_fs uses 32 bit sizes*/
+    if(st.st_size <= 0 || (uint64_t)st.st_size > UINT32_MAX) return NULL;
+
+    void * data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(data == MAP_FAILED) {
+        LV_LOG_WARN("Could not map file: %d, errno: %d", fd, errno);
+        return NULL;
+    }
+
+    *size = (uint32_t)st.st_size;
+    return data;
+}
+
+/**
+ * Release a mapping created by `fs_map`
+ * @param drv       pointer to a driver where this function belongs
+ * @param data      the mapped content
+ * @param size      size of the mapping
+ */
+static void fs_unmap(lv_fs_drv_t * drv, const void * data, uint32_t size)
+{
+    LV_UNUSED(drv);
+
+    if(munmap((void *)data, size) < 0) {
+        LV_LOG_WARN("Could not unmap file, errno: %d", errno);
+    }
+}
+#endif /*LV_FS_POSIX_MMAP*/
+
 #else /*LV_USE_FS_POSIX == 0*/
 
 #if defined(LV_FS_POSIX_LETTER) && LV_FS_POSIX_LETTER != '\0'
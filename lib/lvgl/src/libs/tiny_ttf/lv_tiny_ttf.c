@@ -10,6 +10,8 @@
 
 #if LV_USE_TINY_TTF != 0
 #include "../../core/lv_global.h"
+#include "../../misc/lv_rb_private.h"
+#include "../../misc/lv_text_private.h"
 
 #define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
 
@@ -69,6 +71,15 @@ typedef struct ttf_font_desc {
     int cache_size;
     lv_cache_t * glyph_cache;
     lv_cache_t * draw_data_cache;
+
+#if LV_TINY_TTF_ATLAS_SIZE > 0
+    struct _tiny_ttf_atlas_page_t * atlas[LV_TINY_TTF_ATLAS_PAGE_CNT];
+    uint32_t atlas_evict_next;      /*The page to clear when all pages are full*/
+    lv_mutex_t atlas_lock;
+#endif
+
+    uint32_t raster_cnt;            /*Glyphs rasterized by the per-glyph cache*/
+    lv_tiny_ttf_cache_stats_t stats;
 } ttf_font_desc_t;
 
 typedef struct _tiny_ttf_glyph_cache_data_t {
@@ -82,6 +93,21 @@ typedef struct lv_tiny_ttf_cache_data_t {
     uint32_t size;
     lv_draw_buf_t * draw_buf;
 } tiny_ttf_cache_data_t;
+
+#if LV_TINY_TTF_ATLAS_SIZE > 0
+typedef struct _tiny_ttf_atlas_page_t {
+    lv_draw_buf_t * draw_buf;       /*A8 texture the glyphs are packed into*/
+    stbrp_context packer;
+    stbrp_node nodes[LV_TINY_TTF_ATLAS_SIZE];
+    lv_rb_t glyphs;                 /*`tiny_ttf_atlas_glyph_t`s ordered by glyph index*/
+    uint32_t use_cnt;               /*Glyphs of the page being drawn. The page can't be cleared meanwhile.*/
+} tiny_ttf_atlas_page_t;
+
+typedef struct {
+    uint32_t glyph_index;
+    lv_draw_buf_t view;             /*The area of the glyph in the page, with the stride of the page*/
+} tiny_ttf_atlas_glyph_t;
+#endif
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -104,6 +130,23 @@ static lv_cache_compare_res_t tiny_ttf_draw_data_cache_compare_cb(const tiny_ttf
                                                                   const tiny_ttf_cache_data_t * rhs);
 
 static void lv_tiny_ttf_cache_create(ttf_font_desc_t * dsc);
+
+#if LV_TINY_TTF_ATLAS_SIZE > 0
+static const lv_draw_buf_t * atlas_get_glyph(ttf_font_desc_t * dsc, lv_font_glyph_dsc_t * g_dsc);
+static bool atlas_release_glyph(ttf_font_desc_t * dsc, lv_font_glyph_dsc_t * g_dsc);
+static bool atlas_init_rect(ttf_font_desc_t * dsc, uint32_t glyph_index, stbrp_rect * rect);
+static uint32_t atlas_pack(ttf_font_desc_t * dsc, stbrp_rect * rects, uint32_t rect_cnt, bool evict);
+static uint32_t atlas_fill_page(ttf_font_desc_t * dsc, tiny_ttf_atlas_page_t * page, stbrp_rect * rects,
+                                uint32_t rect_cnt);
+static tiny_ttf_atlas_glyph_t * atlas_find(ttf_font_desc_t * dsc, uint32_t glyph_index,
+                                           tiny_ttf_atlas_page_t ** page_out);
+static tiny_ttf_atlas_page_t * atlas_page_create(void);
+static void atlas_page_clear(tiny_ttf_atlas_page_t * page);
+static void atlas_clear(ttf_font_desc_t * dsc);
+static void atlas_destroy(ttf_font_desc_t * dsc);
+static lv_rb_compare_res_t atlas_glyph_compare_cb(const tiny_ttf_atlas_glyph_t * lhs,
+                                                  const tiny_ttf_atlas_glyph_t * rhs);
+#endif
 /**********************
  *  GLOBAL VARIABLES
  **********************/
@@ -146,6 +189,16 @@ void lv_tiny_ttf_set_size(lv_font_t * font, int32_t font_size)
     }
 
     lv_tiny_ttf_cache_create(dsc);
+
+#if LV_TINY_TTF_ATLAS_SIZE > 0
+    atlas_clear(dsc);
+#endif
+    uint32_t atlas_page_cnt = dsc->stats.atlas_page_cnt;
+    lv_memzero(&dsc->stats, sizeof(dsc->stats));
+    dsc->stats.atlas_page_cnt = atlas_page_cnt;
+
+    /*The glyph widths changed*/
+    lv_text_layout_cache_drop_all();
 }
 
 void lv_tiny_ttf_destroy(lv_font_t * font)
@@ -161,11 +214,86 @@ void lv_tiny_ttf_destroy(lv_font_t * font)
 #endif
         lv_cache_destroy(ttf->glyph_cache, NULL);
         lv_cache_destroy(ttf->draw_data_cache, NULL);
+#if LV_TINY_TTF_ATLAS_SIZE > 0
+        atlas_destroy(ttf);
+#endif
         lv_free(ttf);
         font->dsc = NULL;
     }
 
     lv_free(font);
+
+    /*Another font can be created at the same address*/
+    lv_text_layout_cache_drop_all();
+}
+
+uint32_t lv_tiny_ttf_prerender(lv_font_t * font, const char * chars)
+{
+    LV_ASSERT_NULL(font);
+    LV_ASSERT_NULL(chars);
+
+    ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
+    if(!dsc->cache_size) return 0;
+
+#if LV_TINY_TTF_ATLAS_SIZE > 0
+    /*Collect the new glyphs first to pack them in one batch, which wastes less space*/
+    stbrp_rect * rects = lv_malloc(lv_text_get_encoded_length(chars) * sizeof(stbrp_rect));
+    uint32_t rect_cnt = 0;
+    lv_mutex_lock(&dsc->atlas_lock);
+#endif
+
+    uint32_t render_cnt = 0;
+    uint32_t i = 0;
+    while(chars[i] != '\0') {
+        uint32_t letter = lv_text_encoded_next(chars, &i);
+        lv_font_glyph_dsc_t g;
+        if(!ttf_get_glyph_dsc_cb(font, &g, letter, 0) || g.box_w == 0 || g.box_h == 0) continue;
+
+        uint32_t glyph_index = g.gid.index;
+#if LV_TINY_TTF_ATLAS_SIZE > 0
+        tiny_ttf_atlas_page_t * page;
+        if(atlas_find(dsc, glyph_index, &page)) continue;
+
+        if(rects && atlas_init_rect(dsc, glyph_index, &rects[rect_cnt])) {
+            uint32_t r;
+            for(r = 0; r < rect_cnt; r++) {
+                if((uint32_t)rects[r].id == glyph_index) break;
+            }
+            if(r == rect_cnt) rect_cnt++;
+            continue;
+        }
+#endif
+
+        /*Too large for the atlas or no atlas at all*/
+        tiny_ttf_cache_data_t search_key = {
+            .glyph_index = glyph_index,
+            .size = font->line_height,
+        };
+        uint32_t raster_cnt = dsc->raster_cnt;
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(dsc->draw_data_cache, &search_key, dsc);
+        if(entry) {
+            lv_cache_release(dsc->draw_data_cache, entry, NULL);
+            if(dsc->raster_cnt != raster_cnt) render_cnt++;
+        }
+    }
+
+#if LV_TINY_TTF_ATLAS_SIZE > 0
+    render_cnt += rect_cnt - atlas_pack(dsc, rects, rect_cnt, false);
+    lv_mutex_unlock(&dsc->atlas_lock);
+    lv_free(rects);
+#endif
+
+    dsc->stats.prerender_cnt += render_cnt;
+    return render_cnt;
+}
+
+void lv_tiny_ttf_get_cache_stats(const lv_font_t * font, lv_tiny_ttf_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(font);
+    LV_ASSERT_NULL(stats);
+
+    const ttf_font_desc_t * dsc = (const ttf_font_desc_t *)font->dsc;
+    *stats = dsc->stats;
 }
 
 /**********************
@@ -292,14 +420,24 @@ static const void * ttf_get_glyph_bitmap_cb(lv_font_glyph_dsc_t * g_dsc, lv_draw
     uint32_t glyph_index = g_dsc->gid.index;
     const lv_font_t * font = g_dsc->resolved_font;
     ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
+
+#if LV_TINY_TTF_ATLAS_SIZE > 0
+    if(dsc->cache_size) {
+        const lv_draw_buf_t * glyph = atlas_get_glyph(dsc, g_dsc);
+        if(glyph) return glyph;
+    }
+#endif
+
     tiny_ttf_cache_data_t search_key = {
         .glyph_index = glyph_index,
         .size = font->line_height,
     };
 
+    uint32_t raster_cnt = dsc->raster_cnt;
     lv_cache_entry_t * entry = lv_cache_acquire_or_create(dsc->draw_data_cache, &search_key, (void *)font->dsc);
     if(entry == NULL) {
         if(!dsc->cache_size) {  /* no cache, do everything directly */
+            dsc->stats.miss_cnt++;
             if(tiny_ttf_draw_data_cache_create_cb(&search_key, (void *)font->dsc)) {
                 /* use the cache entry to store the buffer if no cache specified */
                 g_dsc->entry = (lv_cache_entry_t *)search_key.draw_buf;
@@ -313,6 +451,9 @@ static const void * ttf_get_glyph_bitmap_cb(lv_font_glyph_dsc_t * g_dsc, lv_draw
         return NULL;
     }
 
+    if(dsc->raster_cnt != raster_cnt) dsc->stats.miss_cnt++;
+    else dsc->stats.hit_cnt++;
+
     g_dsc->entry = entry;
     tiny_ttf_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
     return cached_data->draw_buf;
@@ -330,6 +471,11 @@ static void ttf_release_glyph_cb(const lv_font_t * font, lv_font_glyph_dsc_t * g
         if(g_dsc->entry == NULL) {
             return;
         }
+#if LV_TINY_TTF_ATLAS_SIZE > 0
+        if(atlas_release_glyph(dsc, g_dsc)) {
+            return;
+        }
+#endif
         lv_cache_release(dsc->draw_data_cache, g_dsc->entry, NULL);
     }
     g_dsc->entry = NULL;
@@ -397,9 +543,15 @@ static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size
 #endif
 
     dsc->cache_size = cache_size;
+#if LV_TINY_TTF_ATLAS_SIZE > 0
+    lv_mutex_init(&dsc->atlas_lock);
+#endif
 
     lv_font_t * out_font = lv_malloc_zeroed(sizeof(lv_font_t));
     if(out_font == NULL) {
+#if LV_TINY_TTF_ATLAS_SIZE > 0
+        lv_mutex_delete(&dsc->atlas_lock);
+#endif
         lv_free(dsc);
         LV_LOG_ERROR("tiny_ttf: out of memory");
         return NULL;
@@ -529,6 +681,7 @@ static bool tiny_ttf_draw_data_cache_create_cb(tiny_ttf_cache_data_t * node, voi
 
     uint32_t stride = draw_buf->header.stride;
     stbtt_MakeGlyphBitmap(info, draw_buf->data, w, h, stride, dsc->scale, dsc->scale, g1);
+    dsc->raster_cnt++;
 
     node->draw_buf = draw_buf;
     return true;
@@ -555,4 +708,236 @@ static lv_cache_compare_res_t tiny_ttf_draw_data_cache_compare_cb(const tiny_ttf
     return 0;
 }
 
+#if LV_TINY_TTF_ATLAS_SIZE > 0
+
+/*-----------------
+ * Glyph atlas
+ *----------------*/
+
+/*Get the glyph from the atlas, rasterize it into the atlas on a miss.
+ *NULL if the glyph doesn't fit into a page, the per-glyph cache should be used then.*/
+static const lv_draw_buf_t * atlas_get_glyph(ttf_font_desc_t * dsc, lv_font_glyph_dsc_t * g_dsc)
+{
+    uint32_t glyph_index = g_dsc->gid.index;
+    tiny_ttf_atlas_page_t * page = NULL;
+
+    lv_mutex_lock(&dsc->atlas_lock);
+    tiny_ttf_atlas_glyph_t * glyph = atlas_find(dsc, glyph_index, &page);
+    if(glyph) {
+        dsc->stats.hit_cnt++;
+    }
+    else {
+        stbrp_rect rect;
+        if(atlas_init_rect(dsc, glyph_index, &rect) && atlas_pack(dsc, &rect, 1, true) == 0) {
+            glyph = atlas_find(dsc, glyph_index, &page);
+            if(glyph) dsc->stats.miss_cnt++;
+        }
+    }
+
+    if(glyph) {
+        page->use_cnt++;
+        g_dsc->entry = (lv_cache_entry_t *)page;
+    }
+    lv_mutex_unlock(&dsc->atlas_lock);
+
+    return glyph ? &glyph->view : NULL;
+}
+
+/*Release a glyph returned by `atlas_get_glyph`. false if the glyph is not from the atlas*/
+static bool atlas_release_glyph(ttf_font_desc_t * dsc, lv_font_glyph_dsc_t * g_dsc)
+{
+    for(uint32_t i = 0; i < LV_TINY_TTF_ATLAS_PAGE_CNT; i++) {
+        tiny_ttf_atlas_page_t * page = dsc->atlas[i];
+        if(page == NULL || (lv_cache_entry_t *)page != g_dsc->entry) continue;
+
+        lv_mutex_lock(&dsc->atlas_lock);
+        page->use_cnt--;
+        lv_mutex_unlock(&dsc->atlas_lock);
+        g_dsc->entry = NULL;
+        return true;
+    }
+
+    return false;
+}
+
+/*Set the size of the glyph to pack. false if it has no bitmap or it's larger than a page*/
+static bool atlas_init_rect(ttf_font_desc_t * dsc, uint32_t glyph_index, stbrp_rect * rect)
+{
+    if(glyph_index == 0) return false;
+
+    int x1, y1, x2, y2;
+    stbtt_GetGlyphBitmapBox(&dsc->info, (int)glyph_index, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
+    int w = x2 - x1 + 1;
+    int h = y2 - y1 + 1;
+    if(w <= 0 || h <= 0 || w > LV_TINY_TTF_ATLAS_SIZE || h > LV_TINY_TTF_ATLAS_SIZE) return false;
+
+    lv_memzero(rect, sizeof(stbrp_rect));
+    rect->id = (int)glyph_index;
+    rect->w = w;
+    rect->h = h;
+    return true;
+}
+
+/*Pack the glyphs into the pages and rasterize them. If `evict` is set the oldest unused page
+ *is cleared when nothing else helps. Return the number of glyphs which didn't fit.*/
+static uint32_t atlas_pack(ttf_font_desc_t * dsc, stbrp_rect * rects, uint32_t rect_cnt, bool evict)
+{
+    for(uint32_t i = 0; i < LV_TINY_TTF_ATLAS_PAGE_CNT && rect_cnt > 0; i++) {
+        if(dsc->atlas[i] == NULL) {
+            dsc->atlas[i] = atlas_page_create();
+            if(dsc->atlas[i] == NULL) break;
+            dsc->stats.atlas_page_cnt++;
+        }
+        rect_cnt = atlas_fill_page(dsc, dsc->atlas[i], rects, rect_cnt);
+    }
+
+    if(!evict) return rect_cnt;
+
+    for(uint32_t k = 0; k < LV_TINY_TTF_ATLAS_PAGE_CNT && rect_cnt > 0; k++) {
+        uint32_t i = (dsc->atlas_evict_next + k) % LV_TINY_TTF_ATLAS_PAGE_CNT;
+        tiny_ttf_atlas_page_t * page = dsc->atlas[i];
+        if(page == NULL || page->use_cnt > 0) continue;
+
+        atlas_page_clear(page);
+        dsc->atlas_evict_next = (i + 1) % LV_TINY_TTF_ATLAS_PAGE_CNT;
+        dsc->stats.evict_cnt++;
+        rect_cnt = atlas_fill_page(dsc, page, rects, rect_cnt);
+    }
+
+    return rect_cnt;
+}
+
+/*Rasterize the glyphs fitting into the page and move the others to the beginning of `rects`.
+ *Return the number of glyphs which didn't fit.*/
+static uint32_t atlas_fill_page(ttf_font_desc_t * dsc, tiny_ttf_atlas_page_t * page, stbrp_rect * rects,
+                                uint32_t rect_cnt)
+{
+    stbrp_pack_rects(&page->packer, rects, (int)rect_cnt);
+
+    uint32_t stride = page->draw_buf->header.stride;
+    uint32_t left_cnt = 0;
+    for(uint32_t i = 0; i < rect_cnt; i++) {
+        const stbrp_rect * rect = &rects[i];
+        if(!rect->was_packed) {
+            rects[left_cnt++] = *rect;
+            continue;
+        }
+
+        tiny_ttf_atlas_glyph_t search_key = {
+            .glyph_index = (uint32_t)rect->id,
+        };
+        lv_rb_node_t * node = lv_rb_insert(&page->glyphs, &search_key);
+        if(node == NULL) {
+            LV_LOG_ERROR("tiny_ttf: out of memory");
+            continue;
+        }
+
+        uint8_t * data = page->draw_buf->data + rect->y * stride + rect->x;
+        stbtt_MakeGlyphBitmap(&dsc->info, data, rect->w, rect->h, (int)stride, dsc->scale, dsc->scale, rect->id);
+
+        /*Not `lv_draw_buf_init()` as the data of a glyph is usually not aligned*/
+        tiny_ttf_atlas_glyph_t * glyph = node->data;
+        lv_memzero(glyph, sizeof(tiny_ttf_atlas_glyph_t));
+        glyph->glyph_index = (uint32_t)rect->id;
+        glyph->view.header.magic = LV_IMAGE_HEADER_MAGIC;
+        glyph->view.header.cf = LV_COLOR_FORMAT_A8;
+        glyph->view.header.w = rect->w;
+        glyph->view.header.h = rect->h;
+        glyph->view.header.stride = stride;
+        glyph->view.data = data;
+        glyph->view.unaligned_data = data;
+        glyph->view.data_size = stride * (rect->h - 1) + rect->w;
+        glyph->view.handlers = page->draw_buf->handlers;
+    }
+
+    return left_cnt;
+}
+
+static tiny_ttf_atlas_glyph_t * atlas_find(ttf_font_desc_t * dsc, uint32_t glyph_index,
+                                           tiny_ttf_atlas_page_t ** page_out)
+{
+    tiny_ttf_atlas_glyph_t search_key = {
+        .glyph_index = glyph_index,
+    };
+
+    for(uint32_t i = 0; i < LV_TINY_TTF_ATLAS_PAGE_CNT; i++) {
+        tiny_ttf_atlas_page_t * page = dsc->atlas[i];
+        if(page == NULL) continue;
+
+        lv_rb_node_t * node = lv_rb_find(&page->glyphs, &search_key);
+        if(node) {
+            *page_out = page;
+            return node->data;
+        }
+    }
+
+    return NULL;
+}
+
+static tiny_ttf_atlas_page_t * atlas_page_create(void)
+{
+    tiny_ttf_atlas_page_t * page = lv_malloc_zeroed(sizeof(tiny_ttf_atlas_page_t));
+    if(page == NULL) {
+        LV_LOG_ERROR("tiny_ttf: out of memory");
+        return NULL;
+    }
+
+    page->draw_buf = lv_draw_buf_create_ex(font_draw_buf_handlers, LV_TINY_TTF_ATLAS_SIZE, LV_TINY_TTF_ATLAS_SIZE,
+                                           LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    if(page->draw_buf == NULL) {
+        LV_LOG_ERROR("tiny_ttf: out of memory");
+        lv_free(page);
+        return NULL;
+    }
+
+    lv_rb_init(&page->glyphs, (lv_rb_compare_t)atlas_glyph_compare_cb, sizeof(tiny_ttf_atlas_glyph_t));
+    atlas_page_clear(page);
+    return page;
+}
+
+static void atlas_page_clear(tiny_ttf_atlas_page_t * page)
+{
+    lv_rb_destroy(&page->glyphs);
+    lv_draw_buf_clear(page->draw_buf, NULL);
+    stbrp_init_target(&page->packer, LV_TINY_TTF_ATLAS_SIZE, LV_TINY_TTF_ATLAS_SIZE, page->nodes,
+                      LV_TINY_TTF_ATLAS_SIZE);
+}
+
+/*Drop all glyphs but keep the pages allocated*/
+static void atlas_clear(ttf_font_desc_t * dsc)
+{
+    lv_mutex_lock(&dsc->atlas_lock);
+    for(uint32_t i = 0; i < LV_TINY_TTF_ATLAS_PAGE_CNT; i++) {
+        if(dsc->atlas[i]) atlas_page_clear(dsc->atlas[i]);
+    }
+    dsc->atlas_evict_next = 0;
+    lv_mutex_unlock(&dsc->atlas_lock);
+}
+
+static void atlas_destroy(ttf_font_desc_t * dsc)
+{
+    for(uint32_t i = 0; i < LV_TINY_TTF_ATLAS_PAGE_CNT; i++) {
+        tiny_ttf_atlas_page_t * page = dsc->atlas[i];
+        if(page == NULL) continue;
+
+        lv_rb_destroy(&page->glyphs);
+        lv_draw_buf_destroy(page->draw_buf);
+        lv_free(page);
+        dsc->atlas[i] = NULL;
+    }
+    lv_mutex_delete(&dsc->atlas_lock);
+}
+
+static lv_rb_compare_res_t atlas_glyph_compare_cb(const tiny_ttf_atlas_glyph_t * lhs,
+                                                  const tiny_ttf_atlas_glyph_t * rhs)
+{
+    if(lhs->glyph_index != rhs->glyph_index) {
+        return lhs->glyph_index > rhs->glyph_index ? 1 : -1;
+    }
+
+    return 0;
+}
+
+#endif /*LV_TINY_TTF_ATLAS_SIZE > 0*/
+
 #endif
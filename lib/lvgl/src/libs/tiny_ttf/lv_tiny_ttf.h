@@ -25,6 +25,14 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    uint32_t hit_cnt;           /**< Glyph bitmaps found in the cache or the atlas while drawing */
+    uint32_t miss_cnt;          /**< Glyph bitmaps rasterized while drawing */
+    uint32_t prerender_cnt;     /**< Glyph bitmaps rasterized by `lv_tiny_ttf_prerender()` */
+    uint32_t evict_cnt;         /**< Atlas pages cleared to make room for new glyphs */
+    uint32_t atlas_page_cnt;    /**< Atlas pages currently allocated */
+} lv_tiny_ttf_cache_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -79,6 +87,24 @@ lv_font_t * lv_tiny_ttf_create_data_ex(const void * data, size_t data_size, int3
  */
 void lv_tiny_ttf_set_size(lv_font_t * font, int32_t font_size);
 
+/**
+ * Rasterize the glyphs of a set of characters in advance, e.g. the digits of a readout,
+ * so that drawing them later doesn't miss the cache.
+ * With an atlas (`LV_TINY_TTF_ATLAS_SIZE > 0`) the new glyphs are packed together in one batch.
+ * Does nothing if the font was created with 0 cache size.
+ * @param font        the font object
+ * @param chars       UTF-8 string with the characters to render
+ * @return            the number of glyphs rasterized
+ */
+uint32_t lv_tiny_ttf_prerender(lv_font_t * font, const char * chars);
+
+/**
+ * Get the glyph cache counters of a font. They are reset when the size of the font changes.
+ * @param font        the font object
+ * @param stats       store the counters here
+ */
+void lv_tiny_ttf_get_cache_stats(const lv_font_t * font, lv_tiny_ttf_cache_stats_t * stats);
+
 /**
  * Destroy a font previously created with lv_tiny_ttf_create_xxxx()
  * @param font        the font object
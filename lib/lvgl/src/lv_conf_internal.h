@@ -237,6 +237,16 @@
     #endif
 #endif
 
+/*1: In LV_DISPLAY_RENDER_MODE_DIRECT move the already rendered content of a scrolled object in the draw buffer
+ *and redraw only the newly visible strip instead of the whole object*/
+#ifndef LV_USE_SCROLL_BLIT
+    #ifdef CONFIG_LV_USE_SCROLL_BLIT
+        #define LV_USE_SCROLL_BLIT CONFIG_LV_USE_SCROLL_BLIT
+    #else
+        #define LV_USE_SCROLL_BLIT 0
+    #endif
+#endif
+
 /*=================
  * OPERATING SYSTEM
  *=================*/
@@ -538,6 +548,17 @@
                 #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
             #endif
         #endif
+
+        /* Draw the arcs with an analytic anti-aliased ring sector rasterizer instead of
+         * stacking an angle and two radius masks. Can be enabled for a single arc too
+         * by setting `analytic` in its `lv_draw_arc_dsc_t`*/
+        #ifndef LV_DRAW_SW_ARC_ANALYTIC
+            #ifdef CONFIG_LV_DRAW_SW_ARC_ANALYTIC
+                #define LV_DRAW_SW_ARC_ANALYTIC CONFIG_LV_DRAW_SW_ARC_ANALYTIC
+            #else
+                #define LV_DRAW_SW_ARC_ANALYTIC 0
+            #endif
+        #endif
     #endif
 
     #ifndef LV_USE_DRAW_SW_ASM
@@ -849,6 +870,30 @@
         #endif
     #endif
 
+    /*1: Don't format the logs when they are added but store them in binary form (level, timestamp,
+     *   address of the format string, function and file, and the arguments) in a ring buffer.
+     *   `lv_log_deferred_drain()` passes the records to a writer later and a host tool formats them.
+     *   The print callback and `LV_LOG_PRINTF` are not used then. With GCC and Clang the records are added
+     *   with atomics, without a lock, so any thread or interrupt can log. With other compilers and `LV_USE_OS`
+     *   they are added under `lv_lock()`, so don't log from interrupts there.*/
+    #ifndef LV_LOG_DEFERRED
+        #ifdef CONFIG_LV_LOG_DEFERRED
+            #define LV_LOG_DEFERRED CONFIG_LV_LOG_DEFERRED
+        #else
+            #define LV_LOG_DEFERRED 0
+        #endif
+    #endif
+    #if LV_LOG_DEFERRED
+        /*Size of the ring buffer of the log records in bytes. The records not fitting into it are dropped*/
+        #ifndef LV_LOG_DEFERRED_BUF_SIZE
+            #ifdef CONFIG_LV_LOG_DEFERRED_BUF_SIZE
+                #define LV_LOG_DEFERRED_BUF_SIZE CONFIG_LV_LOG_DEFERRED_BUF_SIZE
+            #else
+                #define LV_LOG_DEFERRED_BUF_SIZE 1024
+            #endif
+        #endif
+    #endif
+
 
     /*Enable/disable LV_LOG_TRACE in modules that produces a huge number of logs*/
     #ifndef LV_LOG_TRACE_MEM
@@ -1096,6 +1141,50 @@
     #endif
 #endif
 
+/*1: Evict images from the image cache by decode time per byte (GreedyDual-Size)
+ *   so that e.g. PNGs stay cached longer than binary images.
+ *   The decode time is measured with `lv_tick_get_us()`, set a microsecond clock with `lv_tick_set_us_cb()`.
+ *0: Evict the least recently used image*/
+#ifndef LV_IMAGE_CACHE_COST_AWARE
+    #ifdef CONFIG_LV_IMAGE_CACHE_COST_AWARE
+        #define LV_IMAGE_CACHE_COST_AWARE CONFIG_LV_IMAGE_CACHE_COST_AWARE
+    #else
+        #define LV_IMAGE_CACHE_COST_AWARE 0
+    #endif
+#endif
+
+/*Split the image and image header caches into this many independently locked shards
+ *so that draw threads using different images don't wait for each other.
+ *The cache size is split evenly, so an image larger than `LV_CACHE_DEF_SIZE / LV_IMAGE_CACHE_SHARD_CNT`
+ *can't be cached. 1: no sharding*/
+#ifndef LV_IMAGE_CACHE_SHARD_CNT
+    #ifdef CONFIG_LV_IMAGE_CACHE_SHARD_CNT
+        #define LV_IMAGE_CACHE_SHARD_CNT CONFIG_LV_IMAGE_CACHE_SHARD_CNT
+    #else
+        #define LV_IMAGE_CACHE_SHARD_CNT 1
+    #endif
+#endif
+
+/*Period in ms to log the hits, misses, evictions and decode time of the image caches. 0: disable*/
+#ifndef LV_CACHE_STATS_DUMP_PERIOD
+    #ifdef CONFIG_LV_CACHE_STATS_DUMP_PERIOD
+        #define LV_CACHE_STATS_DUMP_PERIOD CONFIG_LV_CACHE_STATS_DUMP_PERIOD
+    #else
+        #define LV_CACHE_STATS_DUMP_PERIOD 0
+    #endif
+#endif
+
+/*Number of texts whose line breaks and line widths are cached.
+ *Measuring and drawing a label reuse the same layout instead of walking the glyphs again.
+ *Only texts shorter than 512 bytes are cached. 0: disable*/
+#ifndef LV_TEXT_LAYOUT_CACHE_CNT
+    #ifdef CONFIG_LV_TEXT_LAYOUT_CACHE_CNT
+        #define LV_TEXT_LAYOUT_CACHE_CNT CONFIG_LV_TEXT_LAYOUT_CACHE_CNT
+    #else
+        #define LV_TEXT_LAYOUT_CACHE_CNT 0
+    #endif
+#endif
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -1125,6 +1214,26 @@
     #endif
 #endif
 
+/* Keep the memory of up to this many deleted objects per widget class and reuse it
+ * for new objects of the same class, e.g. when screens are destroyed and created again.
+ * 0: disable */
+#ifndef LV_OBJ_POOL_DEPTH
+    #ifdef CONFIG_LV_OBJ_POOL_DEPTH
+        #define LV_OBJ_POOL_DEPTH CONFIG_LV_OBJ_POOL_DEPTH
+    #else
+        #define LV_OBJ_POOL_DEPTH       0
+    #endif
+#endif
+
+/* Number of widget classes whose deleted objects can be kept */
+#ifndef LV_OBJ_POOL_CLASS_CNT
+    #ifdef CONFIG_LV_OBJ_POOL_CLASS_CNT
+        #define LV_OBJ_POOL_CLASS_CNT CONFIG_LV_OBJ_POOL_CLASS_CNT
+    #else
+        #define LV_OBJ_POOL_CLASS_CNT   8
+    #endif
+#endif
+
 /* Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -2434,6 +2543,13 @@
             #define LV_FS_POSIX_CACHE_SIZE 0    /*>0 to cache this number of bytes in lv_fs_read()*/
         #endif
     #endif
+    #ifndef LV_FS_POSIX_MMAP
+        #ifdef CONFIG_LV_FS_POSIX_MMAP
+            #define LV_FS_POSIX_MMAP CONFIG_LV_FS_POSIX_MMAP
+        #else
+            #define LV_FS_POSIX_MMAP 0          /*1: let the binary font and image loaders use mmap()ed files without copying*/
+        #endif
+    #endif
 #endif
 
 /*API for CreateFile, ReadFile, etc*/
@@ -2641,6 +2757,26 @@
     #endif
 #endif
 
+/*Decompress RLE compressed bin images row block by row block while drawing
+ *instead of into a full size buffer. Needs LV_USE_RLE*/
+#ifndef LV_BIN_DECODER_STREAM
+    #ifdef CONFIG_LV_BIN_DECODER_STREAM
+        #define LV_BIN_DECODER_STREAM CONFIG_LV_BIN_DECODER_STREAM
+    #else
+        #define LV_BIN_DECODER_STREAM 0
+    #endif
+#endif
+#if LV_BIN_DECODER_STREAM
+    /*Number of rows decompressed at once. A restart point is also saved at every row block*/
+    #ifndef LV_BIN_DECODER_STREAM_ROWS
+        #ifdef CONFIG_LV_BIN_DECODER_STREAM_ROWS
+            #define LV_BIN_DECODER_STREAM_ROWS CONFIG_LV_BIN_DECODER_STREAM_ROWS
+        #else
+            #define LV_BIN_DECODER_STREAM_ROWS 8
+        #endif
+    #endif
+#endif
+
 /*RLE decompress library*/
 #ifndef LV_USE_RLE
     #ifdef CONFIG_LV_USE_RLE
@@ -2721,6 +2857,23 @@
             #define LV_TINY_TTF_CACHE_GLYPH_CNT 256
         #endif
     #endif
+    /* >0: pack the rasterized glyphs into A8 atlas pages of this width and height in pixels
+     * instead of allocating a draw buffer for each glyph */
+    #ifndef LV_TINY_TTF_ATLAS_SIZE
+        #ifdef CONFIG_LV_TINY_TTF_ATLAS_SIZE
+            #define LV_TINY_TTF_ATLAS_SIZE CONFIG_LV_TINY_TTF_ATLAS_SIZE
+        #else
+            #define LV_TINY_TTF_ATLAS_SIZE 0
+        #endif
+    #endif
+    /* Maximum number of atlas pages of a font. If all are full the oldest one is cleared. */
+    #ifndef LV_TINY_TTF_ATLAS_PAGE_CNT
+        #ifdef CONFIG_LV_TINY_TTF_ATLAS_PAGE_CNT
+            #define LV_TINY_TTF_ATLAS_PAGE_CNT CONFIG_LV_TINY_TTF_ATLAS_PAGE_CNT
+        #else
+            #define LV_TINY_TTF_ATLAS_PAGE_CNT 4
+        #endif
+    #endif
 #endif
 
 /*Rlottie library*/
@@ -2911,6 +3064,46 @@
         #endif
     #endif
 
+    /*1: Enable the binary profiler. It records fixed size events into a lock-free ring buffer
+     *per thread. Use it by setting the macros below to `LV_PROFILER_BIN_...` and
+     *LV_PROFILER_INCLUDE to "lvgl/src/misc/lv_profiler_bin.h".
+     *Convert the output of `lv_profiler_bin_dump()` with `scripts/trace_bin2json.py`*/
+    #ifndef LV_USE_PROFILER_BIN
+        #ifdef CONFIG_LV_USE_PROFILER_BIN
+            #define LV_USE_PROFILER_BIN CONFIG_LV_USE_PROFILER_BIN
+        #else
+            #define LV_USE_PROFILER_BIN 0
+        #endif
+    #endif
+    #if LV_USE_PROFILER_BIN
+        /*Trace buffer size of each thread*/
+        #ifndef LV_PROFILER_BIN_BUF_SIZE
+            #ifdef CONFIG_LV_PROFILER_BIN_BUF_SIZE
+                #define LV_PROFILER_BIN_BUF_SIZE CONFIG_LV_PROFILER_BIN_BUF_SIZE
+            #else
+                #define LV_PROFILER_BIN_BUF_SIZE (16 * 1024)     /*[bytes]*/
+            #endif
+        #endif
+
+        /*Maximum number of threads which can record events*/
+        #ifndef LV_PROFILER_BIN_THREAD_MAX
+            #ifdef CONFIG_LV_PROFILER_BIN_THREAD_MAX
+                #define LV_PROFILER_BIN_THREAD_MAX CONFIG_LV_PROFILER_BIN_THREAD_MAX
+            #else
+                #define LV_PROFILER_BIN_THREAD_MAX 4
+            #endif
+        #endif
+
+        /*Maximum number of different tags. Must be a power of 2*/
+        #ifndef LV_PROFILER_BIN_TAG_MAX
+            #ifdef CONFIG_LV_PROFILER_BIN_TAG_MAX
+                #define LV_PROFILER_BIN_TAG_MAX CONFIG_LV_PROFILER_BIN_TAG_MAX
+            #else
+                #define LV_PROFILER_BIN_TAG_MAX 256
+            #endif
+        #endif
+    #endif
+
     /*Header to include for the profiler*/
     #ifndef LV_PROFILER_INCLUDE
         #ifdef CONFIG_LV_PROFILER_INCLUDE
@@ -3292,6 +3485,16 @@
             #define LV_LINUX_FBDEV_BUFFER_SIZE   60
         #endif
     #endif
+    /*Render directly into two halves of the framebuffer and flip between them by panning instead of copying.
+     *Needs a driver supporting a virtual resolution twice the screen height. Falls back to copying otherwise.
+     *Works with LV_DISPLAY_RENDER_MODE_DIRECT and LV_DISPLAY_RENDER_MODE_FULL. Not supported with LV_LINUX_FBDEV_BSD*/
+    #ifndef LV_LINUX_FBDEV_PAGE_FLIP
+        #ifdef CONFIG_LV_LINUX_FBDEV_PAGE_FLIP
+            #define LV_LINUX_FBDEV_PAGE_FLIP CONFIG_LV_LINUX_FBDEV_PAGE_FLIP
+        #else
+            #define LV_LINUX_FBDEV_PAGE_FLIP     0
+        #endif
+    #endif
 #endif
 
 /*Use Nuttx to open window and handle touchscreen*/
@@ -3451,12 +3654,19 @@
         #define LV_USE_ILI9341       0
     #endif
 #endif
+#ifndef LV_USE_GC9A01
+    #ifdef CONFIG_LV_USE_GC9A01
+        #define LV_USE_GC9A01 CONFIG_LV_USE_GC9A01
+    #else
+        #define LV_USE_GC9A01        0
+    #endif
+#endif
 
 #ifndef LV_USE_GENERIC_MIPI
     #ifdef CONFIG_LV_USE_GENERIC_MIPI
         #define LV_USE_GENERIC_MIPI CONFIG_LV_USE_GENERIC_MIPI
     #else
-        #define LV_USE_GENERIC_MIPI (LV_USE_ST7735 | LV_USE_ST7789 | LV_USE_ST7796 | LV_USE_ILI9341)
+        #define LV_USE_GENERIC_MIPI (LV_USE_ST7735 | LV_USE_ST7789 | LV_USE_ST7796 | LV_USE_ILI9341 | LV_USE_GC9A01)
     #endif
 #endif
 
@@ -7,8 +7,10 @@
  *      INCLUDES
  *********************/
 #include "others/sysmon/lv_sysmon_private.h"
+#include "others/observer/lv_observer_private.h"
 #include "misc/lv_timer_private.h"
 #include "misc/lv_profiler_builtin_private.h"
+#include "misc/lv_profiler_bin_private.h"
 #include "misc/lv_anim_private.h"
 #include "draw/lv_image_decoder_private.h"
 #include "draw/lv_draw_buf_private.h"
@@ -38,6 +40,7 @@
 #include "widgets/span/lv_span.h"
 #include "themes/simple/lv_theme_simple.h"
 #include "misc/lv_fs.h"
+#include "misc/cache/lv_text_layout_cache.h"
 #include "osal/lv_os_private.h"
 
 #if LV_USE_DRAW_VGLITE
@@ -178,6 +181,12 @@ void lv_init(void)
     lv_profiler_builtin_init(&profiler_config);
 #endif
 
+#if LV_USE_PROFILER && LV_USE_PROFILER_BIN
+    lv_profiler_bin_config_t profiler_bin_config;
+    lv_profiler_bin_config_init(&profiler_bin_config);
+    lv_profiler_bin_init(&profiler_bin_config);
+#endif
+
     lv_os_init();
 
     lv_timer_core_init();
@@ -188,8 +197,14 @@ void lv_init(void)
 
     lv_anim_core_init();
 
+#if LV_USE_OBSERVER
+    lv_observer_core_init();
+#endif
+
     lv_group_init();
 
+    lv_text_layout_cache_init(LV_TEXT_LAYOUT_CACHE_CNT);
+
     lv_draw_init();
 
 #if LV_USE_DRAW_SW
@@ -385,6 +400,10 @@ void lv_deinit(void)
 
     lv_image_decoder_deinit();
 
+    lv_text_layout_cache_deinit();
+
+    lv_obj_class_pool_flush();
+
     lv_refr_deinit();
 
     lv_obj_style_deinit();
@@ -413,6 +432,10 @@ void lv_deinit(void)
 
     lv_anim_core_deinit();
 
+#if LV_USE_OBSERVER
+    lv_observer_core_deinit();
+#endif
+
     lv_layout_deinit();
 
     lv_fs_deinit();
@@ -423,6 +446,10 @@ void lv_deinit(void)
     lv_profiler_builtin_uninit();
 #endif
 
+#if LV_USE_PROFILER && LV_USE_PROFILER_BIN
+    lv_profiler_bin_uninit();
+#endif
+
 #if LV_USE_OBJ_ID && LV_USE_OBJ_ID_BUILTIN
     lv_objid_builtin_destroy();
 #endif
@@ -20,6 +20,8 @@ extern "C" {
 #include "misc/lv_text_private.h"
 #include "misc/cache/lv_cache_entry_private.h"
 #include "misc/cache/lv_cache_private.h"
+#include "misc/cache/lv_image_cache_private.h"
+#include "misc/cache/lv_text_layout_cache_private.h"
 #include "layouts/lv_layout_private.h"
 #include "stdlib/lv_mem_private.h"
 #include "others/file_explorer/lv_file_explorer_private.h"
@@ -60,6 +62,7 @@ extern "C" {
 #include "misc/lv_area_private.h"
 #include "misc/lv_fs_private.h"
 #include "misc/lv_profiler_builtin_private.h"
+#include "misc/lv_profiler_bin_private.h"
 #include "misc/lv_event_private.h"
 #include "misc/lv_bidi_private.h"
 #include "misc/lv_rb_private.h"
@@ -8,6 +8,7 @@
  *********************/
 #include "lv_cache.h"
 #include "../../stdlib/lv_sprintf.h"
+#include "../../stdlib/lv_string.h"
 #include "../lv_assert.h"
 #include "lv_cache_entry_private.h"
 
@@ -25,6 +26,7 @@
 static void cache_drop_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
 static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_data);
 static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
+static inline lv_cache_t * get_shard(lv_cache_t * cache, const void * key);
 /**********************
  *  GLOBAL VARIABLES
  **********************/
@@ -53,6 +55,10 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
     cache->max_size = max_size;
     cache->size = 0;
     cache->ops = ops;
+    lv_memzero(&cache->stats, sizeof(cache->stats));
+    cache->shards = NULL;
+    cache->shard_cnt = 0;
+    cache->hash_cb = NULL;
 
     if(cache->clz->init_cb(cache) == false) {
         LV_LOG_ERROR("Cache init failed");
@@ -65,10 +71,60 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
     return cache;
 }
 
+lv_cache_t * lv_cache_create_sharded(const lv_cache_class_t * cache_class,
+                                     size_t node_size, size_t max_size,
+                                     lv_cache_ops_t ops, lv_cache_hash_cb_t hash_cb, uint32_t shard_cnt)
+{
+    LV_ASSERT_NULL(hash_cb);
+    LV_ASSERT(shard_cnt > 0);
+
+    if(shard_cnt <= 1) return lv_cache_create(cache_class, node_size, max_size, ops);
+
+    lv_cache_t * cache = lv_malloc_zeroed(sizeof(lv_cache_t));
+    LV_ASSERT_MALLOC(cache);
+    if(cache == NULL) return NULL;
+
+    cache->shards = lv_malloc_zeroed(shard_cnt * sizeof(lv_cache_t *));
+    LV_ASSERT_MALLOC(cache->shards);
+    if(cache->shards == NULL) {
+        lv_free(cache);
+        return NULL;
+    }
+
+    cache->clz = cache_class;
+    cache->node_size = node_size;
+    cache->max_size = max_size;
+    cache->ops = ops;
+    cache->shard_cnt = shard_cnt;
+    cache->hash_cb = hash_cb;
+
+    uint32_t i;
+    for(i = 0; i < shard_cnt; i++) {
+        cache->shards[i] = lv_cache_create(cache_class, node_size, max_size / shard_cnt, ops);
+        if(cache->shards[i] == NULL) {
+            LV_LOG_ERROR("Cache shard init failed");
+            lv_cache_destroy(cache, NULL);
+            return NULL;
+        }
+    }
+
+    return cache;
+}
+
 void lv_cache_destroy(lv_cache_t * cache, void * user_data)
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards) {
+        uint32_t i;
+        for(i = 0; i < cache->shard_cnt; i++) {
+            if(cache->shards[i]) lv_cache_destroy(cache->shards[i], user_data);
+        }
+        lv_free(cache->shards);
+        lv_free(cache);
+        return;
+    }
+
     lv_mutex_lock(&cache->lock);
     cache->clz->destroy_cb(cache, user_data);
     lv_mutex_unlock(&cache->lock);
@@ -81,11 +137,14 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    cache = get_shard(cache, key);
+
     LV_PROFILER_BEGIN;
 
     lv_mutex_lock(&cache->lock);
 
     if(cache->size == 0) {
+        cache->stats.miss_cnt++;
         lv_mutex_unlock(&cache->lock);
 
         LV_PROFILER_END;
@@ -95,6 +154,10 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     lv_cache_entry_t * entry = cache->clz->get_cb(cache, key, user_data);
     if(entry != NULL) {
         lv_cache_entry_acquire_data(entry);
+        cache->stats.hit_cnt++;
+    }
+    else {
+        cache->stats.miss_cnt++;
     }
     lv_mutex_unlock(&cache->lock);
 
@@ -105,6 +168,9 @@ void lv_cache_release(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_
 {
     LV_ASSERT_NULL(entry);
 
+    /*The entry is protected by the lock of the shard it belongs to*/
+    if(cache->shards) cache = (lv_cache_t *)lv_cache_entry_get_cache(entry);
+
     LV_PROFILER_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -123,6 +189,8 @@ lv_cache_entry_t * lv_cache_add(lv_cache_t * cache, const void * key, void * use
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    cache = get_shard(cache, key);
+
     LV_PROFILER_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -147,6 +215,8 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    cache = get_shard(cache, key);
+
     LV_PROFILER_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -156,6 +226,7 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
         entry = cache->clz->get_cb(cache, key, user_data);
         if(entry != NULL) {
             lv_cache_entry_acquire_data(entry);
+            cache->stats.hit_cnt++;
             lv_mutex_unlock(&cache->lock);
 
             LV_PROFILER_END;
@@ -163,6 +234,8 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
         }
     }
 
+    cache->stats.miss_cnt++;
+
     if(cache->max_size == 0) {
         lv_mutex_unlock(&cache->lock);
 
@@ -195,6 +268,14 @@ void lv_cache_reserve(lv_cache_t * cache, uint32_t reserved_size, void * user_da
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards) {
+        uint32_t i;
+        for(i = 0; i < cache->shard_cnt; i++) {
+            lv_cache_reserve(cache->shards[i], reserved_size / cache->shard_cnt, user_data);
+        }
+        return;
+    }
+
     LV_PROFILER_BEGIN;
 
     for(lv_cache_reserve_cond_res_t reserve_cond_res = cache->clz->reserve_cond_cb(cache, NULL, reserved_size, user_data);
@@ -209,6 +290,8 @@ void lv_cache_drop(lv_cache_t * cache, const void * key, void * user_data)
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    cache = get_shard(cache, key);
+
     LV_PROFILER_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -221,6 +304,23 @@ bool lv_cache_evict_one(lv_cache_t * cache, void * user_data)
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards) {
+        /*Start with the fullest shard. The sizes are read without the locks, so it's only a hint.
+         *Each shard is evicted under its own lock and if nothing can be evicted there
+         *(e.g. all its entries are in use) the next shards are tried.*/
+        uint32_t fullest = 0;
+        uint32_t i;
+        for(i = 1; i < cache->shard_cnt; i++) {
+            if(cache->shards[i]->size > cache->shards[fullest]->size) fullest = i;
+        }
+
+        for(i = 0; i < cache->shard_cnt; i++) {
+            lv_cache_t * shard = cache->shards[(fullest + i) % cache->shard_cnt];
+            if(lv_cache_evict_one(shard, user_data)) return true;
+        }
+        return false;
+    }
+
     LV_PROFILER_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -234,6 +334,14 @@ void lv_cache_drop_all(lv_cache_t * cache, void * user_data)
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards) {
+        uint32_t i;
+        for(i = 0; i < cache->shard_cnt; i++) {
+            lv_cache_drop_all(cache->shards[i], user_data);
+        }
+        return;
+    }
+
     LV_PROFILER_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -247,6 +355,11 @@ void lv_cache_set_max_size(lv_cache_t * cache, size_t max_size, void * user_data
 {
     LV_UNUSED(user_data);
     cache->max_size = max_size;
+
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_set_max_size(cache->shards[i], max_size / cache->shard_cnt, user_data);
+    }
 }
 size_t lv_cache_get_max_size(lv_cache_t * cache, void * user_data)
 {
@@ -256,12 +369,18 @@ size_t lv_cache_get_max_size(lv_cache_t * cache, void * user_data)
 size_t lv_cache_get_size(lv_cache_t * cache, void * user_data)
 {
     LV_UNUSED(user_data);
-    return cache->size;
+    if(cache->shards == NULL) return cache->size;
+
+    size_t size = 0;
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        size += cache->shards[i]->size;
+    }
+    return size;
 }
 size_t lv_cache_get_free_size(lv_cache_t * cache, void * user_data)
 {
-    LV_UNUSED(user_data);
-    return cache->max_size - cache->size;
+    return cache->max_size - lv_cache_get_size(cache, user_data);
 }
 bool lv_cache_is_enabled(lv_cache_t * cache)
 {
@@ -271,27 +390,120 @@ void lv_cache_set_compare_cb(lv_cache_t * cache, lv_cache_compare_cb_t compare_c
 {
     LV_UNUSED(user_data);
     cache->ops.compare_cb = compare_cb;
+
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        cache->shards[i]->ops.compare_cb = compare_cb;
+    }
 }
 void lv_cache_set_create_cb(lv_cache_t * cache, lv_cache_create_cb_t alloc_cb, void * user_data)
 {
     LV_UNUSED(user_data);
     cache->ops.create_cb = alloc_cb;
+
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        cache->shards[i]->ops.create_cb = alloc_cb;
+    }
 }
 void lv_cache_set_free_cb(lv_cache_t * cache, lv_cache_free_cb_t free_cb, void * user_data)
 {
     LV_UNUSED(user_data);
     cache->ops.free_cb = free_cb;
+
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        cache->shards[i]->ops.free_cb = free_cb;
+    }
 }
 void lv_cache_set_name(lv_cache_t * cache, const char * name)
 {
     if(cache == NULL) return;
     cache->name = name;
+
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        cache->shards[i]->name = name;
+    }
 }
 const char * lv_cache_get_name(lv_cache_t * cache)
 {
     return cache->name;
 }
 
+void lv_cache_set_entry_cost(lv_cache_t * cache, lv_cache_entry_t * entry, uint32_t cost)
+{
+    LV_ASSERT_NULL(cache);
+    LV_ASSERT_NULL(entry);
+
+    if(cache->shards) cache = (lv_cache_t *)lv_cache_entry_get_cache(entry);
+
+    lv_mutex_lock(&cache->lock);
+    lv_cache_entry_set_cost(entry, cost);
+    cache->stats.total_cost += cost;
+    lv_mutex_unlock(&cache->lock);
+}
+void lv_cache_get_stats(lv_cache_t * cache, lv_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(cache);
+    LV_ASSERT_NULL(stats);
+
+    if(cache->shards) {
+        lv_memzero(stats, sizeof(lv_cache_stats_t));
+        stats->max_size = cache->max_size;
+
+        uint32_t i;
+        for(i = 0; i < cache->shard_cnt; i++) {
+            lv_cache_stats_t shard_stats;
+            lv_cache_get_stats(cache->shards[i], &shard_stats);
+            stats->hit_cnt += shard_stats.hit_cnt;
+            stats->miss_cnt += shard_stats.miss_cnt;
+            stats->evict_cnt += shard_stats.evict_cnt;
+            stats->size += shard_stats.size;
+            stats->total_cost += shard_stats.total_cost;
+        }
+        return;
+    }
+
+    lv_mutex_lock(&cache->lock);
+    *stats = cache->stats;
+    stats->size = cache->size;
+    stats->max_size = cache->max_size;
+    lv_mutex_unlock(&cache->lock);
+}
+void lv_cache_reset_stats(lv_cache_t * cache)
+{
+    LV_ASSERT_NULL(cache);
+
+    if(cache->shards) {
+        /*The wrapper has no lock and no stats of its own*/
+        uint32_t i;
+        for(i = 0; i < cache->shard_cnt; i++) {
+            lv_cache_reset_stats(cache->shards[i]);
+        }
+        return;
+    }
+
+    lv_mutex_lock(&cache->lock);
+    lv_memzero(&cache->stats, sizeof(cache->stats));
+    lv_mutex_unlock(&cache->lock);
+}
+void lv_cache_dump_stats(lv_cache_t * cache)
+{
+    if(cache == NULL) return;
+
+    lv_cache_stats_t stats;
+    lv_cache_get_stats(cache, &stats);
+
+    uint32_t lookup_cnt = stats.hit_cnt + stats.miss_cnt;
+    uint32_t hit_pct = lookup_cnt ? (uint32_t)((uint64_t)stats.hit_cnt * 100 / lookup_cnt) : 0;
+
+    LV_LOG_USER("%s: hit %" LV_PRIu32 ", miss %" LV_PRIu32 " (%" LV_PRIu32 "%% hit), evict %" LV_PRIu32
+                ", size %" LV_PRIu32 "/%" LV_PRIu32 ", cost %" LV_PRIu32,
+                cache->name ? cache->name : "cache", stats.hit_cnt, stats.miss_cnt, hit_pct, stats.evict_cnt,
+                stats.size, stats.max_size, stats.total_cost);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -326,6 +538,7 @@ static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_dat
     cache->clz->remove_cb(cache, victim, user_data);
     cache->ops.free_cb(lv_cache_entry_get_data(victim), user_data);
     lv_cache_entry_delete(victim);
+    cache->stats.evict_cnt++;
     return true;
 }
 
@@ -346,3 +559,10 @@ static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const v
 
     return entry;
 }
+
+static inline lv_cache_t * get_shard(lv_cache_t * cache, const void * key)
+{
+    if(cache->shards == NULL) return cache;
+
+    return cache->shards[cache->hash_cb(key) % cache->shard_cnt];
+}
@@ -18,6 +18,7 @@ extern "C" {
 #include "../lv_types.h"
 
 #include "lv_cache_lru_rb.h"
+#include "lv_cache_gds_rb.h"
 
 #include "lv_image_cache.h"
 #include "lv_image_header_cache.h"
@@ -35,13 +36,17 @@ extern "C" {
 
 /**
  * Create a cache object with the given parameters.
- * @param cache_class   The class of the cache. Currently only support one two builtin classes:
+ * @param cache_class   The class of the cache. Currently support four builtin classes:
  *                        - lv_cache_class_lru_rb_count for LRU-based cache with count-based eviction policy.
  *                        - lv_cache_class_lru_rb_size for LRU-based cache with size-based eviction policy.
+ *                        - lv_cache_class_gds_rb_count for GreedyDual-Size cache with count-based eviction policy.
+ *                        - lv_cache_class_gds_rb_size for GreedyDual-Size cache with size-based eviction policy.
+ *                          Entries which are expensive to create (see lv_cache_set_entry_cost()) are kept longer.
  * @param node_size     The node size is the size of the data stored in the cache..
  * @param max_size      The max size is the maximum amount of memory or count that the cache can hold.
  *                        - lv_cache_class_lru_rb_count: max_size is the maximum count of nodes in the cache.
  *                        - lv_cache_class_lru_rb_size: max_size is the maximum size of the cache in bytes.
+ *                        - lv_cache_class_gds_rb_count/size: same as the LRU classes.
  * @param ops           A set of operations that can be performed on the cache. See lv_cache_ops_t for details.
  * @return              Returns a pointer to the created cache object on success, `NULL` on error.
  */
@@ -49,6 +54,23 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
                              size_t node_size, size_t max_size,
                              lv_cache_ops_t ops);
 
+/**
+ * Create a cache which is split into shards by the hash of the keys. Every shard is an
+ * independent cache with its own lock, so threads looking up different keys
+ * (e.g. several draw units decoding different images) don't wait for each other.
+ * The returned cache can be used with all the `lv_cache_...` functions.
+ * @param cache_class   The class of the shards. See lv_cache_create().
+ * @param node_size     The node size is the size of the data stored in the cache.
+ * @param max_size      The max size of the whole cache. It's split evenly among the shards.
+ * @param ops           A set of operations that can be performed on the cache. See lv_cache_ops_t for details.
+ * @param hash_cb       Return a hash of a key. Equal keys must have equal hashes.
+ * @param shard_cnt     Number of shards.
+ * @return              Returns a pointer to the created cache object on success, `NULL` on error.
+ */
+lv_cache_t * lv_cache_create_sharded(const lv_cache_class_t * cache_class,
+                                     size_t node_size, size_t max_size,
+                                     lv_cache_ops_t ops, lv_cache_hash_cb_t hash_cb, uint32_t shard_cnt);
+
 /**
  * Destroy a cache object.
  * @param cache         The cache object pointer to destroy.
@@ -215,6 +237,35 @@ void lv_cache_set_name(lv_cache_t * cache, const char * name);
  */
 const char * lv_cache_get_name(lv_cache_t * cache);
 
+/**
+ * Record the cost of creating the data of a cache entry, e.g. the time it took to decode an image.
+ * Cost-aware classes like lv_cache_class_gds_rb_size prefer to keep expensive entries.
+ * The cost is also added to the `total_cost` statistics of the cache.
+ * @param cache         The cache object pointer the entry belongs to.
+ * @param entry         The cache entry pointer to set the cost of.
+ * @param cost          The cost of the entry, e.g. decode time in microseconds.
+ */
+void lv_cache_set_entry_cost(lv_cache_t * cache, lv_cache_entry_t * entry, uint32_t cost);
+
+/**
+ * Get the statistics of a cache.
+ * @param cache         The cache object pointer to get the statistics of.
+ * @param stats         Store the statistics here.
+ */
+void lv_cache_get_stats(lv_cache_t * cache, lv_cache_stats_t * stats);
+
+/**
+ * Reset the hit, miss, eviction and cost counters of a cache.
+ * @param cache         The cache object pointer to reset the statistics of.
+ */
+void lv_cache_reset_stats(lv_cache_t * cache);
+
+/**
+ * Print the statistics of a cache with `LV_LOG_USER`.
+ * @param cache         The cache object pointer to dump the statistics of.
+ */
+void lv_cache_dump_stats(lv_cache_t * cache);
+
 /*************************
  *    GLOBAL VARIABLES
  *************************/
@@ -23,6 +23,7 @@ struct lv_cache_entry_t {
     const lv_cache_t * cache;
     int32_t ref_cnt;
     uint32_t node_size;
+    uint32_t cost;
 
     bool is_invalid;
 };
@@ -79,6 +80,16 @@ void lv_cache_entry_set_node_size(lv_cache_entry_t * entry, uint32_t node_size)
     LV_ASSERT_NULL(entry);
     entry->node_size = node_size;
 }
+void lv_cache_entry_set_cost(lv_cache_entry_t * entry, uint32_t cost)
+{
+    LV_ASSERT_NULL(entry);
+    entry->cost = cost;
+}
+uint32_t lv_cache_entry_get_cost(const lv_cache_entry_t * entry)
+{
+    LV_ASSERT_NULL(entry);
+    return entry->cost;
+}
 void lv_cache_entry_set_invalid(lv_cache_entry_t * entry, bool is_invalid)
 {
     LV_ASSERT_NULL(entry);
@@ -153,6 +164,7 @@ void lv_cache_entry_init(lv_cache_entry_t * entry, const lv_cache_t * cache, con
     entry->cache = cache;
     entry->node_size = node_size;
     entry->ref_cnt = 0;
+    entry->cost = 0;
     entry->is_invalid = false;
 }
 void lv_cache_entry_delete(lv_cache_entry_t * entry)
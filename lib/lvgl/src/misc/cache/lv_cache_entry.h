@@ -49,6 +49,13 @@ int32_t  lv_cache_entry_get_ref(lv_cache_entry_t * entry);
  */
 uint32_t lv_cache_entry_get_node_size(lv_cache_entry_t * entry);
 
+/**
+ * Get the cost of creating the data of a cache entry, e.g. its decode time.
+ * @param entry        The cache entry to get the cost of.
+ * @return             The cost set by lv_cache_set_entry_cost(), 0 if not set.
+ */
+uint32_t lv_cache_entry_get_cost(const lv_cache_entry_t * entry);
+
 /**
  * Check if a cache entry is invalid.
  * @param entry        The cache entry to check.
@@ -0,0 +1,445 @@
+/**
+* @file lv_cache_gds_rb.c
+*
+*/
+
+/***************************************************************************\
+*                                                                           *
+*  GreedyDual-Size cache                                                    *
+*                                                                           *
+*  Every entry has a priority  H = L + cost / size  where `cost` is the     *
+*  time it took to create the entry's data (e.g. to decode an image).       *
+*  The entry with the lowest H is evicted and L (the inflation value) is    *
+*  raised to its H. A hit refreshes H with the current L, so entries which  *
+*  were not used recently lose their advantage over time.                   *
+*                                                                           *
+*  With equal costs and sizes it behaves like an LRU cache.                 *
+*                                                                           *
+*  The entries are found by an RB tree. A list ordered by recency is        *
+*  scanned to find the victim, which is cheap as caches using this policy   *
+*  (e.g. the image cache) store a few large entries.                        *
+*                                                                           *
+\***************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_cache_gds_rb.h"
+#include "../../stdlib/lv_sprintf.h"
+#include "../../stdlib/lv_string.h"
+#include "../lv_ll.h"
+#include "../lv_rb_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Fixed point shift of cost / size to keep the priority of large but cheap entries above zero*/
+#define PRIORITY_SHIFT  16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef uint32_t (get_data_size_cb_t)(const void * data);
+
+struct lv_gds_rb_t {
+    lv_cache_t cache;
+
+    lv_rb_t rb;
+    lv_ll_t ll;
+
+    uint64_t inflation;     /*The `L` value: priority of the last victim*/
+
+    get_data_size_cb_t * get_data_size_cb;
+};
+typedef struct lv_gds_rb_t lv_gds_rb_t_;
+
+/*Stored after the cache entry in the RB node's data*/
+typedef struct {
+    void * ll_node;         /*Node of the entry in the recency list*/
+    uint64_t base;          /*Inflation value when the entry was added or last hit*/
+} gds_meta_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void * alloc_cb(void);
+static bool init_cnt_cb(lv_cache_t * cache);
+static bool init_size_cb(lv_cache_t * cache);
+static void  destroy_cb(lv_cache_t * cache, void * user_data);
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data);
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data);
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void drop_all_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data);
+
+static bool init_common(lv_gds_rb_t_ * gds);
+static void remove_node(lv_gds_rb_t_ * gds, lv_rb_node_t * node);
+inline static void * get_meta(lv_gds_rb_t_ * gds, lv_rb_node_t * node);
+static uint64_t get_priority(lv_gds_rb_t_ * gds, lv_rb_node_t * node);
+
+static uint32_t cnt_get_data_size_cb(const void * data);
+static uint32_t size_get_data_size_cb(const void * data);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+const lv_cache_class_t lv_cache_class_gds_rb_count = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_cnt_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb
+};
+
+const lv_cache_class_t lv_cache_class_gds_rb_size = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_size_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb
+};
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+inline static void * get_meta(lv_gds_rb_t_ * gds, lv_rb_node_t * node)
+{
+    return (char *)node->data + lv_cache_entry_get_size(gds->cache.node_size);
+}
+
+static uint64_t get_priority(lv_gds_rb_t_ * gds, lv_rb_node_t * node)
+{
+    gds_meta_t meta;
+    lv_memcpy(&meta, get_meta(gds, node), sizeof(gds_meta_t));
+
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(node->data, gds->cache.node_size);
+    uint64_t cost = (uint64_t)lv_cache_entry_get_cost(entry) + 1;
+    uint32_t size = gds->get_data_size_cb(node->data);
+    if(size == 0) size = 1;
+
+    return meta.base + (cost << PRIORITY_SHIFT) / size;
+}
+
+static void * alloc_cb(void)
+{
+    void * res = lv_malloc(sizeof(lv_gds_rb_t_));
+    LV_ASSERT_MALLOC(res);
+    if(res == NULL) {
+        LV_LOG_ERROR("malloc failed");
+        return NULL;
+    }
+
+    lv_memzero(res, sizeof(lv_gds_rb_t_));
+    return res;
+}
+
+static bool init_common(lv_gds_rb_t_ * gds)
+{
+    LV_ASSERT_NULL(gds->cache.ops.compare_cb);
+    LV_ASSERT_NULL(gds->cache.ops.free_cb);
+    LV_ASSERT(gds->cache.node_size > 0);
+
+    if(gds->cache.node_size <= 0 || gds->cache.ops.compare_cb == NULL || gds->cache.ops.free_cb == NULL) {
+        return false;
+    }
+
+    /*add gds_meta_t to store the ll node pointer and the priority base*/
+    if(!lv_rb_init(&gds->rb, gds->cache.ops.compare_cb,
+                   lv_cache_entry_get_size(gds->cache.node_size) + sizeof(gds_meta_t))) {
+        return false;
+    }
+    lv_ll_init(&gds->ll, sizeof(void *));
+
+    gds->inflation = 0;
+
+    return true;
+}
+
+static bool init_cnt_cb(lv_cache_t * cache)
+{
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+    if(!init_common(gds)) return false;
+
+    gds->get_data_size_cb = cnt_get_data_size_cb;
+    return true;
+}
+
+static bool init_size_cb(lv_cache_t * cache)
+{
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+    if(!init_common(gds)) return false;
+
+    gds->get_data_size_cb = size_get_data_size_cb;
+    return true;
+}
+
+static void destroy_cb(lv_cache_t * cache, void * user_data)
+{
+    LV_ASSERT_NULL(cache);
+
+    if(cache == NULL) {
+        return;
+    }
+
+    cache->clz->drop_all_cb(cache, user_data);
+}
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+    LV_ASSERT_NULL(key);
+
+    if(gds == NULL || key == NULL) {
+        return NULL;
+    }
+
+    lv_rb_node_t * node = lv_rb_find(&gds->rb, key);
+    if(node == NULL) {
+        return NULL;
+    }
+
+    /*cache hit: restore the full priority and move to the head of the recency list*/
+    gds_meta_t meta;
+    lv_memcpy(&meta, get_meta(gds, node), sizeof(gds_meta_t));
+    meta.base = gds->inflation;
+    lv_memcpy(get_meta(gds, node), &meta, sizeof(gds_meta_t));
+
+    lv_ll_move_before(&gds->ll, meta.ll_node, lv_ll_get_head(&gds->ll));
+
+    return lv_cache_entry_get_entry(node->data, cache->node_size);
+}
+
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+    LV_ASSERT_NULL(key);
+
+    if(gds == NULL || key == NULL) {
+        return NULL;
+    }
+
+    lv_rb_node_t * node = lv_rb_insert(&gds->rb, (void *)key);
+    if(node == NULL) {
+        return NULL;
+    }
+
+    void * data = node->data;
+    lv_memcpy(data, key, cache->node_size);
+
+    void * ll_node = lv_ll_ins_head(&gds->ll);
+    if(ll_node == NULL) {
+        lv_rb_drop_node(&gds->rb, node);
+        return NULL;
+    }
+    lv_memcpy(ll_node, &node, sizeof(void *));
+
+    gds_meta_t meta;
+    meta.ll_node = ll_node;
+    meta.base = gds->inflation;
+    lv_memcpy(get_meta(gds, node), &meta, sizeof(gds_meta_t));
+
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, cache->node_size);
+    lv_cache_entry_init(entry, cache, cache->node_size);
+
+    cache->size += gds->get_data_size_cb(key);
+
+    return entry;
+}
+
+static void remove_node(lv_gds_rb_t_ * gds, lv_rb_node_t * node)
+{
+    gds_meta_t meta;
+    lv_memcpy(&meta, get_meta(gds, node), sizeof(gds_meta_t));
+
+    gds->cache.size -= gds->get_data_size_cb(node->data);
+
+    lv_ll_remove(&gds->ll, meta.ll_node);
+    lv_free(meta.ll_node);
+}
+
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+    LV_ASSERT_NULL(entry);
+
+    if(gds == NULL || entry == NULL) {
+        return;
+    }
+
+    void * data = lv_cache_entry_get_data(entry);
+    lv_rb_node_t * node = lv_rb_find(&gds->rb, data);
+    if(node == NULL) {
+        return;
+    }
+
+    remove_node(gds, node);
+    lv_rb_remove_node(&gds->rb, node);
+}
+
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+    LV_ASSERT_NULL(key);
+
+    if(gds == NULL || key == NULL) {
+        return;
+    }
+
+    lv_rb_node_t * node = lv_rb_find(&gds->rb, key);
+    if(node == NULL) {
+        return;
+    }
+
+    void * data = node->data;
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, cache->node_size);
+
+    cache->ops.free_cb(data, user_data);
+    remove_node(gds, node);
+
+    lv_rb_remove_node(&gds->rb, node);
+    lv_cache_entry_delete(entry);
+}
+
+static void drop_all_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+
+    if(gds == NULL) {
+        return;
+    }
+
+    uint32_t used_cnt = 0;
+    lv_rb_node_t ** node;
+    LV_LL_READ(&gds->ll, node) {
+        /*free user handled data and do other clean up*/
+        void * search_key = (*node)->data;
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(search_key, cache->node_size);
+        if(lv_cache_entry_get_ref(entry) == 0) {
+            cache->ops.free_cb(search_key, user_data);
+        }
+        else {
+            LV_LOG_WARN("entry (%p) is still referenced (%" LV_PRId32 ")", (void *)entry, lv_cache_entry_get_ref(entry));
+            used_cnt++;
+        }
+    }
+    if(used_cnt > 0) {
+        LV_LOG_WARN("%" LV_PRId32 " entries are still referenced", used_cnt);
+    }
+
+    lv_rb_destroy(&gds->rb);
+    lv_ll_clear(&gds->ll);
+
+    cache->size = 0;
+    gds->inflation = 0;
+}
+
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+
+    /*Search from the least recently used to prefer older entries on equal priority*/
+    lv_cache_entry_t * victim = NULL;
+    uint64_t victim_priority = UINT64_MAX;
+    lv_rb_node_t ** tail;
+    LV_LL_READ_BACK(&gds->ll, tail) {
+        lv_rb_node_t * tail_node = *tail;
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(tail_node->data, cache->node_size);
+        if(lv_cache_entry_get_ref(entry) != 0) continue;
+
+        uint64_t priority = get_priority(gds, tail_node);
+        if(victim == NULL || priority < victim_priority) {
+            victim = entry;
+            victim_priority = priority;
+        }
+    }
+
+    if(victim) gds->inflation = victim_priority;
+
+    return victim;
+}
+
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+
+    if(gds == NULL) {
+        return LV_CACHE_RESERVE_COND_ERROR;
+    }
+
+    uint32_t data_size = key ? gds->get_data_size_cb(key) : 0;
+    if(data_size > gds->cache.max_size) {
+        LV_LOG_ERROR("data size (%" LV_PRIu32 ") is larger than max size (%" LV_PRIu32 ")", data_size, gds->cache.max_size);
+        return LV_CACHE_RESERVE_COND_TOO_LARGE;
+    }
+
+    return cache->size + reserved_size + data_size > gds->cache.max_size
+           ? LV_CACHE_RESERVE_COND_NEED_VICTIM
+           : LV_CACHE_RESERVE_COND_OK;
+}
+
+static uint32_t cnt_get_data_size_cb(const void * data)
+{
+    LV_UNUSED(data);
+    return 1;
+}
+
+static uint32_t size_get_data_size_cb(const void * data)
+{
+    lv_cache_slot_size_t * slot = (lv_cache_slot_size_t *)data;
+    return slot->size;
+}
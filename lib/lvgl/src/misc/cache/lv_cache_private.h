@@ -48,6 +48,7 @@ typedef int8_t lv_cache_compare_res_t;
 typedef bool (*lv_cache_create_cb_t)(void * node, void * user_data);
 typedef void (*lv_cache_free_cb_t)(void * node, void * user_data);
 typedef lv_cache_compare_res_t (*lv_cache_compare_cb_t)(const void * a, const void * b);
+typedef uint32_t (*lv_cache_hash_cb_t)(const void * key);
 
 /**
  * The cache instance allocation function, used by the cache class to allocate memory for cache instances.
@@ -107,6 +108,18 @@ typedef lv_cache_entry_t * (*lv_cache_get_victim_cb)(lv_cache_t * cache, void *
 typedef lv_cache_reserve_cond_res_t (*lv_cache_reserve_cond_cb)(lv_cache_t * cache, const void * key, size_t size,
                                                                 void * user_data);
 
+/**
+ * Statistics of a cache
+ */
+typedef struct {
+    uint32_t hit_cnt;                 /**< Number of lookups which found the entry */
+    uint32_t miss_cnt;                /**< Number of lookups which didn't find the entry */
+    uint32_t evict_cnt;               /**< Number of entries evicted to make room for new ones */
+    uint32_t size;                    /**< Current size of the cache, bytes for size based caches */
+    uint32_t max_size;                /**< Maximum size of the cache */
+    uint32_t total_cost;              /**< Sum of the cost of the created entries, e.g. total decode time in us */
+} lv_cache_stats_t;
+
 /**
  * The cache operations struct
  */
@@ -120,9 +133,11 @@ struct lv_cache_ops_t {
  * The cache entry struct
  */
 struct lv_cache_t {
-    const lv_cache_class_t * clz;     /**< Cache class. There are two built-in classes:
+    const lv_cache_class_t * clz;     /**< Cache class. There are four built-in classes:
                                        * - lv_cache_class_lru_rb_count for LRU-based cache with count-based eviction policy.
-                                       * - lv_cache_class_lru_rb_size for LRU-based cache with size-based eviction policy. */
+                                       * - lv_cache_class_lru_rb_size for LRU-based cache with size-based eviction policy.
+                                       * - lv_cache_class_gds_rb_count for cost-aware cache with count-based eviction policy.
+                                       * - lv_cache_class_gds_rb_size for cost-aware cache with size-based eviction policy. */
 
     uint32_t node_size;               /**< Size of a node */
 
@@ -133,6 +148,12 @@ struct lv_cache_t {
 
     lv_mutex_t lock;                  /**< Cache lock used to protect the cache in multithreading environments */
 
+    lv_cache_stats_t stats;           /**< Hit, miss, eviction and cost counters */
+
+    lv_cache_t ** shards;             /**< Independently locked sub-caches of a sharded cache, `NULL` if not sharded */
+    uint32_t shard_cnt;               /**< Number of shards */
+    lv_cache_hash_cb_t hash_cb;       /**< Select the shard of a key */
+
     const char * name;                /**< Name of the cache */
 };
 
@@ -142,6 +163,8 @@ struct lv_cache_t {
  * Examples:
  * - lv_cache_class_lru_rb_count for LRU-based cache with count-based eviction policy.
  * - lv_cache_class_lru_rb_size for LRU-based cache with size-based eviction policy.
+ * - lv_cache_class_gds_rb_count for GreedyDual-Size cache with count-based eviction policy.
+ * - lv_cache_class_gds_rb_size for GreedyDual-Size cache with size-based eviction policy.
  */
 struct lv_cache_class_t {
     lv_cache_alloc_cb_t alloc_cb;                 /**< The allocation function for cache entries */
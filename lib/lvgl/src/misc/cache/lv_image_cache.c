@@ -11,7 +11,7 @@
 #include "../lv_assert.h"
 #include "../../core/lv_global.h"
 
-#include "lv_image_cache.h"
+#include "lv_image_cache_private.h"
 #include "lv_image_header_cache.h"
 
 /*********************
@@ -34,6 +34,7 @@
 static lv_cache_compare_res_t image_cache_compare_cb(const lv_image_cache_data_t * lhs,
                                                      const lv_image_cache_data_t * rhs);
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data);
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * key);
 
 /**********************
  *  GLOBAL VARIABLES
@@ -57,12 +58,18 @@ lv_result_t lv_image_cache_init(uint32_t size)
         return LV_RESULT_OK;
     }
 
-    img_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+#if LV_IMAGE_CACHE_COST_AWARE
+    const lv_cache_class_t * cache_class = &lv_cache_class_gds_rb_size;
+#else
+    const lv_cache_class_t * cache_class = &lv_cache_class_lru_rb_size;
+#endif
+
+    img_cache_p = lv_cache_create_sharded(cache_class,
     sizeof(lv_image_cache_data_t), size, (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t) image_cache_compare_cb,
         .create_cb = NULL,
         .free_cb = (lv_cache_free_cb_t) image_cache_free_cb,
-    });
+    }, (lv_cache_hash_cb_t) image_cache_hash_cb, LV_IMAGE_CACHE_SHARD_CNT);
 
     lv_cache_set_name(img_cache_p, CACHE_NAME);
     return img_cache_p != NULL ? LV_RESULT_OK : LV_RESULT_INVALID;
@@ -99,6 +106,25 @@ bool lv_image_cache_is_enabled(void)
     return lv_cache_is_enabled(img_cache_p);
 }
 
+uint32_t lv_image_cache_src_hash(const void * src, lv_image_src_t src_type)
+{
+    if(src_type == LV_IMAGE_SRC_FILE) {
+        /*FNV-1a hash of the path*/
+        uint32_t hash = 2166136261u;
+        const char * path = src;
+        while(*path) {
+            hash ^= (uint8_t)(*path);
+            hash *= 16777619u;
+            path++;
+        }
+        return hash;
+    }
+
+    /*Variables are usually aligned so drop the low bits*/
+    uintptr_t addr = (uintptr_t)src;
+    return (uint32_t)((addr >> 4) ^ (addr >> 12));
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -143,3 +169,8 @@ static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data)
     /*Free the duplicated file name*/
     if(entry->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)entry->src);
 }
+
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * key)
+{
+    return lv_image_cache_src_hash(key->src, key->src_type);
+}
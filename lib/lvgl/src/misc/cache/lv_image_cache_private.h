@@ -0,0 +1,48 @@
+/**
+ * @file lv_image_cache_private.h
+ *
+ */
+
+#ifndef LV_IMAGE_CACHE_PRIVATE_H
+#define LV_IMAGE_CACHE_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_image_cache.h"
+#include "../../draw/lv_image_decoder.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Hash an image source to select the shard of the image and image header caches.
+ * @param src       the image source: a file path or a pointer to an image descriptor
+ * @param src_type  the type of `src`
+ * @return          the hash of the source
+ */
+uint32_t lv_image_cache_src_hash(const void * src, lv_image_src_t src_type);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMAGE_CACHE_PRIVATE_H*/
@@ -0,0 +1,247 @@
+/**
+* @file lv_text_layout_cache.c
+*
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_text_layout_cache_private.h"
+#include "lv_cache.h"
+#include "../lv_text_private.h"
+#include "../lv_assert.h"
+#include "../lv_log.h"
+#include "../lv_profiler.h"
+#include "../../core/lv_global.h"
+#include "../../font/lv_font.h"
+#include "../../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define CACHE_NAME  "TEXT_LAYOUT"
+
+/*Longer texts are laid out directly to keep the copies stored in the cache small*/
+#define TEXT_LEN_MAX    512
+
+#define text_layout_cache_p (LV_GLOBAL_DEFAULT()->text_layout_cache)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static bool text_layout_create_cb(lv_text_layout_t * node, void * user_data);
+static void text_layout_free_cb(lv_text_layout_t * node, void * user_data);
+static lv_cache_compare_res_t text_layout_compare_cb(const lv_text_layout_t * lhs, const lv_text_layout_t * rhs);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_text_layout_cache_init(uint32_t count)
+{
+    if(text_layout_cache_p != NULL) {
+        return LV_RESULT_OK;
+    }
+
+    text_layout_cache_p = lv_cache_create(&lv_cache_class_lru_rb_count,
+    sizeof(lv_text_layout_t), count, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) text_layout_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) text_layout_create_cb,
+        .free_cb = (lv_cache_free_cb_t) text_layout_free_cb
+    });
+
+    if(text_layout_cache_p == NULL) return LV_RESULT_INVALID;
+
+    lv_cache_set_name(text_layout_cache_p, CACHE_NAME);
+    return LV_RESULT_OK;
+}
+
+void lv_text_layout_cache_deinit(void)
+{
+    if(text_layout_cache_p == NULL) return;
+
+    lv_cache_destroy(text_layout_cache_p, NULL);
+    text_layout_cache_p = NULL;
+}
+
+void lv_text_layout_cache_resize(uint32_t count, bool evict_now)
+{
+    lv_cache_set_max_size(text_layout_cache_p, count, NULL);
+    if(evict_now) {
+        lv_cache_reserve(text_layout_cache_p, count, NULL);
+    }
+}
+
+void lv_text_layout_cache_drop_all(void)
+{
+    if(text_layout_cache_p == NULL) return;
+
+    lv_cache_drop_all(text_layout_cache_p, NULL);
+}
+
+bool lv_text_layout_cache_is_enabled(void)
+{
+    return text_layout_cache_p != NULL && lv_cache_is_enabled(text_layout_cache_p);
+}
+
+const lv_text_layout_t * lv_text_layout_cache_acquire(const char * text, const lv_font_t * font,
+                                                      int32_t letter_space, int32_t max_width, lv_text_flag_t flag)
+{
+    if(!lv_text_layout_cache_is_enabled()) return NULL;
+
+    /*Hash the text and check its length in one pass (FNV-1a)*/
+    uint32_t hash = 2166136261u;
+    uint32_t len = 0;
+    while(text[len] != '\0') {
+        if(len >= TEXT_LEN_MAX) return NULL;
+        hash = (hash ^ (uint8_t)text[len]) * 16777619u;
+        len++;
+    }
+
+    /*The width limit is ignored in these cases so don't let it split the entries*/
+    if(flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) max_width = LV_COORD_MAX;
+
+    lv_text_layout_t search_key = {
+        .text = text,
+        .text_len = len,
+        .text_hash = hash,
+        .font = font,
+        .letter_space = letter_space,
+        .max_width = max_width,
+        .flag = flag,
+    };
+
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(text_layout_cache_p, &search_key, NULL);
+    if(entry == NULL) return NULL;
+
+    return lv_cache_entry_get_data(entry);
+}
+
+void lv_text_layout_cache_release(const lv_text_layout_t * layout)
+{
+    LV_ASSERT_NULL(layout);
+
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry((void *)layout, sizeof(lv_text_layout_t));
+    lv_cache_release(text_layout_cache_p, entry, NULL);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool text_layout_create_cb(lv_text_layout_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    LV_PROFILER_BEGIN;
+
+    const char * text = node->text;
+    uint32_t line_cap = 4;
+    lv_text_layout_line_t * lines = lv_malloc(line_cap * sizeof(lv_text_layout_line_t));
+    char * text_copy = lv_malloc(node->text_len + 1);
+    if(lines == NULL || text_copy == NULL) {
+        LV_LOG_WARN("out of memory");
+        lv_free(lines);
+        lv_free(text_copy);
+        LV_PROFILER_END;
+        return false;
+    }
+
+    /*Same line breaking as `lv_text_get_size()` without a cache*/
+    uint32_t line_cnt = 0;
+    uint32_t line_start = 0;
+    int32_t max_line_w = 0;
+    while(text[line_start] != '\0') {
+        uint32_t line_end = line_start + lv_text_get_next_line(&text[line_start], node->font, node->letter_space,
+                                                               node->max_width, NULL, node->flag);
+
+        if(line_cnt == line_cap) {
+            line_cap *= 2;
+            lv_text_layout_line_t * new_lines = lv_realloc(lines, line_cap * sizeof(lv_text_layout_line_t));
+            if(new_lines == NULL) {
+                LV_LOG_WARN("out of memory");
+                lv_free(lines);
+                lv_free(text_copy);
+                LV_PROFILER_END;
+                return false;
+            }
+            lines = new_lines;
+        }
+
+        int32_t line_w = lv_text_get_width(&text[line_start], line_end - line_start, node->font, node->letter_space);
+        lines[line_cnt].end = line_end;
+        lines[line_cnt].width = line_w;
+        max_line_w = LV_MAX(max_line_w, line_w);
+        line_cnt++;
+        line_start = line_end;
+    }
+
+    lv_memcpy(text_copy, text, node->text_len + 1);
+    node->text = text_copy;
+    node->lines = lines;
+    node->line_cnt = line_cnt;
+    node->width = max_line_w;
+
+    LV_PROFILER_END;
+    return true;
+}
+
+static void text_layout_free_cb(lv_text_layout_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_free((void *)node->text);
+    lv_free(node->lines);
+}
+
+static lv_cache_compare_res_t text_layout_compare_cb(const lv_text_layout_t * lhs, const lv_text_layout_t * rhs)
+{
+    if(lhs->text_hash != rhs->text_hash) {
+        return lhs->text_hash > rhs->text_hash ? 1 : -1;
+    }
+
+    if(lhs->text_len != rhs->text_len) {
+        return lhs->text_len > rhs->text_len ? 1 : -1;
+    }
+
+    if(lhs->font != rhs->font) {
+        return lhs->font > rhs->font ? 1 : -1;
+    }
+
+    if(lhs->letter_space != rhs->letter_space) {
+        return lhs->letter_space > rhs->letter_space ? 1 : -1;
+    }
+
+    if(lhs->max_width != rhs->max_width) {
+        return lhs->max_width > rhs->max_width ? 1 : -1;
+    }
+
+    if(lhs->flag != rhs->flag) {
+        return lhs->flag > rhs->flag ? 1 : -1;
+    }
+
+    int32_t cmp_res = lv_memcmp(lhs->text, rhs->text, lhs->text_len);
+    if(cmp_res != 0) {
+        return cmp_res > 0 ? 1 : -1;
+    }
+
+    return 0;
+}
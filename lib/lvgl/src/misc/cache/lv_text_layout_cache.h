@@ -0,0 +1,99 @@
+/**
+* @file lv_text_layout_cache.h
+*
+ */
+
+#ifndef LV_TEXT_LAYOUT_CACHE_H
+#define LV_TEXT_LAYOUT_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../lv_conf_internal.h"
+#include "../lv_types.h"
+#include "../lv_text.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the text layout cache. It stores the line breaks and line widths of texts
+ * so that measuring and drawing the same text doesn't have to walk its glyphs again.
+ * @param  count initial size of the cache in count of laid out texts.
+ * @return LV_RESULT_OK: initialization succeeded, LV_RESULT_INVALID: failed.
+ */
+lv_result_t lv_text_layout_cache_init(uint32_t count);
+
+/**
+ * Free the text layout cache and all the layouts in it.
+ */
+void lv_text_layout_cache_deinit(void);
+
+/**
+ * Resize the text layout cache.
+ * If set to 0, the cache is disabled.
+ * @param count  new max count of cached layouts.
+ * @param evict_now true: evict the layouts should be removed by the eviction policy, false: wait for the next cache cleanup.
+ */
+void lv_text_layout_cache_resize(uint32_t count, bool evict_now);
+
+/**
+ * Invalidate all cached layouts.
+ * Needs to be called when the glyph widths of a font change, e.g. its size is changed
+ * or it's deleted and another font might be created at the same address.
+ * The font libraries of LVGL call it automatically.
+ */
+void lv_text_layout_cache_drop_all(void);
+
+/**
+ * Return true if the text layout cache is enabled.
+ * @return true: enabled, false: disabled.
+ */
+bool lv_text_layout_cache_is_enabled(void);
+
+/**
+ * Get the layout of a text from the cache, laying it out if it's not cached yet.
+ * The result must be released with `lv_text_layout_cache_release()`.
+ * @param text          a '\0' terminated string
+ * @param font          pointer to a font
+ * @param letter_space  letter space
+ * @param max_width     max width of the text (break the lines to fit this size). Set LV_COORD_MAX to avoid line breaks
+ * @param flag          settings for the text from ::lv_text_flag_t
+ * @return              the layout of the text or NULL if the cache is disabled or the text is too long to be cached
+ */
+const lv_text_layout_t * lv_text_layout_cache_acquire(const char * text, const lv_font_t * font,
+                                                      int32_t letter_space, int32_t max_width, lv_text_flag_t flag);
+
+/**
+ * Release a layout returned by `lv_text_layout_cache_acquire()`
+ * @param layout        pointer to a layout
+ */
+void lv_text_layout_cache_release(const lv_text_layout_t * layout);
+
+/*************************
+ *    GLOBAL VARIABLES
+ *************************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_TEXT_LAYOUT_CACHE_H*/
@@ -0,0 +1,66 @@
+/**
+ * @file lv_text_layout_cache_private.h
+ *
+ */
+
+#ifndef LV_TEXT_LAYOUT_CACHE_PRIVATE_H
+#define LV_TEXT_LAYOUT_CACHE_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_text_layout_cache.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * A line of a laid out text
+ */
+typedef struct {
+    uint32_t end;                   /**< Byte index where the next line starts*/
+    int32_t width;                  /**< Width of the line in pixels*/
+} lv_text_layout_line_t;
+
+/**
+ * The line breaks and line widths of a text
+ */
+struct lv_text_layout_t {
+    /*Key*/
+    const char * text;              /**< The laid out text. A copy owned by the cache once it's cached*/
+    uint32_t text_len;
+    uint32_t text_hash;
+    const lv_font_t * font;
+    int32_t letter_space;
+    int32_t max_width;              /**< LV_COORD_MAX if the lines are not wrapped*/
+    lv_text_flag_t flag;
+
+    /*Layout*/
+    lv_text_layout_line_t * lines;
+    uint32_t line_cnt;
+    int32_t width;                  /**< Width of the longest line*/
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_TEXT_LAYOUT_CACHE_PRIVATE_H*/
@@ -22,7 +22,10 @@
 #define LV_ANIM_RESOLUTION 1024
 #define LV_ANIM_RES_SHIFT 10
 #define state LV_GLOBAL_DEFAULT()->anim_state
-#define anim_ll_p &(state.anim_ll)
+
+/*The built-in bezier paths are sampled at every 4th of the LV_BEZIER_VAL_MAX steps*/
+#define EASE_LUT_SHIFT 2
+#define EASE_LUT_SIZE ((LV_BEZIER_VAL_MAX >> EASE_LUT_SHIFT) + 1)
 
 /**********************
  *      TYPEDEFS
@@ -33,18 +36,104 @@
  **********************/
 static void anim_timer(lv_timer_t * param);
 static void anim_mark_list_change(void);
-static void anim_completed_handler(lv_anim_t * a);
+static void anim_completed_handler(uint32_t index);
 static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1,
                                          int32_t y1, int32_t x2, int32_t y2);
+static int32_t anim_path_lut(const lv_anim_t * a, const int16_t * lut);
+static int32_t anim_path_value(const lv_anim_t * a);
 static uint32_t convert_speed_to_time(uint32_t speed, int32_t start, int32_t end);
 static void resolve_time(lv_anim_t * a);
 static bool remove_concurrent_anims(lv_anim_t * a_current);
-static void remove_anim(void * a);
+static void remove_anim(uint32_t index);
+static bool anims_add(lv_anim_t * a);
+static void anims_iter_begin(void);
+static void anims_iter_end(void);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 
+/*Samples of `lv_cubic_bezier()` with the parameters of the built-in paths*/
+static const int16_t ease_in_lut[EASE_LUT_SIZE] = {
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 4, 5, 5, 6,
+    7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 18, 19, 21, 22, 24, 25,
+    26, 28, 30, 32, 33, 35, 37, 38, 40, 42, 44, 46, 48, 50, 52, 54,
+    57, 59, 61, 63, 66, 68, 71, 73, 75, 77, 81, 82, 86, 88, 90, 93,
+    96, 99, 101, 104, 106, 110, 113, 115, 119, 121, 124, 127, 130, 133, 135, 140,
+    143, 145, 148, 151, 155, 158, 162, 165, 168, 172, 175, 178, 181, 185, 190, 192,
+    196, 199, 203, 206, 210, 214, 218, 221, 225, 229, 233, 237, 241, 245, 248, 252,
+    256, 260, 264, 268, 272, 276, 280, 285, 289, 293, 297, 301, 306, 311, 314, 318,
+    322, 326, 330, 336, 340, 345, 349, 353, 357, 362, 367, 372, 376, 380, 383, 389,
+    394, 398, 402, 408, 413, 417, 421, 426, 432, 437, 441, 446, 450, 456, 460, 465,
+    469, 475, 480, 484, 489, 495, 499, 505, 510, 514, 520, 525, 529, 535, 541, 545,
+    552, 556, 562, 567, 571, 577, 581, 587, 592, 598, 604, 608, 614, 620, 626, 630,
+    636, 642, 648, 654, 658, 664, 669, 675, 681, 687, 692, 700, 705, 710, 716, 721,
+    727, 732, 738, 745, 750, 756, 761, 768, 773, 779, 784, 790, 799, 805, 810, 813,
+    821, 827, 833, 840, 846, 850, 857, 864, 869, 875, 883, 888, 895, 901, 909, 915,
+    919, 925, 932, 939, 944, 950, 959, 966, 972, 977, 984, 992, 997, 1005, 1010, 1018,
+    1024,
+};
+
+static const int16_t ease_out_lut[EASE_LUT_SIZE] = {
+    0, 9, 14, 21, 27, 34, 41, 47, 54, 60, 67, 75, 82, 88, 94, 100,
+    107, 113, 120, 125, 131, 138, 143, 150, 156, 163, 168, 174, 180, 187, 193, 198,
+    204, 210, 218, 221, 229, 234, 241, 246, 252, 258, 264, 270, 275, 282, 287, 293,
+    298, 304, 309, 315, 320, 326, 333, 339, 345, 350, 356, 362, 367, 373, 379, 383,
+    389, 395, 400, 406, 411, 417, 421, 427, 432, 438, 444, 448, 455, 459, 465, 469,
+    474, 480, 484, 490, 495, 501, 505, 510, 514, 520, 525, 531, 535, 540, 545, 550,
+    556, 560, 565, 570, 574, 580, 585, 589, 594, 598, 604, 608, 612, 617, 622, 628,
+    632, 636, 641, 645, 649, 655, 658, 664, 668, 672, 677, 681, 685, 689, 693, 698,
+    702, 707, 710, 715, 719, 724, 727, 731, 735, 741, 745, 749, 753, 757, 761, 765,
+    769, 773, 775, 780, 784, 788, 792, 796, 800, 804, 806, 810, 813, 817, 821, 824,
+    828, 833, 835, 839, 843, 846, 849, 853, 855, 859, 862, 866, 868, 872, 876, 878,
+    882, 885, 888, 890, 895, 897, 899, 903, 905, 909, 911, 915, 917, 921, 923, 926,
+    928, 932, 934, 935, 939, 941, 944, 946, 949, 951, 954, 956, 958, 960, 962, 964,
+    967, 969, 971, 973, 975, 977, 980, 981, 984, 985, 986, 989, 990, 993, 993, 996,
+    997, 998, 1000, 1001, 1003, 1004, 1005, 1007, 1008, 1009, 1011, 1012, 1012, 1014, 1015, 1015,
+    1016, 1017, 1018, 1018, 1019, 1019, 1021, 1021, 1021, 1022, 1022, 1022, 1022, 1022, 1022, 1022,
+    1024,
+};
+
+static const int16_t ease_in_out_lut[EASE_LUT_SIZE] = {
+    0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 5, 5, 7,
+    7, 8, 10, 11, 12, 13, 15, 16, 18, 19, 20, 22, 24, 26, 28, 30,
+    32, 34, 36, 38, 41, 43, 45, 48, 51, 53, 56, 58, 61, 64, 67, 71,
+    73, 76, 80, 83, 87, 90, 93, 97, 100, 104, 108, 112, 116, 120, 125, 129,
+    133, 138, 141, 145, 150, 155, 160, 164, 168, 174, 179, 184, 188, 194, 199, 204,
+    210, 215, 220, 225, 232, 237, 242, 248, 254, 260, 266, 271, 278, 283, 290, 296,
+    301, 308, 314, 320, 326, 332, 339, 345, 352, 357, 365, 370, 378, 385, 391, 398,
+    404, 410, 419, 426, 432, 438, 446, 453, 459, 466, 472, 481, 487, 493, 499, 505,
+    512, 520, 528, 534, 541, 547, 553, 560, 567, 574, 580, 589, 596, 602, 610, 616,
+    622, 629, 635, 642, 648, 655, 661, 668, 675, 681, 687, 693, 700, 707, 712, 720,
+    725, 730, 738, 744, 750, 756, 762, 765, 773, 777, 784, 788, 793, 800, 805, 811,
+    816, 821, 826, 832, 836, 843, 847, 852, 856, 861, 866, 871, 875, 880, 884, 889,
+    893, 897, 901, 905, 909, 912, 917, 921, 924, 928, 932, 934, 938, 941, 944, 948,
+    951, 954, 958, 960, 963, 965, 968, 971, 973, 976, 978, 981, 984, 986, 989, 989,
+    992, 993, 996, 997, 1000, 1001, 1003, 1004, 1005, 1008, 1008, 1010, 1011, 1012, 1014, 1015,
+    1015, 1016, 1018, 1018, 1019, 1019, 1021, 1021, 1021, 1022, 1022, 1022, 1022, 1022, 1022, 1022,
+    1024,
+};
+
+static const int16_t overshoot_lut[EASE_LUT_SIZE] = {
+    0, 0, 0, 0, 0, 1, 2, 2, 3, 4, 5, 6, 8, 9, 11, 12,
+    14, 16, 18, 20, 22, 24, 26, 29, 31, 34, 37, 39, 42, 45, 48, 52,
+    55, 58, 62, 65, 69, 72, 76, 80, 84, 88, 92, 96, 100, 104, 109, 113,
+    118, 122, 127, 131, 136, 141, 146, 151, 156, 161, 166, 171, 176, 182, 187, 193,
+    198, 204, 209, 215, 221, 226, 232, 238, 244, 250, 256, 262, 268, 274, 280, 286,
+    292, 299, 305, 311, 317, 324, 330, 337, 343, 350, 356, 363, 369, 376, 382, 389,
+    396, 403, 409, 416, 423, 430, 437, 443, 450, 457, 464, 471, 477, 484, 491, 498,
+    505, 512, 519, 526, 532, 539, 546, 553, 560, 567, 574, 580, 587, 594, 601, 608,
+    615, 621, 628, 635, 642, 648, 655, 662, 669, 675, 682, 689, 695, 702, 708, 715,
+    721, 728, 734, 740, 747, 753, 759, 766, 772, 778, 784, 790, 797, 802, 808, 814,
+    820, 827, 832, 837, 843, 849, 855, 860, 866, 871, 877, 882, 887, 892, 897, 903,
+    908, 913, 918, 922, 927, 932, 937, 942, 945, 950, 955, 959, 963, 967, 971, 975,
+    980, 983, 987, 990, 995, 998, 1001, 1005, 1008, 1011, 1014, 1017, 1020, 1023, 1025, 1028,
+    1031, 1034, 1036, 1038, 1040, 1042, 1044, 1046, 1047, 1050, 1050, 1053, 1054, 1055, 1056, 1057,
+    1058, 1059, 1060, 1060, 1060, 1061, 1061, 1061, 1061, 1061, 1061, 1060, 1060, 1060, 1058, 1057,
+    1056, 1056, 1054, 1053, 1051, 1049, 1048, 1046, 1044, 1041, 1040, 1037, 1034, 1031, 1028, 1025,
+    1024,
+};
+
 /**********************
  *      MACROS
  **********************/
@@ -60,16 +149,21 @@ static void remove_anim(void * a);
 
 void lv_anim_core_init(void)
 {
-    lv_ll_init(anim_ll_p, sizeof(lv_anim_t));
     state.timer = lv_timer_create(anim_timer, LV_DEF_REFR_PERIOD, NULL);
     anim_mark_list_change(); /*Turn off the animation timer*/
-    state.anim_list_changed = false;
     state.anim_run_round = false;
 }
 
 void lv_anim_core_deinit(void)
 {
     lv_anim_delete_all();
+
+    lv_free(state.anims);
+    lv_free(state.values);
+    state.anims = NULL;
+    state.values = NULL;
+    state.anim_cnt = 0;
+    state.anim_size = 0;
 }
 
 void lv_anim_init(lv_anim_t * a)
@@ -87,11 +181,16 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
 {
     LV_TRACE_ANIM("begin");
 
-    /*Add the new animation to the animation linked list*/
-    lv_anim_t * new_anim = lv_ll_ins_head(anim_ll_p);
+    /*Add the new animation to the running animations*/
+    lv_anim_t * new_anim = lv_malloc(sizeof(lv_anim_t));
     LV_ASSERT_MALLOC(new_anim);
     if(new_anim == NULL) return NULL;
 
+    if(!anims_add(new_anim)) {
+        lv_free(new_anim);
+        return NULL;
+    }
+
     /*Initialize the animation descriptor*/
     lv_memcpy(new_anim, a, sizeof(lv_anim_t));
     if(a->var == a) new_anim->var = new_anim;
@@ -120,8 +219,6 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
         }
     }
 
-    /*Creating an animation changed the linked list.
-     *It's important if it happens in a ready callback. (see `anim_timer`)*/
     anim_mark_list_change();
 
     LV_TRACE_ANIM("finished");
@@ -144,38 +241,46 @@ uint32_t lv_anim_get_playtime(const lv_anim_t * a)
 
 bool lv_anim_delete(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
     bool del_any = false;
-    a        = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        bool del = false;
+
+    /*Removed slots remain NULL until the end of the loop, so `a->deleted_cb`
+     *can start and delete animations without disturbing the iteration*/
+    anims_iter_begin();
+    uint32_t i;
+    for(i = state.anim_cnt; i-- > 0;) {
+        lv_anim_t * a = state.anims[i];
+        if(a == NULL) continue;
         if((a->var == var || var == NULL) && (a->exec_cb == exec_cb || exec_cb == NULL)) {
-            remove_anim(a);
-            anim_mark_list_change(); /*Read by `anim_timer`. It need to know if a delete occurred in
-                                       the linked list*/
+            remove_anim(i);
             del_any = true;
-            del = true;
         }
-
-        /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
     }
+    anims_iter_end();
+
+    if(del_any) anim_mark_list_change();
 
     return del_any;
 }
 
 void lv_anim_delete_all(void)
 {
-    lv_ll_clear_custom(anim_ll_p, remove_anim);
+    anims_iter_begin();
+    uint32_t i;
+    for(i = state.anim_cnt; i-- > 0;) {
+        if(state.anims[i]) remove_anim(i);
+    }
+    anims_iter_end();
+
     anim_mark_list_change();
 }
 
 lv_anim_t * lv_anim_get(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) {
-        if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
+    /*Return the newest matching animation*/
+    uint32_t i;
+    for(i = state.anim_cnt; i-- > 0;) {
+        lv_anim_t * a = state.anims[i];
+        if(a && a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
             return a;
         }
     }
@@ -190,11 +295,7 @@ lv_timer_t * lv_anim_get_timer(void)
 
 uint16_t lv_anim_count_running(void)
 {
-    uint16_t cnt = 0;
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) cnt++;
-
-    return cnt;
+    return (uint16_t)state.anim_active_cnt;
 }
 
 uint32_t lv_anim_speed_clamped(uint32_t speed, uint32_t min_time, uint32_t max_time)
@@ -259,25 +360,26 @@ int32_t lv_anim_path_linear(const lv_anim_t * a)
 
 int32_t lv_anim_path_ease_in(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
-                                     LV_BEZIER_VAL_FLOAT(1), LV_BEZIER_VAL_FLOAT(1));
+    /*cubic-bezier(0.42, 0, 1, 1)*/
+    return anim_path_lut(a, ease_in_lut);
 }
 
 int32_t lv_anim_path_ease_out(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0),
-                                     LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+    /*cubic-bezier(0, 0, 0.58, 1)*/
+    return anim_path_lut(a, ease_out_lut);
 }
 
 int32_t lv_anim_path_ease_in_out(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
-                                     LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+    /*cubic-bezier(0.42, 0, 0.58, 1)*/
+    return anim_path_lut(a, ease_in_out_lut);
 }
 
 int32_t lv_anim_path_overshoot(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, 341, 0, 683, 1300);
+    /*cubic-bezier(341, 0, 683, 1300) in LV_BEZIER_VAL_MAX units*/
+    return anim_path_lut(a, overshoot_lut);
 }
 
 int32_t lv_anim_path_bounce(const lv_anim_t * a)
@@ -488,6 +590,9 @@ lv_anim_t * lv_anim_custom_get(lv_anim_t * a, lv_anim_custom_exec_cb_t exec_cb)
  **********************/
 /**
  * Periodically handle the animations.
+ * First the time of all the animations is stepped and their new values are computed in one pass,
+ * which calls only the path callbacks. Then the values are applied in a second pass, which calls
+ * the user callbacks that might start or delete animations.
  * @param param unused
  */
 static void anim_timer(lv_timer_t * param)
@@ -497,78 +602,93 @@ static void anim_timer(lv_timer_t * param)
     /*Flip the run round*/
     state.anim_run_round = state.anim_run_round ? false : true;
 
-    lv_anim_t * a = lv_ll_get_head(anim_ll_p);
+    anims_iter_begin();
 
-    while(a != NULL) {
-        uint32_t elaps = lv_tick_elaps(a->last_timer_run);
-        a->act_time += elaps;
+    uint32_t tick = lv_tick_get();
+    uint32_t cnt = state.anim_cnt;
+    lv_anim_t ** anims = state.anims;
+    int32_t * values = state.values;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_anim_t * a = anims[i];
+        if(a == NULL) continue;
 
-        a->last_timer_run = lv_tick_get();
+        a->act_time += tick - a->last_timer_run;
+        a->last_timer_run = tick;
 
-        /*It can be set by `lv_anim_delete()` typically in `end_cb`. If set then an animation delete
-         * happened in `anim_completed_handler` which could make this linked list reading corrupt
-         * because the list is changed meanwhile
-         */
-        state.anim_list_changed = false;
+        /*The values of the animations starting now are computed after `start_cb`*/
+        if(a->start_cb_called && a->act_time >= 0) {
+            if(a->act_time > a->duration) a->act_time = a->duration;
+            values[i] = anim_path_value(a);
+        }
+    }
 
-        if(a->run_round != state.anim_run_round) {
-            a->run_round = state.anim_run_round; /*The list readying might be reset so need to know which anim has run already*/
+    /*`state.anims` might be reallocated and animations might be started or deleted
+     *by the callbacks, so always read the current values from `state`.
+     *The animations started meanwhile are added to the end, after the first visited slot.*/
+    for(i = state.anim_cnt; i-- > 0;) {
+        lv_anim_t * a = state.anims[i];
+        if(a == NULL) continue;
+        if(a->run_round == state.anim_run_round) continue;
 
-            /*The animation will run now for the first time. Call `start_cb`*/
-            if(!a->start_cb_called && a->act_time >= 0) {
+        a->run_round = state.anim_run_round; /*The same anim might be visited by a nested call*/
+        bool computed = a->start_cb_called && a->act_time >= 0 && i < cnt;
 
-                if(a->early_apply == 0 && a->get_value_cb) {
-                    int32_t v_ofs = a->get_value_cb(a);
-                    a->start_value += v_ofs;
-                    a->end_value += v_ofs;
-                }
+        /*The animation will run now for the first time. Call `start_cb`*/
+        if(!a->start_cb_called && a->act_time >= 0) {
 
-                resolve_time(a);
+            if(a->early_apply == 0 && a->get_value_cb) {
+                int32_t v_ofs = a->get_value_cb(a);
+                a->start_value += v_ofs;
+                a->end_value += v_ofs;
+            }
 
-                if(a->start_cb) a->start_cb(a);
-                a->start_cb_called = 1;
+            resolve_time(a);
 
-                /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
-                remove_concurrent_anims(a);
-            }
+            if(a->start_cb) a->start_cb(a);
+            if(state.anims[i] != a) continue;   /*Deleted in `start_cb`*/
+            a->start_cb_called = 1;
 
-            if(a->act_time >= 0) {
-                if(a->act_time > a->duration) a->act_time = a->duration;
+            /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
+            remove_concurrent_anims(a);
+        }
 
-                int32_t new_value;
-                new_value = a->path_cb(a);
+        if(a->act_time >= 0) {
+            int32_t new_value;
+            if(computed) {
+                new_value = state.values[i];
+            }
+            else {
+                if(a->act_time > a->duration) a->act_time = a->duration;
+                new_value = anim_path_value(a);
+            }
 
-                if(new_value != a->current_value) {
-                    a->current_value = new_value;
-                    /*Apply the calculated value*/
-                    if(a->exec_cb) a->exec_cb(a->var, new_value);
-                    if(!state.anim_list_changed && a->custom_exec_cb) a->custom_exec_cb(a, new_value);
-                }
+            if(new_value != a->current_value) {
+                a->current_value = new_value;
+                /*Apply the calculated value*/
+                if(a->exec_cb) a->exec_cb(a->var, new_value);
+                if(state.anims[i] == a && a->custom_exec_cb) a->custom_exec_cb(a, new_value);
+            }
 
-                /*If the time is elapsed the animation is ready*/
-                if(!state.anim_list_changed && a->act_time >= a->duration) {
-                    anim_completed_handler(a);
-                }
+            /*If the time is elapsed the animation is ready*/
+            if(state.anims[i] == a && a->act_time >= a->duration) {
+                anim_completed_handler(i);
             }
         }
-
-        /*If the linked list changed due to anim. delete then it's not safe to continue
-         *the reading of the list from here -> start from the head*/
-        if(state.anim_list_changed)
-            a = lv_ll_get_head(anim_ll_p);
-        else
-            a = lv_ll_get_next(anim_ll_p, a);
     }
 
+    anims_iter_end();
 }
 
 /**
  * Called when an animation is completed to do the necessary things
  * e.g. repeat, play back, delete etc.
- * @param a pointer to an animation descriptor
+ * @param index index of the animation in `state.anims`
  */
-static void anim_completed_handler(lv_anim_t * a)
+static void anim_completed_handler(uint32_t index)
 {
+    lv_anim_t * a = state.anims[index];
+
     /*In the end of a forward anim decrement repeat cnt.*/
     if(a->playback_now == 0 && a->repeat_cnt > 0 && a->repeat_cnt != LV_ANIM_REPEAT_INFINITE) {
         a->repeat_cnt--;
@@ -579,10 +699,11 @@ static void anim_completed_handler(lv_anim_t * a)
      * - no repeat, play back is enabled and play back is ready*/
     if(a->repeat_cnt == 0 && (a->playback_duration == 0 || a->playback_now == 1)) {
 
-        /*Delete the animation from the list.
+        /*Delete the animation from the running animations.
          * This way the `completed_cb` will see the animations like it's animation is already deleted*/
-        lv_ll_remove(anim_ll_p, a);
-        /*Flag that the list has changed*/
+        state.anims[index] = NULL;
+        state.anim_active_cnt--;
+        state.anim_removed = true;
         anim_mark_list_change();
 
         /*Call the callback function at the end*/
@@ -614,8 +735,7 @@ static void anim_completed_handler(lv_anim_t * a)
 
 static void anim_mark_list_change(void)
 {
-    state.anim_list_changed = true;
-    if(lv_ll_get_head(anim_ll_p) == NULL)
+    if(state.anim_active_cnt == 0)
         lv_timer_pause(state.timer);
     else
         lv_timer_resume(state.timer);
@@ -635,6 +755,48 @@ static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1, int32_
     return new_value;
 }
 
+/**
+ * Get the value of an animation on a built-in bezier path from its samples
+ * @param a     pointer to an animation
+ * @param lut   EASE_LUT_SIZE samples of the path
+ * @return      the current value
+ */
+static int32_t anim_path_lut(const lv_anim_t * a, const int16_t * lut)
+{
+    /*Calculate the current step*/
+    uint32_t t = lv_map(a->act_time, 0, a->duration, 0, LV_BEZIER_VAL_MAX);
+    uint32_t i = t >> EASE_LUT_SHIFT;
+    int32_t step = lut[i];
+
+    /*Interpolate between the neighboring samples*/
+    uint32_t frac = t & ((1 << EASE_LUT_SHIFT) - 1);
+    if(frac) step += ((lut[i + 1] - lut[i]) * (int32_t)frac) >> EASE_LUT_SHIFT;
+
+    int32_t new_value;
+    new_value = step * (a->end_value - a->start_value);
+    new_value = new_value >> LV_BEZIER_VAL_SHIFT;
+    new_value += a->start_value;
+
+    return new_value;
+}
+
+/**
+ * Get the current value of an animation. The built-in paths are called directly
+ * to avoid the indirect call in the stepping loop.
+ * @param a     pointer to an animation
+ * @return      the current value
+ */
+static int32_t anim_path_value(const lv_anim_t * a)
+{
+    lv_anim_path_cb_t path_cb = a->path_cb;
+    if(path_cb == lv_anim_path_linear) return lv_anim_path_linear(a);
+    if(path_cb == lv_anim_path_ease_out) return anim_path_lut(a, ease_out_lut);
+    if(path_cb == lv_anim_path_ease_in_out) return anim_path_lut(a, ease_in_out_lut);
+    if(path_cb == lv_anim_path_ease_in) return anim_path_lut(a, ease_in_lut);
+    if(path_cb == lv_anim_path_overshoot) return anim_path_lut(a, overshoot_lut);
+    return path_cb(a);
+}
+
 static uint32_t convert_speed_to_time(uint32_t speed_or_time, int32_t start, int32_t end)
 {
     /*It was a simple time*/
@@ -667,41 +829,95 @@ static bool remove_concurrent_anims(lv_anim_t * a_current)
 {
     if(a_current->exec_cb == NULL && a_current->custom_exec_cb == NULL) return false;
 
-    lv_anim_t * a;
     bool del_any = false;
-    a = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        bool del = false;
+    anims_iter_begin();
+    uint32_t i;
+    for(i = state.anim_cnt; i-- > 0;) {
+        lv_anim_t * a = state.anims[i];
         /*We can't test for custom_exec_cb equality because in the MicroPython binding
          *a wrapper callback is used here an the real callback data is stored in the `user_data`.
          *Therefore equality check would remove all animations.*/
-        if(a != a_current &&
+        if(a != NULL && a != a_current &&
            (a->act_time >= 0 || a->early_apply) &&
            (a->var == a_current->var) &&
            ((a->exec_cb && a->exec_cb == a_current->exec_cb)
             /*|| (a->custom_exec_cb && a->custom_exec_cb == a_current->custom_exec_cb)*/)) {
-            lv_ll_remove(anim_ll_p, a);
-            if(a->deleted_cb != NULL) a->deleted_cb(a);
-            lv_free(a);
-            /*Read by `anim_timer`. It need to know if a delete occurred in the linked list*/
-            anim_mark_list_change();
-
+            remove_anim(i);
             del_any = true;
-            del = true;
         }
-
-        /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
     }
+    anims_iter_end();
+
+    if(del_any) anim_mark_list_change();
 
     return del_any;
 }
 
-static void remove_anim(void * a)
+/**
+ * Remove an animation, call its `deleted_cb` and free it
+ * @param index index of the animation in `state.anims`
+ */
+static void remove_anim(uint32_t index)
 {
-    lv_anim_t * anim = a;
-    lv_ll_remove(anim_ll_p, a);
+    lv_anim_t * anim = state.anims[index];
+    state.anims[index] = NULL;
+    state.anim_active_cnt--;
+    state.anim_removed = true;
+
     if(anim->deleted_cb != NULL) anim->deleted_cb(anim);
-    lv_free(a);
+    lv_free(anim);
+}
+
+/**
+ * Add an animation to the end of the running animations
+ * @param a     pointer to an allocated animation
+ * @return      true: success; false: out of memory
+ */
+static bool anims_add(lv_anim_t * a)
+{
+    if(state.anim_cnt == state.anim_size) {
+        uint32_t new_size = state.anim_size ? state.anim_size * 2 : 8;
+        lv_anim_t ** new_anims = lv_realloc(state.anims, new_size * sizeof(lv_anim_t *));
+        LV_ASSERT_MALLOC(new_anims);
+        if(new_anims == NULL) return false;
+        state.anims = new_anims;
+
+        int32_t * new_values = lv_realloc(state.values, new_size * sizeof(int32_t));
+        LV_ASSERT_MALLOC(new_values);
+        if(new_values == NULL) return false;
+        state.values = new_values;
+
+        state.anim_size = new_size;
+    }
+
+    state.anims[state.anim_cnt] = a;
+    state.anim_cnt++;
+    state.anim_active_cnt++;
+    return true;
+}
+
+/**
+ * Start a loop over `state.anims`. Until the matching `anims_iter_end()` the removed
+ * animations leave NULL slots behind, so the indices of the other animations don't change.
+ */
+static void anims_iter_begin(void)
+{
+    state.iter_depth++;
+}
+
+/**
+ * End a loop over `state.anims` and drop the NULL slots if no other loop is running
+ */
+static void anims_iter_end(void)
+{
+    state.iter_depth--;
+    if(state.iter_depth > 0 || !state.anim_removed) return;
+
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < state.anim_cnt; i++) {
+        if(state.anims[i]) state.anims[cnt++] = state.anims[i];
+    }
+    state.anim_cnt = cnt;
+    state.anim_removed = false;
 }
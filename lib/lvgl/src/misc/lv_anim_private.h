@@ -25,10 +25,16 @@ extern "C" {
  **********************/
 
 typedef struct {
-    bool anim_list_changed;
     bool anim_run_round;
+    bool anim_removed;          /**< An animation was removed, `anims` has free slots*/
+    uint32_t iter_depth;        /**< Number of loops iterating over `anims`. It's compacted only if 0*/
     lv_timer_t * timer;
-    lv_ll_t anim_ll;
+    lv_anim_t ** anims;         /**< The running animations, the newest last. Removed ones are NULL until compacted.
+                                 *   Loops go backward, so the newest animation is found and run first*/
+    int32_t * values;           /**< The values computed for `anims` in the current round*/
+    uint32_t anim_cnt;          /**< Number of used slots in `anims` and `values`*/
+    uint32_t anim_size;         /**< Number of allocated slots in `anims` and `values`*/
+    uint32_t anim_active_cnt;   /**< Number of not NULL slots in `anims`*/
 } lv_anim_state_t;
 
 /**********************
@@ -11,6 +11,7 @@
 #include "../stdlib/lv_mem.h"
 #include "lv_assert.h"
 #include "lv_types.h"
+#include "lv_math.h"
 
 /*********************
  *      DEFINES
@@ -27,6 +28,9 @@
  *  STATIC PROTOTYPES
  **********************/
 
+static uint64_t event_code_mask(uint32_t code);
+static void update_code_mask(lv_event_list_t * list);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -64,9 +68,12 @@ lv_result_t lv_event_send(lv_event_list_t * list, lv_event_t * e, bool preproces
 {
     if(list == NULL) return LV_RESULT_OK;
 
+    /*Most of the events (e.g. drawing and cover check) have no callbacks, skip them quickly*/
+    if((list->code_mask & event_code_mask(e->code)) == 0) return LV_RESULT_OK;
+
     uint32_t i = 0;
-    lv_event_dsc_t ** dsc = lv_array_front(list);
-    uint32_t size = lv_array_size(list);
+    lv_event_dsc_t ** dsc = lv_array_front(&list->array);
+    uint32_t size = lv_array_size(&list->array);
     for(i = 0; i < size; i++) {
         if(dsc[i]->cb == NULL) continue;
         bool is_preprocessed = (dsc[i]->filter & LV_EVENT_PREPROCESS) != 0;
@@ -95,12 +102,13 @@ lv_event_dsc_t * lv_event_add(lv_event_list_t * list, lv_event_cb_t cb, lv_event
     dsc->filter = filter;
     dsc->user_data = user_data;
 
-    if(lv_array_size(list) == 0) {
+    if(lv_array_size(&list->array) == 0) {
         /*event list hasn't been initialized.*/
-        lv_array_init(list, 1, sizeof(lv_event_dsc_t *));
+        lv_array_init(&list->array, 1, sizeof(lv_event_dsc_t *));
     }
 
-    lv_array_push_back(list, &dsc);
+    lv_array_push_back(&list->array, &dsc);
+    list->code_mask |= event_code_mask(filter);
     return dsc;
 }
 
@@ -109,12 +117,13 @@ bool lv_event_remove_dsc(lv_event_list_t * list, lv_event_dsc_t * dsc)
     LV_ASSERT_NULL(list);
     LV_ASSERT_NULL(dsc);
 
-    int size = lv_array_size(list);
-    lv_event_dsc_t ** events = lv_array_front(list);
+    int size = lv_array_size(&list->array);
+    lv_event_dsc_t ** events = lv_array_front(&list->array);
     for(int i = 0; i < size; i++) {
         if(events[i] == dsc) {
             lv_free(dsc);
-            lv_array_remove(list, i);
+            lv_array_remove(&list->array, i);
+            update_code_mask(list);
             return true;
         }
     }
@@ -125,14 +134,14 @@ bool lv_event_remove_dsc(lv_event_list_t * list, lv_event_dsc_t * dsc)
 uint32_t lv_event_get_count(lv_event_list_t * list)
 {
     LV_ASSERT_NULL(list);
-    return lv_array_size(list);
+    return lv_array_size(&list->array);
 }
 
 lv_event_dsc_t * lv_event_get_dsc(lv_event_list_t * list, uint32_t index)
 {
     LV_ASSERT_NULL(list);
     lv_event_dsc_t ** dsc;
-    dsc = lv_array_at(list, index);
+    dsc = lv_array_at(&list->array, index);
     return dsc ? *dsc : NULL;
 }
 
@@ -154,18 +163,21 @@ bool lv_event_remove(lv_event_list_t * list, uint32_t index)
     LV_ASSERT_NULL(list);
     lv_event_dsc_t * dsc = lv_event_get_dsc(list, index);
     lv_free(dsc);
-    return lv_array_remove(list, index);
+    bool res = lv_array_remove(&list->array, index);
+    update_code_mask(list);
+    return res;
 }
 
 void lv_event_remove_all(lv_event_list_t * list)
 {
     LV_ASSERT_NULL(list);
-    int size = lv_array_size(list);
-    lv_event_dsc_t ** dsc = lv_array_front(list);
+    int size = lv_array_size(&list->array);
+    lv_event_dsc_t ** dsc = lv_array_front(&list->array);
     for(int i = 0; i < size; i++) {
         lv_free(dsc[i]);
     }
-    lv_array_deinit(list);
+    lv_array_deinit(&list->array);
+    list->code_mask = 0;
 }
 
 void * lv_event_get_current_target(lv_event_t * e)
@@ -222,3 +234,31 @@ void lv_event_mark_deleted(void * target)
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+/**
+ * Get the bit of an event code in `lv_event_list_t::code_mask`
+ * @param code  an event code or a filter, optionally with `LV_EVENT_PREPROCESS`
+ * @return      the bit of the code, or all the bits for `LV_EVENT_ALL`
+ */
+static uint64_t event_code_mask(uint32_t code)
+{
+    code &= ~LV_EVENT_PREPROCESS;
+    if(code == LV_EVENT_ALL) return UINT64_MAX;
+    return (uint64_t)1 << LV_MIN(code, 63);
+}
+
+/**
+ * Recalculate the code mask of an event list after removing a descriptor
+ * @param list  pointer to an event list
+ */
+static void update_code_mask(lv_event_list_t * list)
+{
+    uint64_t mask = 0;
+    uint32_t size = lv_array_size(&list->array);
+    lv_event_dsc_t ** dsc = lv_array_front(&list->array);
+    uint32_t i;
+    for(i = 0; i < size; i++) {
+        mask |= event_code_mask(dsc[i]->filter);
+    }
+    list->code_mask = mask;
+}
@@ -113,7 +113,11 @@ typedef enum {
                                       before the class default event processing */
 } lv_event_code_t;
 
-typedef lv_array_t lv_event_list_t;
+typedef struct {
+    lv_array_t array;       /**< Pointers to the `lv_event_dsc_t`s*/
+    uint64_t code_mask;     /**< A bit for every event code with a descriptor. Bit 63 stands for all the
+                             *   codes above 62, and `LV_EVENT_ALL` sets all the bits*/
+} lv_event_list_t;
 
 /**
  * @brief Event callback.
@@ -302,6 +302,36 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos)
     return res;
 }
 
+lv_fs_res_t lv_fs_map(lv_fs_file_t * file_p, lv_fs_map_t * map)
+{
+    lv_memzero(map, sizeof(lv_fs_map_t));
+    if(file_p->drv == NULL) return LV_FS_RES_INV_PARAM;
+    if(file_p->drv->map_cb == NULL || file_p->drv->unmap_cb == NULL) return LV_FS_RES_NOT_IMP;
+
+    LV_PROFILER_BEGIN;
+
+    uint32_t size = 0;
+    const void * data = file_p->drv->map_cb(file_p->drv, file_p->file_d, &size);
+
+    LV_PROFILER_END;
+
+    if(data == NULL) return LV_FS_RES_NOT_IMP;
+
+    map->data = data;
+    map->size = size;
+    map->drv = file_p->drv;
+
+    return LV_FS_RES_OK;
+}
+
+void lv_fs_unmap(lv_fs_map_t * map)
+{
+    if(map->data == NULL) return;
+
+    map->drv->unmap_cb(map->drv, map->data, map->size);
+    lv_memzero(map, sizeof(lv_fs_map_t));
+}
+
 lv_fs_res_t lv_fs_dir_open(lv_fs_dir_t * rddir_p, const char * path)
 {
     if(path == NULL) return LV_FS_RES_INV_PARAM;
@@ -82,6 +82,11 @@ struct lv_fs_drv_t {
     lv_fs_res_t (*dir_read_cb)(lv_fs_drv_t * drv, void * rddir_p, char * fn, uint32_t fn_len);
     lv_fs_res_t (*dir_close_cb)(lv_fs_drv_t * drv, void * rddir_p);
 
+    /** Optional: map the whole file read-only into memory and store its size in `size`.
+     *  Return NULL if the file can't be mapped. The mapping must stay valid after the file is closed.*/
+    const void * (*map_cb)(lv_fs_drv_t * drv, void * file_p, uint32_t * size);
+    void (*unmap_cb)(lv_fs_drv_t * drv, const void * data, uint32_t size);
+
     void * user_data; /**< Custom file user data*/
 };
 
@@ -97,6 +102,13 @@ typedef struct {
     lv_fs_drv_t * drv;
 } lv_fs_dir_t;
 
+/** Read-only view of a whole file created by `lv_fs_map()`*/
+typedef struct {
+    const void * data;  /**< Content of the file, NULL if not mapped*/
+    uint32_t size;      /**< Size of the file in bytes*/
+    lv_fs_drv_t * drv;  /**< The driver which created the mapping*/
+} lv_fs_map_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -194,6 +206,22 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
  */
 lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos);
 
+/**
+ * Map the whole content of an opened file into memory, so it can be used without reading it to a buffer.
+ * The mapping stays valid after the file is closed, until `lv_fs_unmap()` is called.
+ * @param file_p    pointer to a lv_fs_file_t variable opened with `LV_FS_MODE_RD`
+ * @param map       pointer to a lv_fs_map_t variable to initialize
+ * @return          LV_FS_RES_OK; LV_FS_RES_NOT_IMP if the driver can't map files
+ *                  or any error from lv_fs_res_t enum
+ */
+lv_fs_res_t lv_fs_map(lv_fs_file_t * file_p, lv_fs_map_t * map);
+
+/**
+ * Release a mapping created by `lv_fs_map()`. Does nothing if the map is not initialized.
+ * @param map       pointer to a lv_fs_map_t variable
+ */
+void lv_fs_unmap(lv_fs_map_t * map);
+
 /**
  * Initialize a 'fs_dir_t' variable for directory reading
  * @param rddir_p   pointer to a 'lv_fs_dir_t' variable
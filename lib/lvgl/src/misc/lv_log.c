@@ -15,6 +15,7 @@
 #include "../stdlib/lv_string.h"
 #include "../tick/lv_tick.h"
 #include "../core/lv_global.h"
+#include "../osal/lv_os.h"
 
 #if LV_LOG_PRINTF
     #include <stdio.h>
@@ -28,6 +29,35 @@
 #endif
 #define custom_print_cb LV_GLOBAL_DEFAULT()->custom_log_print_cb
 
+#if LV_LOG_DEFERRED
+    #define log_ring LV_GLOBAL_DEFAULT()->log_ring
+    #define log_ring_head LV_GLOBAL_DEFAULT()->log_ring_head
+    #define log_ring_tail LV_GLOBAL_DEFAULT()->log_ring_tail
+    #define log_ring_ready LV_GLOBAL_DEFAULT()->log_ring_ready
+    #define log_dropped_cnt LV_GLOBAL_DEFAULT()->log_dropped_cnt
+    #define log_dropped_pending LV_GLOBAL_DEFAULT()->log_dropped_pending
+
+    #define LOG_RECORD_MAGIC        (0xA0 + sizeof(void *))
+    #define LOG_RECORD_HEADER_SIZE  (12 + 3 * sizeof(void *))
+    #define LOG_RECORD_ARGS_MAX     255
+
+    /*With atomics the records are added without a lock: the space is reserved by moving the head and
+     *the first byte of the record is written last to mark it complete.*/
+    #if defined(__GNUC__)
+        #define LOG_RING_LOCK_FREE 1
+        #define LOG_RING_BARRIER() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+        #define LOG_RING_LOAD(p) __atomic_load_n(p, __ATOMIC_ACQUIRE)
+        #define LOG_RING_STORE(p, v) __atomic_store_n(p, v, __ATOMIC_RELEASE)
+        #define LOG_RING_CAS(p, expected, desired) \
+            __atomic_compare_exchange_n(p, expected, desired, true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+        #define LOG_RING_ADD(p, v) __atomic_fetch_add(p, v, __ATOMIC_RELAXED)
+        #define LOG_RING_TAKE(p) __atomic_exchange_n(p, 0, __ATOMIC_RELAXED)
+    #else
+        #define LOG_RING_LOCK_FREE 0
+        #define LOG_RING_BARRIER()
+    #endif
+#endif
+
 #if LV_LOG_USE_TIMESTAMP
     #define LOG_TIMESTAMP_FMT  "\t(%" LV_PRIu32 ".%03" LV_PRIu32 ", +%" LV_PRIu32 ")\t"
     #define LOG_TIMESTAMP_EXPR t / 1000, t % 1000, t - last_log_time,
@@ -51,6 +81,12 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_LOG_DEFERRED
+    static void log_deferred_add(lv_log_level_t level, const char * file, int line, const char * func,
+                                 const char * format, va_list args);
+    static uint32_t log_encode_args(uint8_t * buf, const char * format, va_list args);
+    static void log_ring_push(uint8_t * data, uint32_t size);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -77,6 +113,12 @@ void lv_log_add(lv_log_level_t level, const char * file, int line, const char *
         va_list args;
         va_start(args, format);
 
+#if LV_LOG_DEFERRED
+        log_deferred_add(level, file, line, func, format, args);
+        va_end(args);
+        return;
+#endif
+
 #if LV_LOG_USE_FILE_LINE
         /*Use only the file name not the path*/
         size_t p;
@@ -126,7 +168,9 @@ void lv_log(const char * format, ...)
     va_list args;
     va_start(args, format);
 
-#if LV_LOG_PRINTF
+#if LV_LOG_DEFERRED
+    log_deferred_add(LV_LOG_LEVEL_NONE, NULL, 0, NULL, format, args);
+#elif LV_LOG_PRINTF
     vprintf(format, args);
 #else
     if(custom_print_cb) {
@@ -139,8 +183,240 @@ void lv_log(const char * format, ...)
     va_end(args);
 }
 
+#if LV_LOG_DEFERRED
+
+uint32_t lv_log_deferred_drain(lv_log_deferred_write_cb_t write_cb)
+{
+    uint32_t written_sum = 0;
+    uint32_t tail = log_ring_tail;
+#if LOG_RING_LOCK_FREE
+    /*The records can be completed in any order, so pass only the complete ones from the tail*/
+    uint32_t ready = log_ring_ready;
+    uint32_t head = LOG_RING_LOAD(&log_ring_head);
+    while(ready != head && LOG_RING_LOAD(&log_ring[ready]) == LOG_RECORD_MAGIC) {
+        uint32_t args_size = log_ring[(ready + 2) % LV_LOG_DEFERRED_BUF_SIZE];
+        ready = (ready + LOG_RECORD_HEADER_SIZE + args_size) % LV_LOG_DEFERRED_BUF_SIZE;
+    }
+    log_ring_ready = ready;
+#else
+    uint32_t ready = log_ring_head;
+#endif
+
+    while(tail != ready) {
+        /*Write the continuous part, then the wrapped around part*/
+        uint32_t size = ready > tail ? ready - tail : LV_LOG_DEFERRED_BUF_SIZE - tail;
+        uint32_t written = write_cb(&log_ring[tail], size);
+#if LOG_RING_LOCK_FREE
+        /*Keep the free space zeroed, so a reserved but not yet written record doesn't look complete*/
+        lv_memzero(&log_ring[tail], written);
+#endif
+        tail = (tail + written) % LV_LOG_DEFERRED_BUF_SIZE;
+        LOG_RING_BARRIER();
+        log_ring_tail = tail;
+        written_sum += written;
+        if(written < size) break;
+    }
+
+    return written_sum;
+}
+
+uint32_t lv_log_deferred_get_dropped_count(void)
+{
+    return log_dropped_cnt;
+}
+
+#endif /*LV_LOG_DEFERRED*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_LOG_DEFERRED
+
+static void log_deferred_add(lv_log_level_t level, const char * file, int line, const char * func,
+                             const char * format, va_list args)
+{
+    uint8_t record[LOG_RECORD_HEADER_SIZE + LOG_RECORD_ARGS_MAX];
+    uint32_t args_size = log_encode_args(&record[LOG_RECORD_HEADER_SIZE], format, args);
+
+    uint32_t t = lv_tick_get();
+    uint32_t line_u32 = line;
+    const void * ptrs[3] = {format, file, func};
+    record[0] = LOG_RECORD_MAGIC;
+    record[1] = (uint8_t)level;
+    record[2] = (uint8_t)args_size;
+    lv_memcpy(&record[4], &t, sizeof(t));
+    lv_memcpy(&record[8], &line_u32, sizeof(line_u32));
+    lv_memcpy(&record[12], ptrs, sizeof(ptrs));
+
+#if LV_USE_OS != LV_OS_NONE && !LOG_RING_LOCK_FREE
+    /*Without atomics the ring has a single producer, but any thread can log. The lock is recursive,
+     *so the LVGL thread can log while holding it. It's created in `lv_init()`, before that there is
+     *only one thread.*/
+    bool locked = LV_GLOBAL_DEFAULT()->inited;
+    if(locked) lv_lock();
+#endif
+
+    log_ring_push(record, LOG_RECORD_HEADER_SIZE + args_size);
+
+#if LV_USE_OS != LV_OS_NONE && !LOG_RING_LOCK_FREE
+    if(locked) lv_unlock();
+#endif
+}
+
+/**
+ * Copy the arguments of a log as they are, without formatting them.
+ * The size of each argument is found from the conversion specifiers of the format string.
+ * Stops at unknown conversions and at the arguments which don't fit.
+ * @param buf       store the arguments here, it has `LOG_RECORD_ARGS_MAX` bytes
+ * @param format    printf-like format string
+ * @param args      the arguments of `format`
+ * @return          the number of bytes used in `buf`
+ */
+static uint32_t log_encode_args(uint8_t * buf, const char * format, va_list args)
+{
+    uint32_t size = 0;
+    const char * p = format;
+
+/*Copy a value of `type` read from `args` if it fits*/
+#define LOG_ARG(type)                                               \
+    do {                                                            \
+        type v = va_arg(args, type);                                \
+        if(size + sizeof(v) > LOG_RECORD_ARGS_MAX) return size;     \
+        lv_memcpy(&buf[size], &v, sizeof(v));                       \
+        size += sizeof(v);                                          \
+    } while(0)
+
+    while(*p) {
+        if(*p++ != '%') continue;
+        if(*p == '%') {
+            p++;
+            continue;
+        }
+
+        /*Flags, width and precision. '*' takes an int from the arguments*/
+        while(*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0') p++;
+        while((*p >= '0' && *p <= '9') || *p == '.' || *p == '*') {
+            if(*p == '*') LOG_ARG(int);
+            p++;
+        }
+
+        /*Length*/
+        char length = 0;
+        if(*p == 'h' || *p == 'l' || *p == 'z' || *p == 'j' || *p == 't' || *p == 'L') {
+            length = *p++;
+            if((length == 'h' && *p == 'h') || (length == 'l' && *p == 'l')) {
+                if(length == 'l') length = 'q';
+                p++;
+            }
+        }
+
+        switch(*p++) {
+            case 'd':
+            case 'i':
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+                if(length == 'l') LOG_ARG(long);
+                else if(length == 'q' || length == 'j') LOG_ARG(long long);
+                else if(length == 'z' || length == 't') LOG_ARG(size_t);
+                else LOG_ARG(int);
+                break;
+            case 'c':
+                LOG_ARG(int);
+                break;
+            case 'p':
+                LOG_ARG(void *);
+                break;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+                if(length == 'L') {
+                    double v = (double)va_arg(args, long double);
+                    if(size + sizeof(v) > LOG_RECORD_ARGS_MAX) return size;
+                    lv_memcpy(&buf[size], &v, sizeof(v));
+                    size += sizeof(v);
+                }
+                else LOG_ARG(double);
+                break;
+            case 's': {
+                    /*The string can be temporary so copy it, truncated if needed*/
+                    const char * s = va_arg(args, const char *);
+                    if(s == NULL) s = "(null)";
+                    if(size + 1 > LOG_RECORD_ARGS_MAX) return size;
+                    uint32_t len = LV_MIN(lv_strlen(s), LOG_RECORD_ARGS_MAX - size - 1);
+                    lv_memcpy(&buf[size], s, len);
+                    buf[size + len] = '\0';
+                    size += len + 1;
+                    break;
+                }
+            default:
+                return size;
+        }
+    }
+
+#undef LOG_ARG
+
+    return size;
+}
+
+/**
+ * Add a record to the ring buffer or drop it if there is not enough free space.
+ * One byte is always left free to tell a full buffer from an empty one.
+ * With `LOG_RING_LOCK_FREE` any thread or interrupt can push at the same time: the space is reserved
+ * by moving the head and the record is marked complete by writing its first byte last. Otherwise only
+ * one thread can push at a time, `log_deferred_add()` takes care of it.
+ * @param data      the record, its number of dropped records before it is set here
+ * @param size      size of the record in bytes
+ */
+static void log_ring_push(uint8_t * data, uint32_t size)
+{
+#if LOG_RING_LOCK_FREE
+    uint32_t head = LOG_RING_LOAD(&log_ring_head);
+    do {
+        uint32_t tail = LOG_RING_LOAD(&log_ring_tail);
+        uint32_t free_size = (tail + LV_LOG_DEFERRED_BUF_SIZE - head - 1) % LV_LOG_DEFERRED_BUF_SIZE;
+        if(size > free_size) {
+            LOG_RING_ADD(&log_dropped_cnt, 1);
+            LOG_RING_ADD(&log_dropped_pending, 1);
+            return;
+        }
+    } while(!LOG_RING_CAS(&log_ring_head, &head, (head + size) % LV_LOG_DEFERRED_BUF_SIZE));
+
+    uint32_t dropped = LOG_RING_LOAD(&log_dropped_pending) ? LOG_RING_TAKE(&log_dropped_pending) : 0;
+    data[3] = (uint8_t)LV_MIN(dropped, 255);
+
+    /*The first byte is the magic number, written when the rest is there*/
+    uint32_t first = LV_MIN(size, LV_LOG_DEFERRED_BUF_SIZE - head);
+    lv_memcpy(&log_ring[head + 1], data + 1, first - 1);
+    lv_memcpy(&log_ring[0], data + first, size - first);
+    LOG_RING_STORE(&log_ring[head], data[0]);
+#else
+    uint32_t head = log_ring_head;
+    uint32_t tail = log_ring_tail;
+    uint32_t free_size = (tail + LV_LOG_DEFERRED_BUF_SIZE - head - 1) % LV_LOG_DEFERRED_BUF_SIZE;
+    if(size > free_size) {
+        log_dropped_cnt++;
+        log_dropped_pending++;
+        return;
+    }
+
+    data[3] = (uint8_t)LV_MIN(log_dropped_pending, 255);
+    uint32_t first = LV_MIN(size, LV_LOG_DEFERRED_BUF_SIZE - head);
+    lv_memcpy(&log_ring[head], data, first);
+    lv_memcpy(&log_ring[0], data + first, size - first);
+
+    /*Publish the record only when it's completely written*/
+    LOG_RING_BARRIER();
+    log_ring_head = (head + size) % LV_LOG_DEFERRED_BUF_SIZE;
+    log_dropped_pending = 0;
+#endif
+}
+
+#endif /*LV_LOG_DEFERRED*/
+
 #endif /*LV_USE_LOG*/
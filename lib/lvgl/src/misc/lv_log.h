@@ -59,6 +59,12 @@ typedef int8_t lv_log_level_t;
  */
 typedef void (*lv_log_print_g_cb_t)(lv_log_level_t level, const char * buf);
 
+/**
+ * Writer of the deferred log records. It shouldn't block but accept only as many bytes as it can take now.
+ * Returns the number of bytes written from `data`.
+ */
+typedef uint32_t (*lv_log_deferred_write_cb_t)(const void * data, uint32_t size);
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -91,6 +97,32 @@ void lv_log(const char * format, ...) LV_FORMAT_ATTRIBUTE(1, 2);
 void lv_log_add(lv_log_level_t level, const char * file, int line,
                 const char * func, const char * format, ...) LV_FORMAT_ATTRIBUTE(5, 6);
 
+#if LV_LOG_DEFERRED
+
+/**
+ * Pass the stored log records to a writer. Call it when there is nothing else to do, e.g. after `lv_timer_handler()`.
+ * The records are binary and have to be formatted by a host tool:
+ * - header: 0xA0 + pointer size, level (`LV_LOG_LEVEL_NONE` for `lv_log()`), size of the arguments,
+ *   number of records dropped before this one (max. 255), `lv_tick_get()` and line number as `uint32_t`,
+ *   the addresses of the format string, the file name and the function name as pointers
+ * - the arguments as they were passed (`int`, `long`, `double`, pointer, etc., following the format string)
+ *   and the strings copied with their terminating 0
+ * The values are stored in the byte order of the target.
+ * Any thread or interrupt may add logs while draining (with GCC and Clang, see `LV_LOG_DEFERRED`),
+ * but only one may drain them at a time.
+ * @param write_cb  called with the stored bytes until it accepts less than it got
+ * @return          the number of bytes written
+ */
+uint32_t lv_log_deferred_drain(lv_log_deferred_write_cb_t write_cb);
+
+/**
+ * Get the number of log records which were dropped because the ring buffer was full.
+ * @return          the number of dropped records since `lv_init()`
+ */
+uint32_t lv_log_deferred_get_dropped_count(void);
+
+#endif /*LV_LOG_DEFERRED*/
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,549 @@
+/**
+ * @file lv_profiler_bin.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_profiler_bin_private.h"
+#include "../lvgl.h"
+#include "../core/lv_global.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#if LV_USE_PROFILER && LV_USE_PROFILER_BIN
+
+#define profiler_ctx LV_GLOBAL_DEFAULT()->profiler_bin_context
+
+#define LV_PROFILER_BIN_MAGIC       "LVPB"
+#define LV_PROFILER_BIN_VERSION     2
+#define LV_PROFILER_BIN_TAG_UNKNOWN 0xFFFF
+
+#if (LV_PROFILER_BIN_TAG_MAX & (LV_PROFILER_BIN_TAG_MAX - 1)) != 0 || LV_PROFILER_BIN_TAG_MAX > 32768
+    #error "LV_PROFILER_BIN_TAG_MAX must be a power of 2 and not larger than 32768"
+#endif
+
+#if LV_USE_OS
+    #define LV_PROFILER_MULTEX_INIT   lv_mutex_init(&profiler_ctx->mutex)
+    #define LV_PROFILER_MULTEX_DEINIT lv_mutex_delete(&profiler_ctx->mutex)
+    #define LV_PROFILER_MULTEX_LOCK   lv_mutex_lock(&profiler_ctx->mutex)
+    #define LV_PROFILER_MULTEX_UNLOCK lv_mutex_unlock(&profiler_ctx->mutex)
+#else
+    #define LV_PROFILER_MULTEX_INIT
+    #define LV_PROFILER_MULTEX_DEINIT
+    #define LV_PROFILER_MULTEX_LOCK
+    #define LV_PROFILER_MULTEX_UNLOCK
+#endif
+
+/*The owner of a ring publishes its events and the claimed rings and interned tags are
+ *published to the other threads with release stores. Compilers without the GCC atomic
+ *builtins fall back to plain accesses, which is only safe on single core targets.*/
+#if defined(__GNUC__) || defined(__clang__)
+    #define LOAD_ACQUIRE(p)         __atomic_load_n((p), __ATOMIC_ACQUIRE)
+    #define STORE_RELEASE(p, v)     __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+    #define FETCH_ADD(p, v)         __atomic_fetch_add((p), (v), __ATOMIC_RELAXED)
+    #define EXCHANGE(p, v)          __atomic_exchange_n((p), (v), __ATOMIC_RELAXED)
+#else
+    #define LOAD_ACQUIRE(p)         (*(p))
+    #define STORE_RELEASE(p, v)     (*(p) = (v))
+    #define FETCH_ADD(p, v)         ((*(p) += (v)) - (v))
+    #define EXCHANGE(p, v)          exchange_plain((p), (v))
+#endif
+
+/*With these OSes the default thread ID callback returns the real thread ID. Else every thread
+ *gets the same ID and shares one ring, so the events are written under the mutex.*/
+#define DEFAULT_TID_IS_THREAD  (LV_USE_OS != LV_OS_CUSTOM)
+
+/*The default thread ID is folded to an int, so the rings also store the full handle to tell
+ *apart the threads whose IDs collide*/
+#if LV_USE_OS == LV_OS_PTHREAD
+    #define THREAD_EQUAL(a, b)      pthread_equal((a), (b))
+#else
+    #define THREAD_EQUAL(a, b)      ((a) == (b))
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    typedef pthread_t lv_profiler_bin_thread_t;
+#else
+    typedef uint64_t lv_profiler_bin_thread_t;
+#endif
+
+/**
+ * @brief One recorded event, as written into the dump
+ */
+typedef struct {
+    uint32_t tick;      /**< Timestamp in `tick_per_sec` units */
+    uint16_t tag_id;    /**< Index of the interned tag */
+    uint8_t type;       /**< 'B' or 'E' */
+    uint8_t cpu;        /**< The CPU ID the event was recorded on */
+} lv_profiler_bin_event_t;
+
+/**
+ * @brief Header of a flushed chunk. Followed by `tag_cnt` tags and `ring_cnt` rings.
+ */
+typedef struct {
+    char magic[4];          /**< "LVPB" */
+    uint16_t version;       /**< LV_PROFILER_BIN_VERSION, also tells the byte order */
+    uint16_t ring_cnt;      /**< Number of rings in the chunk */
+    uint32_t tick_per_sec;  /**< Resolution of the timestamps */
+    uint32_t tag_cnt;       /**< Number of tags in the chunk */
+    uint32_t dropped;       /**< Events of threads without a free ring since the previous flush */
+} lv_profiler_bin_chunk_header_t;
+
+/**
+ * @brief Header of a tag in a chunk. Followed by `len` characters without terminating '\0'.
+ */
+typedef struct {
+    uint16_t id;
+    uint16_t len;
+} lv_profiler_bin_tag_header_t;
+
+/**
+ * @brief Header of a ring in a chunk. Followed by `event_cnt` events.
+ */
+typedef struct {
+    int32_t tid;            /**< The thread ID of the ring's owner */
+    uint32_t lost;          /**< Events overwritten since the previous flush */
+    uint32_t event_cnt;     /**< Number of events in the chunk */
+} lv_profiler_bin_ring_header_t;
+
+/**
+ * @brief Event ring buffer owned by a single thread
+ */
+typedef struct {
+    lv_profiler_bin_event_t * events;   /**< `ring_size` events */
+    uint32_t head;                      /**< Number of events ever written. Written by the owner only */
+    uint32_t tail;                      /**< `head` at the last flush. Written by the flush only */
+    int tid;                            /**< The thread ID of the owner */
+    lv_profiler_bin_thread_t thread;    /**< The handle of the owner, compared with the default thread ID callback */
+    bool ready;                         /**< The ring is claimed and `tid` is valid */
+} lv_profiler_bin_ring_t;
+
+/**
+ * @brief Structure representing a context for the LVGL binary profiler
+ */
+typedef struct lv_profiler_bin_ctx_t {
+    lv_profiler_bin_ring_t rings[LV_PROFILER_BIN_THREAD_MAX];   /**< One ring per thread */
+    const char * tags[LV_PROFILER_BIN_TAG_MAX]; /**< Interned tags, hashed by their address */
+    uint32_t ring_size;                         /**< Events per ring, a power of 2 */
+    uint32_t dropped;                           /**< Events of threads without a free ring */
+    lv_profiler_bin_config_t config;            /**< Configuration for the binary profiler */
+    bool enable;                                /**< Whether the binary profiler is enabled */
+#if LV_USE_OS
+    lv_mutex_t mutex;                           /**< Protects claiming rings, interning tags and flushing */
+#endif
+} lv_profiler_bin_ctx_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_profiler_bin_thread_t thread_self(void);
+static int default_tid_get_cb(void);
+static int default_cpu_get_cb(void);
+#if !(defined(__GNUC__) || defined(__clang__))
+    static uint32_t exchange_plain(uint32_t * p, uint32_t v);
+#endif
+static lv_profiler_bin_ring_t * ring_get(void);
+static lv_profiler_bin_ring_t * ring_claim(int tid, lv_profiler_bin_thread_t thread);
+static uint32_t tag_hash(const char * func);
+static uint16_t tag_get_id(const char * func);
+static uint16_t tag_insert(const char * func, uint32_t index);
+static void flush_no_lock(void (*write_cb)(const void *, uint32_t, void *), void * user_data);
+static void file_write_cb(const void * buf, uint32_t size, void * user_data);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_profiler_bin_config_init(lv_profiler_bin_config_t * config)
+{
+    LV_ASSERT_NULL(config);
+    lv_memzero(config, sizeof(lv_profiler_bin_config_t));
+    config->buf_size = LV_PROFILER_BIN_BUF_SIZE;
+    config->tick_per_sec = 1000;
+    config->tick_get_cb = lv_tick_get;
+    config->tid_get_cb = default_tid_get_cb;
+    config->cpu_get_cb = default_cpu_get_cb;
+}
+
+void lv_profiler_bin_init(const lv_profiler_bin_config_t * config)
+{
+    LV_ASSERT_NULL(config);
+    LV_ASSERT_NULL(config->tick_get_cb);
+    LV_ASSERT_NULL(config->tid_get_cb);
+
+    /*Round down to a power of 2 to index the ring with a mask*/
+    uint32_t num = config->buf_size / sizeof(lv_profiler_bin_event_t);
+    if(num < 2) {
+        LV_LOG_WARN("buf_size must >= %d", (int)(2 * sizeof(lv_profiler_bin_event_t)));
+        return;
+    }
+
+    uint32_t ring_size = 1;
+    while(ring_size <= num / 2) ring_size <<= 1;
+
+    if(config->tick_per_sec == 0) {
+        LV_LOG_WARN("tick_per_sec must > 0");
+        return;
+    }
+
+    if(profiler_ctx) {
+        lv_profiler_bin_uninit();
+    }
+
+    profiler_ctx = lv_malloc_zeroed(sizeof(lv_profiler_bin_ctx_t));
+    LV_ASSERT_MALLOC(profiler_ctx);
+    if(profiler_ctx == NULL) {
+        LV_LOG_ERROR("malloc failed for profiler_ctx");
+        return;
+    }
+
+    LV_PROFILER_MULTEX_INIT;
+    profiler_ctx->ring_size = ring_size;
+    profiler_ctx->config = *config;
+
+    lv_profiler_bin_set_enable(true);
+
+    LV_LOG_INFO("init OK, ring_size = %d", (int)ring_size);
+}
+
+void lv_profiler_bin_uninit(void)
+{
+    LV_ASSERT_NULL(profiler_ctx);
+
+    uint32_t i;
+    for(i = 0; i < LV_PROFILER_BIN_THREAD_MAX; i++) {
+        lv_free(profiler_ctx->rings[i].events);
+    }
+
+    LV_PROFILER_MULTEX_DEINIT;
+    lv_free(profiler_ctx);
+    profiler_ctx = NULL;
+}
+
+void lv_profiler_bin_set_enable(bool enable)
+{
+    if(!profiler_ctx) {
+        return;
+    }
+
+    profiler_ctx->enable = enable;
+}
+
+void lv_profiler_bin_flush(void)
+{
+    LV_ASSERT_NULL(profiler_ctx);
+
+    if(!profiler_ctx->config.write_cb) {
+        LV_LOG_WARN("write_cb is not registered");
+        return;
+    }
+
+    LV_PROFILER_MULTEX_LOCK;
+    flush_no_lock(profiler_ctx->config.write_cb, profiler_ctx->config.user_data);
+    LV_PROFILER_MULTEX_UNLOCK;
+}
+
+lv_result_t lv_profiler_bin_dump(const char * path)
+{
+    LV_ASSERT_NULL(profiler_ctx);
+    LV_ASSERT_NULL(path);
+
+    lv_fs_file_t file;
+    lv_fs_res_t res = lv_fs_open(&file, path, LV_FS_MODE_WR);
+    if(res != LV_FS_RES_OK) {
+        LV_LOG_WARN("can't open %s", path);
+        return LV_RESULT_INVALID;
+    }
+
+    LV_PROFILER_MULTEX_LOCK;
+    flush_no_lock(file_write_cb, &file);
+    LV_PROFILER_MULTEX_UNLOCK;
+
+    lv_fs_close(&file);
+    return LV_RESULT_OK;
+}
+
+void lv_profiler_bin_write(const char * func, char tag)
+{
+    LV_ASSERT_NULL(profiler_ctx);
+    LV_ASSERT_NULL(func);
+
+    if(!profiler_ctx->enable) {
+        return;
+    }
+
+    uint32_t tick = profiler_ctx->config.tick_get_cb();
+
+    lv_profiler_bin_ring_t * ring = ring_get();
+    if(ring == NULL) {
+        FETCH_ADD(&profiler_ctx->dropped, 1);
+        return;
+    }
+
+    uint16_t tag_id = tag_get_id(func);
+    uint8_t cpu = profiler_ctx->config.cpu_get_cb ? (uint8_t)profiler_ctx->config.cpu_get_cb() : 0;
+
+#if !DEFAULT_TID_IS_THREAD
+    bool shared = profiler_ctx->config.tid_get_cb == default_tid_get_cb;
+    if(shared) LV_PROFILER_MULTEX_LOCK;
+#endif
+
+    /*Only the owner thread writes `head`, so it's enough to publish it after the event*/
+    uint32_t head = ring->head;
+    lv_profiler_bin_event_t * event = &ring->events[head & (profiler_ctx->ring_size - 1)];
+    event->tick = tick;
+    event->tag_id = tag_id;
+    event->type = (uint8_t)tag;
+    event->cpu = cpu;
+
+    STORE_RELEASE(&ring->head, head + 1);
+
+#if !DEFAULT_TID_IS_THREAD
+    if(shared) LV_PROFILER_MULTEX_UNLOCK;
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_profiler_bin_thread_t thread_self(void)
+{
+#if LV_USE_OS == LV_OS_PTHREAD
+    return pthread_self();
+#elif LV_USE_OS == LV_OS_FREERTOS
+    return (uintptr_t)xTaskGetCurrentTaskHandle();
+#elif LV_USE_OS == LV_OS_CMSIS_RTOS2
+    return (uintptr_t)osThreadGetId();
+#elif LV_USE_OS == LV_OS_RTTHREAD
+    return (uintptr_t)rt_thread_self();
+#elif LV_USE_OS == LV_OS_WINDOWS
+    return GetCurrentThreadId();
+#elif LV_USE_OS == LV_OS_MQX
+    return _task_get_id();
+#else
+    return 1;
+#endif
+}
+
+static int default_tid_get_cb(void)
+{
+    /*Fold the handle to an int. Two threads might get the same ID, `ring_get()` compares the full handles.*/
+#if LV_USE_OS == LV_OS_PTHREAD
+    pthread_t self = pthread_self();
+    uint64_t id = 0;
+    lv_memcpy(&id, &self, LV_MIN(sizeof(self), sizeof(id)));
+#else
+    uint64_t id = thread_self();
+#endif
+    return (int)(uint32_t)(id ^ (id >> 32));
+}
+
+static int default_cpu_get_cb(void)
+{
+    return 0;
+}
+
+static lv_profiler_bin_ring_t * ring_get(void)
+{
+    int tid = profiler_ctx->config.tid_get_cb();
+
+    /*A custom callback returns unique IDs, the default one only folded handles*/
+    bool by_handle = profiler_ctx->config.tid_get_cb == default_tid_get_cb;
+    lv_profiler_bin_thread_t thread = thread_self();
+
+    uint32_t i;
+    for(i = 0; i < LV_PROFILER_BIN_THREAD_MAX; i++) {
+        lv_profiler_bin_ring_t * ring = &profiler_ctx->rings[i];
+        if(!LOAD_ACQUIRE(&ring->ready)) break;  /*Rings are claimed in order*/
+        if(ring->tid == tid && (!by_handle || THREAD_EQUAL(ring->thread, thread))) return ring;
+    }
+
+    return ring_claim(tid, thread);
+}
+
+static lv_profiler_bin_ring_t * ring_claim(int tid, lv_profiler_bin_thread_t thread)
+{
+    lv_profiler_bin_ring_t * res = NULL;
+
+    LV_PROFILER_MULTEX_LOCK;
+
+    uint32_t i;
+    for(i = 0; i < LV_PROFILER_BIN_THREAD_MAX; i++) {
+        lv_profiler_bin_ring_t * ring = &profiler_ctx->rings[i];
+        if(ring->ready) continue;
+
+        ring->events = lv_malloc(profiler_ctx->ring_size * sizeof(lv_profiler_bin_event_t));
+        LV_ASSERT_MALLOC(ring->events);
+        if(ring->events == NULL) {
+            LV_LOG_ERROR("malloc failed for ring of thread %d", tid);
+            break;
+        }
+
+        ring->tid = tid;
+        ring->thread = thread;
+        STORE_RELEASE(&ring->ready, true);
+        res = ring;
+        break;
+    }
+
+    LV_PROFILER_MULTEX_UNLOCK;
+
+    if(res == NULL) {
+        LV_LOG_WARN("no free ring for thread %d, increase LV_PROFILER_BIN_THREAD_MAX", tid);
+    }
+
+    return res;
+}
+
+static uint32_t tag_hash(const char * func)
+{
+    uint32_t h = (uint32_t)((lv_uintptr_t)func >> 2) * 2654435761u;
+    return h ^ (h >> 16);
+}
+
+static uint16_t tag_get_id(const char * func)
+{
+    uint32_t mask = LV_PROFILER_BIN_TAG_MAX - 1;
+    uint32_t index = tag_hash(func) & mask;
+
+    uint32_t n;
+    for(n = 0; n <= mask; n++) {
+        const char * tag = LOAD_ACQUIRE(&profiler_ctx->tags[index]);
+        if(tag == func) return (uint16_t)index;
+        if(tag == NULL) return tag_insert(func, index);
+        index = (index + 1) & mask;
+    }
+
+    return LV_PROFILER_BIN_TAG_UNKNOWN;
+}
+
+static uint16_t tag_insert(const char * func, uint32_t index)
+{
+    uint32_t mask = LV_PROFILER_BIN_TAG_MAX - 1;
+    uint16_t id = LV_PROFILER_BIN_TAG_UNKNOWN;
+
+    LV_PROFILER_MULTEX_LOCK;
+
+    /*An other thread might have taken the free slot in the meantime*/
+    uint32_t n;
+    for(n = 0; n <= mask; n++) {
+        const char * tag = profiler_ctx->tags[index];
+        if(tag == func) {
+            id = (uint16_t)index;
+            break;
+        }
+        if(tag == NULL) {
+            STORE_RELEASE(&profiler_ctx->tags[index], func);
+            id = (uint16_t)index;
+            break;
+        }
+        index = (index + 1) & mask;
+    }
+
+    LV_PROFILER_MULTEX_UNLOCK;
+
+    return id;
+}
+
+static void flush_no_lock(void (*write_cb)(const void *, uint32_t, void *), void * user_data)
+{
+    lv_profiler_bin_chunk_header_t header;
+    lv_memcpy(header.magic, LV_PROFILER_BIN_MAGIC, sizeof(header.magic));
+    header.version = LV_PROFILER_BIN_VERSION;
+    header.tick_per_sec = profiler_ctx->config.tick_per_sec;
+    header.ring_cnt = 0;
+    header.tag_cnt = 0;
+    header.dropped = EXCHANGE(&profiler_ctx->dropped, 0);
+
+    uint32_t i;
+    for(i = 0; i < LV_PROFILER_BIN_THREAD_MAX; i++) {
+        if(profiler_ctx->rings[i].ready) header.ring_cnt++;
+    }
+
+    for(i = 0; i < LV_PROFILER_BIN_TAG_MAX; i++) {
+        if(profiler_ctx->tags[i]) header.tag_cnt++;
+    }
+
+    write_cb(&header, sizeof(header), user_data);
+
+    /*All the tags are written in every chunk, so each chunk can be decoded alone*/
+    for(i = 0; i < LV_PROFILER_BIN_TAG_MAX; i++) {
+        const char * tag = profiler_ctx->tags[i];
+        if(tag == NULL) continue;
+
+        size_t len = lv_strlen(tag);
+        lv_profiler_bin_tag_header_t tag_header;
+        tag_header.id = (uint16_t)i;
+        tag_header.len = (uint16_t)LV_MIN(len, 0xFFFF);
+        write_cb(&tag_header, sizeof(tag_header), user_data);
+        write_cb(tag, tag_header.len, user_data);
+    }
+
+    /*The owners keep recording meanwhile. Events recorded after `head` is read go to
+     *the next chunk, but the oldest events might be overwritten while they are written
+     *if a thread records a full ring during the flush.*/
+    uint32_t ring_size = profiler_ctx->ring_size;
+    for(i = 0; i < LV_PROFILER_BIN_THREAD_MAX; i++) {
+        lv_profiler_bin_ring_t * ring = &profiler_ctx->rings[i];
+        if(!ring->ready) continue;
+
+        uint32_t head = LOAD_ACQUIRE(&ring->head);
+        uint32_t start = ring->tail;
+        if(head - start > ring_size) start = head - ring_size;
+
+        lv_profiler_bin_ring_header_t ring_header;
+        ring_header.tid = ring->tid;
+        ring_header.lost = start - ring->tail;
+        ring_header.event_cnt = head - start;
+        write_cb(&ring_header, sizeof(ring_header), user_data);
+
+        /*Write the events in at most two contiguous parts*/
+        uint32_t ofs = start & (ring_size - 1);
+        uint32_t first = LV_MIN(ring_header.event_cnt, ring_size - ofs);
+        if(first) write_cb(&ring->events[ofs], first * sizeof(lv_profiler_bin_event_t), user_data);
+        if(ring_header.event_cnt > first) {
+            write_cb(ring->events, (ring_header.event_cnt - first) * sizeof(lv_profiler_bin_event_t), user_data);
+        }
+
+        ring->tail = head;
+    }
+
+    if(header.dropped) {
+        LV_LOG_WARN("%" LV_PRIu32 " events of threads without a ring were dropped", header.dropped);
+    }
+}
+
+#if !(defined(__GNUC__) || defined(__clang__))
+static uint32_t exchange_plain(uint32_t * p, uint32_t v)
+{
+    uint32_t old = *p;
+    *p = v;
+    return old;
+}
+#endif
+
+static void file_write_cb(const void * buf, uint32_t size, void * user_data)
+{
+    lv_fs_write(user_data, buf, size, NULL);
+}
+
+#endif /*LV_USE_PROFILER_BIN*/
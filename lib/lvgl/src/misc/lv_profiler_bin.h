@@ -0,0 +1,95 @@
+/**
+ * @file lv_profiler_bin.h
+ *
+ */
+
+#ifndef LV_PROFILER_BIN_H
+#define LV_PROFILER_BIN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lv_conf_internal.h"
+
+#if LV_USE_PROFILER && LV_USE_PROFILER_BIN
+
+#include "lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LV_PROFILER_BIN_BEGIN_TAG(tag)  lv_profiler_bin_write((tag), 'B')
+#define LV_PROFILER_BIN_END_TAG(tag)    lv_profiler_bin_write((tag), 'E')
+#define LV_PROFILER_BIN_BEGIN           LV_PROFILER_BIN_BEGIN_TAG(__func__)
+#define LV_PROFILER_BIN_END             LV_PROFILER_BIN_END_TAG(__func__)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * @brief Initialize the configuration of the binary profiler
+ * @param config Pointer to the configuration structure of the binary profiler
+ */
+void lv_profiler_bin_config_init(lv_profiler_bin_config_t * config);
+
+/**
+ * @brief Initialize the binary profiler with the given configuration
+ * @param config Pointer to the configuration structure of the binary profiler
+ */
+void lv_profiler_bin_init(const lv_profiler_bin_config_t * config);
+
+/**
+ * @brief Uninitialize the binary profiler
+ */
+void lv_profiler_bin_uninit(void);
+
+/**
+ * @brief Enable or disable the binary profiler
+ * @param enable true to enable the binary profiler, false to disable
+ */
+void lv_profiler_bin_set_enable(bool enable);
+
+/**
+ * @brief Write the events recorded since the last flush to the `write_cb` of the configuration.
+ *        Every flush produces a self-contained chunk, so periodic flushes can be streamed
+ *        into the same file and converted with `scripts/trace_bin2json.py`.
+ */
+void lv_profiler_bin_flush(void);
+
+/**
+ * @brief Write the events recorded since the last flush into a file
+ * @param path path of the file to create, e.g. "A:trace.bin"
+ * @return LV_RESULT_OK: the file was written; LV_RESULT_INVALID: the file couldn't be opened
+ */
+lv_result_t lv_profiler_bin_dump(const char * path);
+
+/**
+ * @brief Record an event. Doesn't take any lock once the calling thread owns a ring buffer.
+ * @param func Name of the function being profiled. Must be a string with static lifetime,
+ *             as only its address is stored.
+ * @param tag 'B' at the begin and 'E' at the end of the profiled section
+ */
+void lv_profiler_bin_write(const char * func, char tag);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_PROFILER_BIN*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_PROFILER_BIN_H*/
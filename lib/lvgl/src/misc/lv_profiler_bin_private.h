@@ -0,0 +1,56 @@
+/**
+ * @file lv_profiler_bin_private.h
+ *
+ */
+
+#ifndef LV_PROFILER_BIN_PRIVATE_H
+#define LV_PROFILER_BIN_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_profiler_bin.h"
+
+#if LV_USE_PROFILER && LV_USE_PROFILER_BIN
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * @brief LVGL binary profiler configuration structure
+ */
+struct lv_profiler_bin_config_t {
+    size_t buf_size;                    /**< Size of the ring buffer of each thread */
+    uint32_t tick_per_sec;              /**< The number of ticks per second */
+    uint32_t (*tick_get_cb)(void);      /**< Callback function to get the current tick count */
+    int (*tid_get_cb)(void);            /**< Callback function to get the current thread ID */
+    int (*cpu_get_cb)(void);            /**< Callback function to get the current CPU */
+    void (*write_cb)(const void * buf, uint32_t size, void * user_data); /**< Write a part of a flushed chunk */
+    void * user_data;                   /**< Passed to `write_cb` */
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_PROFILER && LV_USE_PROFILER_BIN */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_PROFILER_BIN_PRIVATE_H*/
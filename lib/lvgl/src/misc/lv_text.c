@@ -14,6 +14,7 @@
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_string.h"
 #include "../misc/lv_types.h"
+#include "cache/lv_text_layout_cache_private.h"
 
 /*********************
  *      DEFINES
@@ -104,6 +105,22 @@ void lv_text_get_size(lv_point_t * size_res, const char * text, const lv_font_t
     uint32_t new_line_start = 0;
     uint16_t letter_height = lv_font_get_line_height(font);
 
+    /*Reuse the line breaks and widths if the text was laid out already*/
+    const lv_text_layout_t * layout = lv_text_layout_cache_acquire(text, font, letter_space, max_width, flag);
+    if(layout) {
+        int64_t h = (int64_t)layout->line_cnt * (letter_height + line_space);
+        if(h > INT32_MAX || h < INT32_MIN) {
+            LV_LOG_WARN("integer overflow while calculating text height");
+            lv_text_layout_cache_release(layout);
+            return;
+        }
+
+        size_res->x = layout->width;
+        size_res->y = (int32_t)h;
+        line_start = layout->line_cnt ? layout->lines[layout->line_cnt - 1].end : 0;
+        lv_text_layout_cache_release(layout);
+    }
+
     /*Calc. the height and longest line*/
     while(text[line_start] != '\0') {
         new_line_start += lv_text_get_next_line(&text[line_start], font, letter_space, max_width, NULL, flag);
@@ -33,6 +33,14 @@
  **********************/
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
+static uint32_t time_remaining_at(const lv_timer_t * timer, uint32_t now);
+static bool heap_before(const lv_timer_t * a, const lv_timer_t * b, uint32_t now);
+static void heap_swap(uint32_t i, uint32_t j);
+static void heap_sift_up(uint32_t i, uint32_t now);
+static void heap_sift_down(uint32_t i, uint32_t now);
+static bool heap_insert(lv_timer_t * timer);
+static void heap_remove(lv_timer_t * timer);
+static void heap_update(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
 
 /**********************
@@ -90,42 +98,19 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    lv_timer_t * timer_active;
-    lv_ll_t * timer_head = timer_ll_p;
-    do {
-        state_p->timer_deleted             = false;
-        state_p->timer_created             = false;
-
-        timer_active = lv_ll_get_head(timer_head);
-        while(timer_active) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = lv_ll_get_next(timer_head, timer_active);
-
-            if(lv_timer_exec(timer_active)) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(state_p->timer_created || state_p->timer_deleted) {
-                    LV_TRACE_TIMER("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
-
-            timer_active = next; /*Load the next timer*/
-        }
-    } while(timer_active);
+    /*Run the ready timers in the order of their deadlines. The timer with the least
+     *time remaining is always on the top of the heap, so only the ready timers are visited.
+     *Every timer runs at most once per round, even if its period is shorter than its callback.*/
+    state_p->exec_id++;
+    while(state_p->heap_cnt > 0) {
+        lv_timer_t * timer_active = state_p->heap[0];
+        if(timer_active->exec_id == state_p->exec_id) break;
+        if(!lv_timer_exec(timer_active)) break;
+    }
 
     uint32_t time_until_next = LV_NO_TIMER_READY;
-    next = lv_ll_get_head(timer_head);
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_until_next)
-                time_until_next = delay;
-        }
-
-        next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
+    if(state_p->heap_cnt > 0) {
+        time_until_next = lv_timer_time_remaining(state_p->heap[0]);
     }
 
     state_p->busy_time += lv_tick_elaps(handler_start);
@@ -178,8 +163,14 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
+    new_timer->heap_index = LV_TIMER_HEAP_NONE;
+    new_timer->exec_id = state.exec_id - 1;
 
-    state.timer_created = true;
+    if(!heap_insert(new_timer)) {
+        lv_ll_remove(timer_ll_p, new_timer);
+        lv_free(new_timer);
+        return NULL;
+    }
 
     lv_timer_handler_resume();
 
@@ -194,8 +185,9 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+    heap_remove(timer);
     lv_ll_remove(timer_ll_p, timer);
-    state.timer_deleted = true;
+    if(state.exec_timer == timer) state.exec_timer = NULL;
 
     lv_free(timer);
 }
@@ -204,12 +196,17 @@ void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = true;
+    heap_remove(timer);
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+    if(timer->heap_index == LV_TIMER_HEAP_NONE && !heap_insert(timer)) {
+        timer->paused = true;
+        return;
+    }
     lv_timer_handler_resume();
 }
 
@@ -217,18 +214,23 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+    heap_update(timer);
 }
 
 void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+    heap_update(timer);
 }
 
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     LV_ASSERT_NULL(timer);
     timer->repeat_count = repeat_count;
+
+    /*The timer is deleted or paused when it becomes ready, so make it ready now*/
+    if(repeat_count == 0) lv_timer_ready(timer);
 }
 
 void lv_timer_set_auto_delete(lv_timer_t * timer, bool auto_delete)
@@ -247,6 +249,7 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+    heap_update(timer);
     lv_timer_handler_resume();
 }
 
@@ -261,6 +264,11 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+
+    lv_free(state.heap);
+    state.heap = NULL;
+    state.heap_cnt = 0;
+    state.heap_size = 0;
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -312,31 +320,31 @@ bool lv_timer_get_paused(lv_timer_t * timer)
 static bool lv_timer_exec(lv_timer_t * timer)
 {
     if(timer->paused) return false;
+    if(lv_timer_time_remaining(timer) != 0) return false;
 
-    bool exec = false;
-    if(lv_timer_time_remaining(timer) == 0) {
-        /* Decrement the repeat count before executing the timer_cb.
-         * If any timer is deleted `if(timer->repeat_count == 0)` is not executed below
-         * but at least the repeat count is zero and the timer can be deleted in the next round*/
-        int32_t original_repeat_count = timer->repeat_count;
-        if(timer->repeat_count > 0) timer->repeat_count--;
-        timer->last_run = lv_tick_get();
-        LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
-
-        if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
+    /* Decrement the repeat count before executing the timer_cb.
+     * If the timer is deleted `if(timer->repeat_count == 0)` is not executed below
+     * but at least the repeat count is zero*/
+    int32_t original_repeat_count = timer->repeat_count;
+    if(timer->repeat_count > 0) timer->repeat_count--;
+    timer->last_run = lv_tick_get();
+    timer->exec_id = state.exec_id;
+    heap_update(timer);
+    LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
 
-        if(!state.timer_deleted) {
-            LV_TRACE_TIMER("timer callback %p finished", *((void **)&timer->timer_cb));
-        }
-        else {
-            LV_TRACE_TIMER("timer callback finished");
-        }
+    state.exec_timer = timer;
+    if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
 
-        LV_ASSERT_MEM_INTEGRITY();
-        exec = true;
+    if(state.exec_timer) {
+        LV_TRACE_TIMER("timer callback %p finished", *((void **)&timer->timer_cb));
     }
+    else {
+        LV_TRACE_TIMER("timer callback finished");
+    }
+
+    LV_ASSERT_MEM_INTEGRITY();
 
-    if(state.timer_deleted == false) { /*The timer might be deleted by itself as well*/
+    if(state.exec_timer) { /*The timer might be deleted by itself as well*/
         if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
             if(timer->auto_delete) {
                 LV_TRACE_TIMER("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
@@ -349,7 +357,9 @@ static bool lv_timer_exec(lv_timer_t * timer)
         }
     }
 
-    return exec;
+    state.exec_timer = NULL;
+
+    return true;
 }
 
 /**
@@ -366,6 +376,132 @@ static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
     return timer->period - elp;
 }
 
+/**
+ * Find out how much time remains before a timer must be run at a given time.
+ * @param timer pointer to lv_timer
+ * @param now   the current tick, not older than the `last_run` of any timer
+ * @return the time remaining, or 0 if it needs to be run again
+ */
+static uint32_t time_remaining_at(const lv_timer_t * timer, uint32_t now)
+{
+    uint32_t elp = now - timer->last_run;
+    if(elp >= timer->period)
+        return 0;
+    return timer->period - elp;
+}
+
+/**
+ * Tell if a timer needs to be closer to the top of the heap than an other.
+ * Ordering by the time remaining instead of the absolute deadline doesn't break with
+ * tick overflow or very long periods, and the order remains valid as the time passes
+ * because all the remaining times decrease together.
+ * @param a     pointer to a timer
+ * @param b     pointer to an other timer
+ * @param now   the current tick
+ * @return true: `a` is due earlier than `b`
+ */
+static bool heap_before(const lv_timer_t * a, const lv_timer_t * b, uint32_t now)
+{
+    uint32_t rem_a = time_remaining_at(a, now);
+    uint32_t rem_b = time_remaining_at(b, now);
+    if(rem_a != rem_b) return rem_a < rem_b;
+
+    /*Let the timers which haven't run in this round come first*/
+    return a->exec_id != state.exec_id && b->exec_id == state.exec_id;
+}
+
+static void heap_swap(uint32_t i, uint32_t j)
+{
+    lv_timer_t ** heap = state.heap;
+    lv_timer_t * tmp = heap[i];
+    heap[i] = heap[j];
+    heap[j] = tmp;
+    heap[i]->heap_index = i;
+    heap[j]->heap_index = j;
+}
+
+static void heap_sift_up(uint32_t i, uint32_t now)
+{
+    while(i > 0) {
+        uint32_t parent = (i - 1) / 2;
+        if(!heap_before(state.heap[i], state.heap[parent], now)) break;
+        heap_swap(i, parent);
+        i = parent;
+    }
+}
+
+static void heap_sift_down(uint32_t i, uint32_t now)
+{
+    while(true) {
+        uint32_t left = 2 * i + 1;
+        uint32_t right = left + 1;
+        uint32_t min = i;
+        if(left < state.heap_cnt && heap_before(state.heap[left], state.heap[min], now)) min = left;
+        if(right < state.heap_cnt && heap_before(state.heap[right], state.heap[min], now)) min = right;
+        if(min == i) break;
+        heap_swap(i, min);
+        i = min;
+    }
+}
+
+/**
+ * Add a timer to the heap
+ * @param timer pointer to a timer which is not in the heap
+ * @return true: success; false: out of memory
+ */
+static bool heap_insert(lv_timer_t * timer)
+{
+    if(state.heap_cnt == state.heap_size) {
+        uint32_t new_size = state.heap_size ? state.heap_size * 2 : 8;
+        lv_timer_t ** new_heap = lv_realloc(state.heap, new_size * sizeof(lv_timer_t *));
+        LV_ASSERT_MALLOC(new_heap);
+        if(new_heap == NULL) return false;
+        state.heap = new_heap;
+        state.heap_size = new_size;
+    }
+
+    uint32_t i = state.heap_cnt++;
+    state.heap[i] = timer;
+    timer->heap_index = i;
+    heap_sift_up(i, lv_tick_get());
+    return true;
+}
+
+/**
+ * Remove a timer from the heap if it's there
+ * @param timer pointer to a timer
+ */
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t i = timer->heap_index;
+    if(i == LV_TIMER_HEAP_NONE) return;
+
+    timer->heap_index = LV_TIMER_HEAP_NONE;
+    state.heap_cnt--;
+    if(i == state.heap_cnt) return;
+
+    /*Move the last timer to the free place and restore the order*/
+    state.heap[i] = state.heap[state.heap_cnt];
+    state.heap[i]->heap_index = i;
+    uint32_t now = lv_tick_get();
+    heap_sift_up(i, now);
+    heap_sift_down(state.heap[i]->heap_index, now);
+}
+
+/**
+ * Restore the order of the heap after the period or the last run of a timer has changed
+ * @param timer pointer to a timer
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    uint32_t i = timer->heap_index;
+    if(i == LV_TIMER_HEAP_NONE) return;
+
+    uint32_t now = lv_tick_get();
+    heap_sift_up(i, now);
+    heap_sift_down(timer->heap_index, now);
+}
+
 /**
  * Call the ready lv_timer
  */
@@ -20,6 +20,8 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#define LV_TIMER_HEAP_NONE UINT32_MAX
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -33,17 +35,22 @@ struct lv_timer_t {
     lv_timer_cb_t timer_cb;    /**< Timer function */
     void * user_data;          /**< Custom user data */
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
+    uint32_t heap_index;       /**< Position in the timer heap, or `LV_TIMER_HEAP_NONE` if paused */
+    uint32_t exec_id;          /**< `exec_id` of the timer handler round in which the timer ran last */
     uint32_t paused : 1;
     uint32_t auto_delete : 1;
 };
 
 typedef struct {
     lv_ll_t timer_ll;          /**< Linked list to store the lv_timers */
+    lv_timer_t ** heap;        /**< The not paused timers in a binary min-heap ordered by the time remaining*/
+    uint32_t heap_cnt;         /**< Number of timers in `heap`*/
+    uint32_t heap_size;        /**< Allocated size of `heap`*/
+    lv_timer_t * exec_timer;   /**< The timer whose callback is running. Set to NULL if it is deleted*/
+    uint32_t exec_id;          /**< Incremented in every timer handler round*/
 
     bool lv_timer_run;
     uint8_t idle_last;
-    bool timer_deleted;
-    bool timer_created;
     uint32_t timer_time_until_next;
 
     bool already_running;
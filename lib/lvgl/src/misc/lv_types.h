@@ -127,6 +127,8 @@ typedef struct lv_fragment_managed_states_t lv_fragment_managed_states_t;
 
 typedef struct lv_profiler_builtin_config_t lv_profiler_builtin_config_t;
 
+typedef struct lv_profiler_bin_config_t lv_profiler_bin_config_t;
+
 typedef struct lv_rb_node_t lv_rb_node_t;
 
 typedef struct lv_rb_t lv_rb_t;
@@ -145,6 +147,8 @@ typedef struct lv_image_cache_data_t lv_image_cache_data_t;
 
 typedef struct lv_image_header_cache_data_t lv_image_header_cache_data_t;
 
+typedef struct lv_text_layout_t lv_text_layout_t;
+
 typedef struct lv_draw_mask_t lv_draw_mask_t;
 
 typedef struct lv_grad_t lv_grad_t;
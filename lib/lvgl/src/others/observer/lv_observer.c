@@ -13,10 +13,13 @@
 #include "../../lvgl.h"
 #include "../../core/lv_obj_private.h"
 #include "../../misc/lv_event_private.h"
+#include "../../core/lv_global.h"
 
 /*********************
  *      DEFINES
  *********************/
+#define subject_pending         LV_GLOBAL_DEFAULT()->subject_pending
+#define subject_flush_in_progress LV_GLOBAL_DEFAULT()->subject_flush_in_progress
 
 /**********************
  *      TYPEDEFS
@@ -30,6 +33,11 @@ typedef struct {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void notify_observers(lv_subject_t * subject);
+static bool add_pending(lv_subject_t * subject);
+static void add_refr_start_cb(lv_display_t * disp);
+static void remove_pending(lv_subject_t * subject);
+static void refr_start_event_cb(lv_event_t * e);
 static void unsubscribe_on_delete_cb(lv_event_t * e);
 static void group_notify_cb(lv_observer_t * observer, lv_subject_t * subject);
 static lv_observer_t * bind_to_bitfield(lv_subject_t * subject, lv_obj_t * obj, lv_observer_cb_t cb, uint32_t flag,
@@ -74,6 +82,17 @@ static void obj_value_changed_event_cb(lv_event_t * e);
  *   GLOBAL FUNCTIONS
  **********************/
 
+void lv_observer_core_init(void)
+{
+    lv_array_init(&subject_pending, 4, sizeof(lv_subject_t *));
+    subject_flush_in_progress = false;
+}
+
+void lv_observer_core_deinit(void)
+{
+    lv_array_deinit(&subject_pending);
+}
+
 void lv_subject_init_int(lv_subject_t * subject, int32_t value)
 {
     lv_memzero(subject, sizeof(lv_subject_t));
@@ -90,7 +109,7 @@ void lv_subject_set_int(lv_subject_t * subject, int32_t value)
         return;
     }
 
-    subject->prev_value.num = subject->value.num;
+    if(!subject->notify_pending) subject->prev_value.num = subject->value.num;
     subject->value.num = value;
     lv_subject_notify(subject);
 }
@@ -137,7 +156,7 @@ void lv_subject_copy_string(lv_subject_t * subject, const char * buf)
     }
 
     if(subject->size < 1) return;
-    if(subject->prev_value.pointer) {
+    if(subject->prev_value.pointer && !subject->notify_pending) {
         lv_strlcpy((char *)subject->prev_value.pointer, subject->value.pointer, subject->size);
     }
 
@@ -183,7 +202,7 @@ void lv_subject_set_pointer(lv_subject_t * subject, void * ptr)
         return;
     }
 
-    subject->prev_value.pointer = subject->value.pointer;
+    if(!subject->notify_pending) subject->prev_value.pointer = subject->value.pointer;
     subject->value.pointer = ptr;
     lv_subject_notify(subject);
 }
@@ -224,7 +243,7 @@ void lv_subject_set_color(lv_subject_t * subject, lv_color_t color)
         return;
     }
 
-    subject->prev_value.color = subject->value.color;
+    if(!subject->notify_pending) subject->prev_value.color = subject->value.color;
     subject->value.color = color;
     lv_subject_notify(subject);
 }
@@ -251,6 +270,7 @@ lv_color_t lv_subject_get_previous_color(lv_subject_t * subject)
 
 void lv_subject_init_group(lv_subject_t * subject, lv_subject_t * list[], uint32_t list_len)
 {
+    lv_memzero(subject, sizeof(lv_subject_t));
     subject->type = LV_SUBJECT_TYPE_GROUP;
     subject->size = list_len;
     lv_ll_init(&(subject->subs_ll), sizeof(lv_observer_t));
@@ -266,6 +286,8 @@ void lv_subject_init_group(lv_subject_t * subject, lv_subject_t * list[], uint32
 
 void lv_subject_deinit(lv_subject_t * subject)
 {
+    if(subject->notify_pending) remove_pending(subject);
+
     lv_observer_t * observer = lv_ll_get_head(&subject->subs_ll);
     while(observer) {
         lv_observer_t * observer_next = lv_ll_get_next(&subject->subs_ll, observer);
@@ -376,7 +398,7 @@ void lv_observer_remove(lv_observer_t * observer)
 void lv_obj_remove_from_subject(lv_obj_t * obj, lv_subject_t * subject)
 {
     int32_t i;
-    int32_t event_cnt = (int32_t)(obj->spec_attr ? lv_array_size(&obj->spec_attr->event_list) : 0);
+    int32_t event_cnt = (int32_t)(obj->spec_attr ? lv_event_get_count(&obj->spec_attr->event_list) : 0);
     for(i = event_cnt - 1; i >= 0; i--) {
         lv_event_dsc_t * event_dsc = lv_obj_get_event_dsc(obj, i);
         if(event_dsc->cb == unsubscribe_on_delete_cb) {
@@ -400,21 +422,63 @@ void lv_subject_notify(lv_subject_t * subject)
 {
     LV_ASSERT_NULL(subject);
 
-    lv_observer_t * observer;
-    LV_LL_READ(&(subject->subs_ll), observer) {
-        observer->notified = 0;
+    if(subject->coalesce) {
+        if(subject->notify_pending) {
+            subject->merged_cnt++;
+            return;
+        }
+
+        if(add_pending(subject)) return;
     }
 
-    do {
-        subject->notify_restart_query = 0;
-        LV_LL_READ(&(subject->subs_ll), observer) {
-            if(observer->cb && observer->notified == 0) {
-                observer->cb(observer, subject);
-                if(subject->notify_restart_query) break;
-                observer->notified = 1;
-            }
-        }
-    } while(subject->notify_restart_query);
+    notify_observers(subject);
+}
+
+void lv_subject_set_coalesce(lv_subject_t * subject, bool en)
+{
+    LV_ASSERT_NULL(subject);
+
+    subject->coalesce = en;
+    if(!en && subject->notify_pending) {
+        remove_pending(subject);
+        notify_observers(subject);
+    }
+}
+
+uint32_t lv_subject_get_merged_count(const lv_subject_t * subject)
+{
+    LV_ASSERT_NULL(subject);
+
+    return subject->merged_cnt;
+}
+
+void lv_subject_flush_coalesced(void)
+{
+    /*Called again from an observer, e.g. by `lv_refr_now()`*/
+    if(subject_flush_in_progress) return;
+
+    uint32_t cnt = lv_array_size(&subject_pending);
+    if(cnt == 0) return;
+
+    LV_PROFILER_BEGIN;
+    subject_flush_in_progress = true;
+
+    /*Subjects made pending by the observers are appended after `cnt`
+     *and will be delivered on the next refresh*/
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_subject_t * subject = *(lv_subject_t **)lv_array_at(&subject_pending, i);
+        if(subject == NULL) continue;   /*Deinitialized or not coalescing anymore*/
+
+        subject->notify_pending = 0;
+        notify_observers(subject);
+    }
+
+    if(lv_array_size(&subject_pending) == cnt) lv_array_clear(&subject_pending);
+    else lv_array_erase(&subject_pending, 0, cnt);
+
+    subject_flush_in_progress = false;
+    LV_PROFILER_END;
 }
 
 lv_observer_t * lv_obj_bind_flag_if_eq(lv_obj_t * obj, lv_subject_t * subject, lv_obj_flag_t flag, int32_t ref_value)
@@ -559,6 +623,88 @@ static void group_notify_cb(lv_observer_t * observer, lv_subject_t * subject)
     lv_subject_notify(subject_group);
 }
 
+static void notify_observers(lv_subject_t * subject)
+{
+    lv_observer_t * observer;
+    LV_LL_READ(&(subject->subs_ll), observer) {
+        observer->notified = 0;
+    }
+
+    do {
+        subject->notify_restart_query = 0;
+        LV_LL_READ(&(subject->subs_ll), observer) {
+            if(observer->cb && observer->notified == 0) {
+                observer->cb(observer, subject);
+                if(subject->notify_restart_query) break;
+                observer->notified = 1;
+            }
+        }
+    } while(subject->notify_restart_query);
+}
+
+/**
+ * Queue a notification for the next refresh and make sure a refresh will happen
+ * @param subject   pointer to a coalescing subject
+ * @return          true: the notification was queued; false: notify synchronously
+ */
+static bool add_pending(lv_subject_t * subject)
+{
+    /*Without a refresh timer the notification would be delayed indefinitely*/
+    bool has_refr_timer = false;
+    lv_display_t * disp = lv_display_get_next(NULL);
+    while(disp) {
+        lv_timer_t * refr_timer = lv_display_get_refr_timer(disp);
+        if(refr_timer) {
+            lv_timer_resume(refr_timer);
+            has_refr_timer = true;
+            add_refr_start_cb(disp);
+        }
+        disp = lv_display_get_next(disp);
+    }
+
+    if(!has_refr_timer) return false;
+
+    lv_array_push_back(&subject_pending, &subject);
+    subject->notify_pending = 1;
+    return true;
+}
+
+/**
+ * Deliver the pending notifications when the display starts a refresh, i.e. before the widgets are
+ * laid out and drawn. Added only once per display, the displays are created after `lv_init()`.
+ * @param disp      pointer to a display
+ */
+static void add_refr_start_cb(lv_display_t * disp)
+{
+    uint32_t cnt = lv_display_get_event_count(disp);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        if(lv_event_dsc_get_cb(lv_display_get_event_dsc(disp, i)) == refr_start_event_cb) return;
+    }
+
+    lv_display_add_event_cb(disp, refr_start_event_cb, LV_EVENT_REFR_START, NULL);
+}
+
+static void refr_start_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+
+    lv_subject_flush_coalesced();
+}
+
+static void remove_pending(lv_subject_t * subject)
+{
+    /*Only clear the slot as `lv_subject_flush_coalesced()` might be iterating the array*/
+    uint32_t cnt = lv_array_size(&subject_pending);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_subject_t ** slot = lv_array_at(&subject_pending, i);
+        if(*slot == subject) *slot = NULL;
+    }
+
+    subject->notify_pending = 0;
+}
+
 static void unsubscribe_on_delete_cb(lv_event_t * e)
 {
     lv_observer_t * observer = lv_event_get_user_data(e);
@@ -57,6 +57,9 @@ typedef struct {
     lv_subject_value_t value;           /**< Actual value*/
     lv_subject_value_t prev_value;      /**< Previous value*/
     uint32_t notify_restart_query : 1; /**< If an observer deleted start notifying from the beginning. */
+    uint32_t coalesce : 1;              /**< Deliver the notifications only once per display refresh*/
+    uint32_t notify_pending : 1;        /**< A coalesced notification is waiting for the next refresh*/
+    uint32_t merged_cnt;                /**< Notifications merged into an already pending one*/
     void * user_data;                   /**< Additional parameter, can be used freely by the user*/
 } lv_subject_t;
 
@@ -288,6 +291,33 @@ void * lv_observer_get_user_data(const lv_observer_t * observer);
  */
 void lv_subject_notify(lv_subject_t * subject);
 
+/**
+ * Enable or disable coalescing the notifications of a subject.
+ * A coalescing subject stores only the latest value when it's set and notifies its observers
+ * once, just before the next display refresh. Useful for values sampled faster than the
+ * refresh rate (e.g. sensors) to avoid updating and invalidating the widgets multiple times per frame.
+ * The previous value seen by the observers is the value of the last delivered notification.
+ * @param subject       pointer to a subject
+ * @param en            true: enable coalescing; false: notify synchronously (a pending notification is delivered now)
+ * @note                without a display having a refresh timer the notifications are delivered synchronously
+ */
+void lv_subject_set_coalesce(lv_subject_t * subject, bool en);
+
+/**
+ * Get the number of notifications that were merged into an already pending one
+ * (i.e. that were never delivered separately) since the subject was initialized
+ * @param subject       pointer to a subject
+ * @return              number of merged notifications
+ */
+uint32_t lv_subject_get_merged_count(const lv_subject_t * subject);
+
+/**
+ * Deliver the pending notifications of the coalescing subjects.
+ * Called on `LV_EVENT_REFR_START` of the displays, calling it manually is not required.
+ * Notifications caused by the observers are delivered on the next call.
+ */
+void lv_subject_flush_coalesced(void);
+
 /**
  * Set an object flag if an integer subject's value is equal to a reference value, clear the flag otherwise
  * @param obj           pointer to an object
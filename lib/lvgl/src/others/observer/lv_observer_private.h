@@ -44,6 +44,16 @@ struct lv_observer_t {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Initialize the list of pending coalesced notifications
+ */
+void lv_observer_core_init(void);
+
+/**
+ * Free the list of pending coalesced notifications
+ */
+void lv_observer_core_deinit(void);
+
 /**********************
  *      MACROS
  **********************/
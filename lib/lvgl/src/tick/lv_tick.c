@@ -64,6 +64,13 @@ uint32_t lv_tick_get(void)
     return result;
 }
 
+uint32_t lv_tick_get_us(void)
+{
+    if(state.tick_us_get_cb) return state.tick_us_get_cb();
+
+    return lv_tick_get() * 1000;
+}
+
 uint32_t lv_tick_elaps(uint32_t prev_tick)
 {
     uint32_t act_time = lv_tick_get();
@@ -103,6 +110,11 @@ void lv_tick_set_cb(lv_tick_get_cb_t cb)
     state.tick_get_cb = cb;
 }
 
+void lv_tick_set_us_cb(lv_tick_get_cb_t cb)
+{
+    state.tick_us_get_cb = cb;
+}
+
 void lv_delay_set_cb(lv_delay_cb_t cb)
 {
     state.delay_cb = cb;
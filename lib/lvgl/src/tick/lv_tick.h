@@ -47,6 +47,13 @@ LV_ATTRIBUTE_TICK_INC void lv_tick_inc(uint32_t tick_period);
  */
 uint32_t lv_tick_get(void);
 
+/**
+ * Get the elapsed microseconds since start up (wrapping around at `UINT32_MAX`)
+ * from the callback set by `lv_tick_set_us_cb()`. Without it the millisecond tick is used.
+ * @return          the elapsed microseconds
+ */
+uint32_t lv_tick_get_us(void);
+
 /**
  * Get the elapsed milliseconds since a previous time stamp
  * @param prev_tick     a previous time stamp (return value of lv_tick_get() )
@@ -68,6 +75,12 @@ void lv_delay_ms(uint32_t ms);
  */
 void lv_tick_set_cb(lv_tick_get_cb_t cb);
 
+/**
+ * Set a callback for 'lv_tick_get_us' to measure short times, e.g. the decoding of images
+ * @param cb        call this callback on 'lv_tick_get_us', it should return microseconds
+ */
+void lv_tick_set_us_cb(lv_tick_get_cb_t cb);
+
 /**
  * Set a custom callback for 'lv_delay_ms'
  * @param cb        call this callback in 'lv_delay_ms'
@@ -28,6 +28,7 @@ typedef struct {
     uint32_t sys_time;
     volatile uint8_t sys_irq_flag;
     lv_tick_get_cb_t tick_get_cb;
+    lv_tick_get_cb_t tick_us_get_cb;
     lv_delay_cb_t delay_cb;
 } lv_tick_state_t;
 
@@ -817,7 +817,15 @@ static void draw_main(lv_event_t * e)
     lv_area_t txt_clip;
     bool is_common = lv_area_intersect(&txt_clip, &txt_coords, &layer->_clip_area);
     if(!is_common) {
-        return;
+        /*Glyphs can be drawn a little out of the text area (see LV_EVENT_REFR_EXT_DRAW_SIZE),
+         *so draw them even if only that part is refreshed. Scrolled texts are clipped to the text area.*/
+        lv_area_t txt_ext = txt_coords;
+        int32_t ext = lv_font_get_line_height(label_draw_dsc.font) / 4;
+        lv_area_increase(&txt_ext, ext, ext);
+        if(label->long_mode == LV_LABEL_LONG_SCROLL || label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR ||
+           !lv_area_is_on(&txt_ext, &layer->_clip_area)) {
+            return;
+        }
     }
 
     if(label->long_mode == LV_LABEL_LONG_WRAP) {
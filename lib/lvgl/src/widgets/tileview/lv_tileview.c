@@ -36,6 +36,7 @@ const lv_obj_class_t lv_tileview_class = {
     .base_class = &lv_obj_class,
     .instance_size = sizeof(lv_tileview_t),
     .name = "tileview",
+    .scroll_blit = 1,
 };
 
 const lv_obj_class_t lv_tileview_tile_class = {
@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+
+"""
+Format the binary log records written by LVGL with `LV_LOG_DEFERRED`.
+
+The firmware stores the level, the tick, the line number, the addresses of the format string, the file and
+the function name, and the raw arguments of each log (see `lv_log_deferred_drain()` in
+`lib/lvgl/src/misc/lv_log.h`). The strings are read back from the ELF file of the same build, so it must
+match the firmware running on the board.
+
+Bytes between the records (e.g. text printed with `Serial.println()`) are passed through unchanged.
+
+Usage:
+    decode_log.py [--elf .pio/build/seeed-xiao-esp32-c6/firmware.elf] [input]
+
+`input` is a file or a serial device configured for raw reading (e.g. `/dev/ttyACM0` after
+`stty -F /dev/ttyACM0 115200 raw`). It defaults to the standard input.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+DEFAULT_ELF = ".pio/build/seeed-xiao-esp32-c6/firmware.elf"
+
+LEVELS = ["Trace", "Info", "Warn", "Error", "User"]
+LEVEL_NONE = 5
+
+SHT_NOBITS = 8
+SHF_ALLOC = 0x2
+
+CONVERSION_RE = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|z|j|t|L)?([diuxXocpfFeEgGs%])")
+
+
+class Elf:
+    """The loaded sections of an ELF file, to read the constant strings by their address."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF":
+            raise ValueError(f"{path} is not an ELF file")
+        self.is_64 = self.data[4] == 2
+        self.endian = "<" if self.data[5] == 1 else ">"
+        if self.is_64:
+            shoff, = struct.unpack_from(self.endian + "Q", self.data, 0x28)
+            shentsize, shnum = struct.unpack_from(self.endian + "HH", self.data, 0x3A)
+        else:
+            shoff, = struct.unpack_from(self.endian + "I", self.data, 0x20)
+            shentsize, shnum = struct.unpack_from(self.endian + "HH", self.data, 0x2E)
+
+        self.sections = []
+        for i in range(shnum):
+            off = shoff + i * shentsize
+            if self.is_64:
+                _, sh_type, flags, addr, offset, size = struct.unpack_from(self.endian + "IIQQQQ", self.data, off)
+            else:
+                _, sh_type, flags, addr, offset, size = struct.unpack_from(self.endian + "IIIIII", self.data, off)
+            if flags & SHF_ALLOC and sh_type != SHT_NOBITS and addr:
+                self.sections.append((addr, offset, size))
+
+    def string(self, addr):
+        if addr == 0:
+            return None
+        for sec_addr, offset, size in self.sections:
+            if sec_addr <= addr < sec_addr + size:
+                start = offset + addr - sec_addr
+                end = self.data.index(b"\0", start)
+                return self.data[start:end].decode("utf-8", "replace")
+        return f"<0x{addr:x}>"
+
+
+def format_args(fmt, args, endian, ptr_size):
+    """Rebuild the message from the format string and the raw arguments, reading them as lv_log.c stored them."""
+    pos = 0
+    out = []
+    last = 0
+
+    def take(size, signed):
+        nonlocal pos
+        if pos + size > len(args):
+            raise IndexError
+        v = int.from_bytes(args[pos:pos + size], "little" if endian == "<" else "big", signed=signed)
+        pos += size
+        return v
+
+    try:
+        for m in CONVERSION_RE.finditer(fmt):
+            out.append(fmt[last:m.start()])
+            last = m.end()
+            flags, width, precision, length, conv = m.groups()
+            if conv == "%":
+                out.append("%")
+                continue
+            if width == "*":
+                width = str(take(4, True))
+            if precision == "*":
+                precision = str(take(4, True))
+            spec = "%" + flags + (width or "") + ("." + precision if precision is not None else "")
+
+            if conv in "diuxXoc":
+                if length in ("ll", "j"):
+                    size = 8
+                elif length in ("l", "z", "t"):
+                    size = ptr_size
+                else:
+                    size = 4
+                value = take(size, conv in "di")
+                out.append((spec + ("d" if conv == "u" else conv)) % value)
+            elif conv == "p":
+                out.append("0x%x" % take(ptr_size, False))
+            elif conv in "fFeEgG":
+                value, = struct.unpack(endian + "d", args[pos:pos + 8])
+                pos += 8
+                out.append((spec + conv) % value)
+            elif conv == "s":
+                end = args.index(b"\0", pos)
+                out.append((spec + "s") % args[pos:end].decode("utf-8", "replace"))
+                pos = end + 1
+    except (IndexError, ValueError, struct.error):
+        out.append("<truncated>")
+        return "".join(out)
+
+    out.append(fmt[last:])
+    return "".join(out)
+
+
+def decode(stream, elf, out):
+    """Read records from `stream` and print them to `out`."""
+    buf = b""
+    dropped = 0
+    while True:
+        chunk = stream.read(1024)
+        if chunk:
+            buf += chunk
+        i = 0
+        while i < len(buf):
+            magic = buf[i]
+            ptr_size = magic - 0xA0
+            if ptr_size not in (4, 8):
+                # Not a record, pass through the text
+                j = i + 1
+                while j < len(buf) and buf[j] - 0xA0 not in (4, 8):
+                    j += 1
+                out.write(buf[i:j].decode("utf-8", "replace"))
+                i = j
+                continue
+
+            header_size = 12 + 3 * ptr_size
+            if len(buf) - i < header_size:
+                break
+            level, args_size, dropped_before = buf[i + 1], buf[i + 2], buf[i + 3]
+            if level > LEVEL_NONE:
+                out.write(buf[i:i + 1].decode("utf-8", "replace"))
+                i += 1
+                continue
+            if len(buf) - i < header_size + args_size:
+                break
+
+            tick, line = struct.unpack_from(elf.endian + "II", buf, i + 4)
+            ptrs = struct.unpack_from(elf.endian + ("Q" if ptr_size == 8 else "I") * 3, buf, i + 12)
+            args = buf[i + header_size:i + header_size + args_size]
+            i += header_size + args_size
+
+            fmt, file, func = (elf.string(p) for p in ptrs)
+            msg = format_args(fmt or "", args, elf.endian, ptr_size)
+            if dropped_before:
+                dropped += dropped_before
+                out.write(f"[Log]\t{dropped_before} records dropped ({dropped} in total)\n")
+            if level == LEVEL_NONE:
+                out.write(msg)
+            else:
+                file_line = f" {file.replace(chr(92), '/').rsplit('/', 1)[-1]}:{line}" if file else ""
+                out.write(f"[{LEVELS[level]}]\t({tick // 1000}.{tick % 1000:03d})\t {func}: {msg}{file_line}\n")
+        buf = buf[i:]
+        out.flush()
+        if not chunk:
+            break
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--elf", default=DEFAULT_ELF, help="ELF file of the firmware (default: %(default)s)")
+    parser.add_argument("input", nargs="?", help="file or serial device with the log records (default: stdin)")
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+    stream = open(args.input, "rb", buffering=0) if args.input else sys.stdin.buffer
+    try:
+        decode(stream, elf, sys.stdout)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,448 @@
+#!/usr/bin/env python3
+
+"""
+Generate subset versions of the built-in LVGL fonts which contain only the glyphs the UI uses.
+
+The characters are collected from
+  - the texts SquareLine Studio sets in `src/ui/screens/*.c`, attributed to the font of the object
+    (or of its closest parent) or to `custom_font_default`
+  - the dynamic text character sets declared in `platformio.ini` with `custom_font_chars`
+
+For every font listed in `custom_font_subset` a `src/fonts/<font>.c` is written from
+`lib/lvgl/src/font/<font>.c`. The glyph ids are renumbered in code point order and the code points are
+mapped with dense cmaps, so looking up a glyph is a direct index. Kerning classes are kept for the
+remaining glyphs.
+
+Used as a PlatformIO pre script (`extra_scripts = pre:scripts/subset_fonts.py`) or standalone:
+    subset_fonts.py [--project-dir .] [--force]
+"""
+
+import argparse
+import configparser
+import glob
+import os
+import re
+import sys
+
+FONT_SRC_DIR = os.path.join("lib", "lvgl", "src", "font")
+SCREENS_GLOB = os.path.join("src", "ui", "screens", "*.c")
+OUT_DIR = os.path.join("src", "fonts")
+
+# A cmap covering a gap longer than this is split, else one direct-indexed cmap is used
+CMAP_MAX_GAP = 16
+
+
+def parse_c_string(literal):
+    """Decode the content of a C string literal (UTF-8 source) to a Python string."""
+    out = bytearray()
+    i = 0
+    while i < len(literal):
+        c = literal[i]
+        if c != "\\":
+            out += c.encode("utf-8")
+            i += 1
+            continue
+        n = literal[i + 1]
+        if n == "x":
+            m = re.match(r"[0-9a-fA-F]+", literal[i + 2:])
+            out.append(int(m.group(0), 16) & 0xFF)
+            i += 2 + len(m.group(0))
+        elif n in "01234567":
+            m = re.match(r"[0-7]{1,3}", literal[i + 1:])
+            out.append(int(m.group(0), 8) & 0xFF)
+            i += 1 + len(m.group(0))
+        else:
+            out += {"n": b"\n", "t": b"\t", "r": b"\r", "0": b"\0"}.get(n, n.encode("utf-8"))
+            i += 2
+    return out.decode("utf-8", "replace")
+
+
+def scan_screens(paths, default_font):
+    """Return {font name: set of characters} for the static texts of the SquareLine screens."""
+    chars = {}
+    for path in paths:
+        with open(path, encoding="utf-8") as f:
+            src = f.read()
+
+        parents = dict(re.findall(r"(\w+)\s*=\s*lv_\w+_create\(\s*(\w+)\s*\)", src))
+        fonts = dict(re.findall(r"lv_obj_set_style_text_font\(\s*(\w+)\s*,\s*&(\w+)", src))
+        texts = re.findall(r"lv_(?:label_set_text|textarea_set_text|textarea_set_placeholder_text)"
+                           r"\(\s*(\w+)\s*,\s*\"((?:[^\"\\]|\\.)*)\"", src)
+
+        for obj, literal in texts:
+            font = None
+            o = obj
+            while o is not None and font is None:
+                font = fonts.get(o)
+                o = parents.get(o)
+            chars.setdefault(font or default_font, set()).update(parse_c_string(literal))
+    return chars
+
+
+class SourceFont:
+    """The parts of a font generated by lv_font_conv which are needed to write a subset."""
+
+    def __init__(self, path):
+        with open(path, encoding="utf-8") as f:
+            self.src = f.read()
+
+        header = re.search(r"/\*+\n(.*?)\*+/", self.src, re.S)
+        self.header = [l.strip(" *") for l in header.group(1).splitlines()] if header else []
+
+        self.bitmap = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", self.array("glyph_bitmap"))]
+        self.glyph_dsc = [dict((k, int(v)) for k, v in re.findall(r"\.(\w+)\s*=\s*(-?\d+)", g))
+                          for g in re.findall(r"\{([^{}]*)\}", self.array("glyph_dsc"))]
+
+        self.cmap = {}
+        for c in re.findall(r"\{([^{}]*)\}", self.array("cmaps")):
+            start = int(re.search(r"\.range_start\s*=\s*(\d+)", c).group(1))
+            length = int(re.search(r"\.range_length\s*=\s*(\d+)", c).group(1))
+            gid_start = int(re.search(r"\.glyph_id_start\s*=\s*(\d+)", c).group(1))
+            ctype = re.search(r"\.type\s*=\s*(\w+)", c).group(1)
+            ulist = re.search(r"\.unicode_list\s*=\s*(\w+)", c).group(1)
+            if ctype == "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY":
+                for rcp in range(length):
+                    self.cmap[start + rcp] = gid_start + rcp
+            elif ctype == "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY":
+                for i, rcp in enumerate(self.ints(self.array(ulist))):
+                    self.cmap[start + rcp] = gid_start + i
+            else:
+                raise ValueError("%s: cmap type %s is not supported" % (path, ctype))
+
+        self.kern_classes = None
+        if re.search(r"\bkern_left_class_mapping\[\]", self.src):
+            self.kern_classes = {
+                "left": self.ints(self.array("kern_left_class_mapping")),
+                "right": self.ints(self.array("kern_right_class_mapping")),
+                "values": self.ints(self.array("kern_class_values")),
+                "left_cnt": self.field("left_class_cnt"),
+                "right_cnt": self.field("right_class_cnt"),
+            }
+
+        self.name = re.search(r"^const lv_font_t (\w+) = \{", self.src, re.M).group(1)
+        self.bpp = self.field("bpp")
+        self.bitmap_format = self.field("bitmap_format")
+        self.kern_scale = self.field("kern_scale")
+        self.line_height = self.field("line_height")
+        self.base_line = self.field("base_line")
+        self.underline_position = self.field("underline_position")
+        self.underline_thickness = self.field("underline_thickness")
+        self.subpx = re.search(r"\.subpx\s*=\s*(\w+)", self.src).group(1)
+
+    def array(self, name):
+        m = re.search(r"\b%s\[\]\s*=\s*\{(.*?)\n\};" % name, self.src, re.S)
+        if not m:
+            raise ValueError("array %s not found" % name)
+        return re.sub(r"/\*.*?\*/", "", m.group(1), flags=re.S)
+
+    def field(self, name):
+        return int(re.search(r"\.%s\s*=\s*(-?\d+)" % name, self.src).group(1))
+
+    @staticmethod
+    def ints(text):
+        return [int(v, 0) for v in re.findall(r"-?(?:0x[0-9a-fA-F]+|\d+)", text)]
+
+    def glyph_bitmap(self, gid):
+        start = self.glyph_dsc[gid]["bitmap_index"]
+        nexts = [g["bitmap_index"] for g in self.glyph_dsc[gid + 1:] if g["bitmap_index"] > start]
+        end = nexts[0] if nexts else len(self.bitmap)
+        if self.glyph_dsc[gid]["box_w"] == 0 or self.glyph_dsc[gid]["box_h"] == 0:
+            end = start
+        return self.bitmap[start:end]
+
+
+def dense_cmaps(cps):
+    """Split the sorted code points (glyph id = index + 1) into direct-indexed cmaps."""
+    groups = []
+    for i, cp in enumerate(cps):
+        if groups and cp - groups[-1][-1][0] <= CMAP_MAX_GAP:
+            groups[-1].append((cp, i + 1))
+        else:
+            groups.append([(cp, i + 1)])
+
+    cmaps = []
+    for g in groups:
+        start, length = g[0][0], g[-1][0] - g[0][0] + 1
+        if length == len(g):
+            cmaps.append({"start": start, "length": length, "gid_start": g[0][1], "ofs": None})
+        elif g[-1][1] < 256:
+            # Glyph id offsets from 0: missing code points map to glyph id 0, i.e. "no glyph"
+            ofs = [0] * length
+            for cp, gid in g:
+                ofs[cp - start] = gid
+            cmaps.append({"start": start, "length": length, "gid_start": 0, "ofs": ofs})
+        else:
+            for cp, gid in g:
+                if cmaps and cmaps[-1]["ofs"] is None and cmaps[-1]["start"] + cmaps[-1]["length"] == cp:
+                    cmaps[-1]["length"] += 1
+                else:
+                    cmaps.append({"start": cp, "length": 1, "gid_start": gid, "ofs": None})
+    return cmaps
+
+
+def c_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt % v for v in values[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def char_comment(cp):
+    c = chr(cp)
+    if c in "\\\"" or cp < 0x20 or cp == 0x7F:
+        c = ""
+    if c in ("*", "/"):
+        c = " %s " % c
+    return "U+%04X \"%s\"" % (cp, c)
+
+
+def subset_kern(font, gids):
+    """Return the kern class tables for the new glyph ids with the unused classes removed."""
+    kc = font.kern_classes
+    left_used = sorted(set(kc["left"][g] for g in gids) - {0})
+    right_used = sorted(set(kc["right"][g] for g in gids) - {0})
+    left_new = dict((c, i + 1) for i, c in enumerate(left_used))
+    right_new = dict((c, i + 1) for i, c in enumerate(right_used))
+
+    values = []
+    for l in left_used:
+        for r in right_used:
+            values.append(kc["values"][(l - 1) * kc["right_cnt"] + (r - 1)])
+
+    return {
+        "left": [0] + [left_new.get(kc["left"][g], 0) for g in gids],
+        "right": [0] + [right_new.get(kc["right"][g], 0) for g in gids],
+        "values": values,
+        "left_cnt": len(left_used),
+        "right_cnt": len(right_used),
+    }
+
+
+def write_subset(font, chars, out_path, src_rel):
+    cps = sorted(cp for cp in set(ord(c) for c in chars) if cp >= 0x20)
+    missing = [cp for cp in cps if cp not in font.cmap]
+    if missing:
+        print("subset_fonts: %s has no glyph for %s" % (font.name, ", ".join("U+%04X" % cp for cp in missing)))
+    cps = [cp for cp in cps if cp in font.cmap]
+    gids = [font.cmap[cp] for cp in cps]
+
+    glyphs = []
+    dscs = ["    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */"]
+    index = 0
+    for cp, gid in zip(cps, gids):
+        data = font.glyph_bitmap(gid)
+        glyphs.append((cp, data))
+        d = font.glyph_dsc[gid]
+        dscs.append("    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d}" %
+                    (index, d["adv_w"], d["box_w"], d["box_h"], d["ofs_x"], d["ofs_y"]))
+        index += len(data)
+
+    cmaps = dense_cmaps(cps)
+    guard = font.name.upper()
+    o = []
+    o.append("/*******************************************************************************")
+    o.append(" * Subset of %s generated by scripts/subset_fonts.py, do not edit." % src_rel)
+    o.append(" * Glyphs: %s" % "".join(chr(cp) for cp in cps).replace("*/", "* /"))
+    for l in font.header:
+        if l:
+            o.append(" * %s" % l)
+    o.append(" ******************************************************************************/")
+    o.append("")
+    o.append("#include <lvgl.h>")
+    o.append("")
+    o.append("#if !%s" % guard)
+    o.append("")
+    o.append("/*-----------------")
+    o.append(" *    BITMAPS")
+    o.append(" *----------------*/")
+    o.append("")
+    o.append("/*Store the image of the glyphs*/")
+    o.append("static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {")
+    last = max([i for i, g in enumerate(glyphs) if g[1]] or [-1])
+    for i, (cp, data) in enumerate(glyphs):
+        o.append("    /* %s */" % char_comment(cp))
+        if data:
+            o.append(c_array(data, "0x%x", 8) + ("," if i < last else ""))
+        if i < len(glyphs) - 1:
+            o.append("")
+    if last < 0:
+        o.append("    0")
+    o.append("};")
+    o.append("")
+    o.append("/*---------------------")
+    o.append(" *  GLYPH DESCRIPTION")
+    o.append(" *--------------------*/")
+    o.append("")
+    o.append("static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {")
+    o.append(",\n".join(dscs))
+    o.append("};")
+    o.append("")
+    o.append("/*---------------------")
+    o.append(" *  CHARACTER MAPPING")
+    o.append(" *--------------------*/")
+    o.append("")
+    for i, c in enumerate(cmaps):
+        if c["ofs"] is not None:
+            o.append("static const uint8_t glyph_id_ofs_list_%d[] = {" % i)
+            o.append(c_array(c["ofs"], "%d", 16))
+            o.append("};")
+            o.append("")
+    o.append("/*Collect the unicode lists and glyph_id offsets*/")
+    o.append("static const lv_font_fmt_txt_cmap_t cmaps[] = {")
+    entries = []
+    for i, c in enumerate(cmaps):
+        if c["ofs"] is None:
+            ofs, ctype = "NULL", "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY"
+        else:
+            ofs, ctype = "glyph_id_ofs_list_%d" % i, "LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL"
+        entries.append("    {\n        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+                       "        .unicode_list = NULL, .glyph_id_ofs_list = %s, .list_length = 0, .type = %s\n    }" %
+                       (c["start"], c["length"], c["gid_start"], ofs, ctype))
+    o.append(",\n".join(entries))
+    o.append("};")
+    o.append("")
+
+    kern = subset_kern(font, gids) if font.kern_classes and gids else None
+    if kern and kern["left_cnt"] and kern["right_cnt"]:
+        o.append("/*-----------------")
+        o.append(" *    KERNING")
+        o.append(" *----------------*/")
+        o.append("")
+        o.append("/*Map glyph_ids to kern left classes*/")
+        o.append("static const uint8_t kern_left_class_mapping[] = {")
+        o.append(c_array(kern["left"], "%d", 16))
+        o.append("};")
+        o.append("")
+        o.append("/*Map glyph_ids to kern right classes*/")
+        o.append("static const uint8_t kern_right_class_mapping[] = {")
+        o.append(c_array(kern["right"], "%d", 16))
+        o.append("};")
+        o.append("")
+        o.append("/*Kern values between classes*/")
+        o.append("static const int8_t kern_class_values[] = {")
+        o.append(c_array(kern["values"], "%d", 16))
+        o.append("};")
+        o.append("")
+        o.append("/*Collect the kern class' data in one place*/")
+        o.append("static const lv_font_fmt_txt_kern_classes_t kern_classes = {")
+        o.append("    .class_pair_values   = kern_class_values,")
+        o.append("    .left_class_mapping  = kern_left_class_mapping,")
+        o.append("    .right_class_mapping = kern_right_class_mapping,")
+        o.append("    .left_class_cnt      = %d," % kern["left_cnt"])
+        o.append("    .right_class_cnt     = %d," % kern["right_cnt"])
+        o.append("};")
+        o.append("")
+    else:
+        kern = None
+
+    o.append("/*--------------------")
+    o.append(" *  ALL CUSTOM DATA")
+    o.append(" *--------------------*/")
+    o.append("")
+    o.append("/*Store all the custom data of the font*/")
+    o.append("static const lv_font_fmt_txt_dsc_t font_dsc = {")
+    o.append("    .glyph_bitmap = glyph_bitmap,")
+    o.append("    .glyph_dsc = glyph_dsc,")
+    o.append("    .cmaps = cmaps,")
+    o.append("    .kern_dsc = %s," % ("&kern_classes" if kern else "NULL"))
+    o.append("    .kern_scale = %d," % (font.kern_scale if kern else 0))
+    o.append("    .cmap_num = %d," % len(cmaps))
+    o.append("    .bpp = %d," % font.bpp)
+    o.append("    .kern_classes = %d," % (1 if kern else 0))
+    o.append("    .bitmap_format = %d," % font.bitmap_format)
+    o.append("};")
+    o.append("")
+    o.append("/*-----------------")
+    o.append(" *  PUBLIC FONT")
+    o.append(" *----------------*/")
+    o.append("")
+    o.append("/*Initialize a public general font descriptor*/")
+    o.append("const lv_font_t %s = {" % font.name)
+    o.append("    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/")
+    o.append("    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/")
+    o.append("    .line_height = %d,          /*The maximum line height required by the font*/" % font.line_height)
+    o.append("    .base_line = %d,             /*Baseline measured from the bottom of the line*/" % font.base_line)
+    o.append("    .subpx = %s," % font.subpx)
+    o.append("    .underline_position = %d," % font.underline_position)
+    o.append("    .underline_thickness = %d," % font.underline_thickness)
+    o.append("    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */")
+    o.append("};")
+    o.append("")
+    o.append("#endif /*#if !%s*/" % guard)
+    o.append("")
+
+    with open(out_path, "w", encoding="utf-8") as f:
+        f.write("\n".join(o))
+
+    return len(cps), len(font.glyph_dsc) - 1, index, len(font.bitmap)
+
+
+def parse_option_list(value):
+    return [v.strip() for v in value.replace(",", "\n").splitlines() if v.strip()]
+
+
+def parse_chars(value):
+    """`custom_font_chars` lines are `<font>: <characters>`."""
+    chars = {}
+    for line in value.splitlines():
+        if ":" not in line:
+            continue
+        name, text = line.split(":", 1)
+        chars.setdefault(name.strip(), set()).update(parse_c_string(text.strip()))
+    return chars
+
+
+def run(project_dir, fonts, default_font, declared, force=False, verbose=True):
+    screens = sorted(glob.glob(os.path.join(project_dir, SCREENS_GLOB)))
+    chars = scan_screens(screens, default_font)
+    for name, c in declared.items():
+        chars.setdefault(name, set()).update(c)
+
+    out_dir = os.path.join(project_dir, OUT_DIR)
+    os.makedirs(out_dir, exist_ok=True)
+    inputs = screens + [os.path.join(project_dir, "scripts", "subset_fonts.py"),
+                        os.path.join(project_dir, "platformio.ini")]
+
+    for name in fonts:
+        src_rel = os.path.join(FONT_SRC_DIR, name + ".c")
+        src = os.path.join(project_dir, src_rel)
+        out = os.path.join(out_dir, name + ".c")
+        newest = max(os.path.getmtime(p) for p in inputs + [src] if os.path.exists(p))
+        if not force and os.path.exists(out) and os.path.getmtime(out) >= newest:
+            continue
+
+        # The space is always needed, e.g. for line breaking
+        font_chars = chars.get(name, set()) | {" "}
+        kept, total, size, total_size = write_subset(SourceFont(src), font_chars, out, src_rel.replace(os.sep, "/"))
+        if verbose:
+            print("subset_fonts: %s: %d of %d glyphs, %d of %d bitmap bytes" % (name, kept, total, size, total_size))
+
+
+def read_ini_options(project_dir):
+    cfg = configparser.ConfigParser(interpolation=None)
+    cfg.read(os.path.join(project_dir, "platformio.ini"))
+    section = next((s for s in cfg.sections() if s.startswith("env:")), None)
+    return (lambda key, default="": cfg.get(section, key, fallback=default)) if section else (lambda k, d="": d)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate subset LVGL fonts for the glyphs used by the UI")
+    parser.add_argument("--project-dir", default=".", help="PlatformIO project directory")
+    parser.add_argument("--force", action="store_true", help="regenerate even if the outputs are up to date")
+    args = parser.parse_args()
+
+    opt = read_ini_options(args.project_dir)
+    run(args.project_dir, parse_option_list(opt("custom_font_subset")), opt("custom_font_default").strip(),
+        parse_chars(opt("custom_font_chars")), args.force)
+
+
+if __name__ == "__main__":
+    main()
+elif "SCons" in sys.modules:
+    Import("env")  # noqa: F821 (provided by PlatformIO)
+
+    def opt(key):
+        return env.GetProjectOption(key, "")  # noqa: F821
+
+    run(env.subst("$PROJECT_DIR"), parse_option_list(opt("custom_font_subset")),  # noqa: F821
+        opt("custom_font_default").strip(), parse_chars(opt("custom_font_chars")))
@@ -0,0 +1,325 @@
+/*******************************************************************************
+ * Subset of lib/lvgl/src/font/lv_font_montserrat_14.c generated by scripts/subset_fonts.py, do not edit.
+ * Glyphs:  .0123456789:DFKOPSchitw
+ * Size: 14 px
+ * Bpp: 4
+ * Opts: --no-compress --no-prefilter --bpp 4 --size 14 --font Montserrat-Medium.ttf -r 0x20-0x7F,0xB0,0x2022 --font FontAwesome5-Solid+Brands+Regular.woff -r 61441,61448,61451,61452,61452,61453,61457,61459,61461,61465,61468,61473,61478,61479,61480,61502,61507,61512,61515,61516,61517,61521,61522,61523,61524,61543,61544,61550,61552,61553,61556,61559,61560,61561,61563,61587,61589,61636,61637,61639,61641,61664,61671,61674,61683,61724,61732,61787,61931,62016,62017,62018,62019,62020,62087,62099,62212,62189,62810,63426,63650 --format lvgl -o lv_font_montserrat_14.c --force-fast-kern-format
+ ******************************************************************************/
+
+#include <lvgl.h>
+
+#if !LV_FONT_MONTSERRAT_14
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+002E "." */
+    0x0, 0x3, 0xf5, 0x2e, 0x40,
+
+    /* U+0030 "0" */
+    0x0, 0x4c, 0xfe, 0x70, 0x0, 0x4f, 0xb6, 0x8f,
+    0x90, 0xd, 0xb0, 0x0, 0x5f, 0x32, 0xf4, 0x0,
+    0x0, 0xe7, 0x4f, 0x20, 0x0, 0xc, 0xa4, 0xf2,
+    0x0, 0x0, 0xca, 0x2f, 0x40, 0x0, 0xe, 0x70,
+    0xdb, 0x0, 0x5, 0xf2, 0x4, 0xfb, 0x68, 0xf9,
+    0x0, 0x4, 0xcf, 0xe7, 0x0,
+
+    /* U+0031 "1" */
+    0xef, 0xfb, 0x44, 0xcb, 0x0, 0xab, 0x0, 0xab,
+    0x0, 0xab, 0x0, 0xab, 0x0, 0xab, 0x0, 0xab,
+    0x0, 0xab, 0x0, 0xab,
+
+    /* U+0032 "2" */
+    0x7, 0xdf, 0xea, 0x10, 0x8e, 0x85, 0x7e, 0xc0,
+    0x1, 0x0, 0x6, 0xf1, 0x0, 0x0, 0x6, 0xf0,
+    0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0xcc, 0x0,
+    0x0, 0x1c, 0xc0, 0x0, 0x1, 0xdb, 0x0, 0x0,
+    0x1d, 0xe5, 0x44, 0x42, 0x7f, 0xff, 0xff, 0xf9,
+
+    /* U+0033 "3" */
+    0x7f, 0xff, 0xff, 0xf0, 0x24, 0x44, 0x5f, 0x90,
+    0x0, 0x0, 0xbc, 0x0, 0x0, 0x9, 0xe1, 0x0,
+    0x0, 0x3f, 0xd8, 0x10, 0x0, 0x4, 0x6d, 0xd0,
+    0x0, 0x0, 0x2, 0xf4, 0x10, 0x0, 0x2, 0xf4,
+    0xbd, 0x75, 0x7d, 0xd0, 0x19, 0xdf, 0xea, 0x10,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0xd, 0xa0, 0x0, 0x0, 0x0, 0xac,
+    0x0, 0x0, 0x0, 0x7, 0xe1, 0x0, 0x0, 0x0,
+    0x4f, 0x40, 0x10, 0x0, 0x2, 0xf6, 0x0, 0xf5,
+    0x0, 0x1d, 0xa0, 0x0, 0xf5, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xf3, 0x13, 0x33, 0x33, 0xf7, 0x30,
+    0x0, 0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0xf5, 0x0,
+
+    /* U+0035 "5" */
+    0x9, 0xff, 0xff, 0xf0, 0xa, 0xb4, 0x44, 0x40,
+    0xc, 0x80, 0x0, 0x0, 0xe, 0x70, 0x0, 0x0,
+    0xf, 0xff, 0xfc, 0x40, 0x3, 0x34, 0x5c, 0xf2,
+    0x0, 0x0, 0x0, 0xf7, 0x10, 0x0, 0x0, 0xf7,
+    0x8e, 0x85, 0x6c, 0xf1, 0x8, 0xdf, 0xfb, 0x30,
+
+    /* U+0036 "6" */
+    0x0, 0x2a, 0xef, 0xd5, 0x0, 0x3f, 0xd6, 0x57,
+    0x40, 0xc, 0xc0, 0x0, 0x0, 0x2, 0xf4, 0x0,
+    0x0, 0x0, 0x4f, 0x5b, 0xff, 0xa1, 0x4, 0xfe,
+    0x84, 0x5d, 0xd0, 0x3f, 0x80, 0x0, 0x3f, 0x30,
+    0xe8, 0x0, 0x3, 0xf2, 0x6, 0xf8, 0x45, 0xdc,
+    0x0, 0x5, 0xdf, 0xe9, 0x10,
+
+    /* U+0037 "7" */
+    0x9f, 0xff, 0xff, 0xfd, 0x9d, 0x44, 0x44, 0xe9,
+    0x9c, 0x0, 0x4, 0xf2, 0x0, 0x0, 0xb, 0xb0,
+    0x0, 0x0, 0x2f, 0x40, 0x0, 0x0, 0xad, 0x0,
+    0x0, 0x1, 0xf6, 0x0, 0x0, 0x8, 0xe0, 0x0,
+    0x0, 0xe, 0x80, 0x0, 0x0, 0x6f, 0x10, 0x0,
+
+    /* U+0038 "8" */
+    0x1, 0x9e, 0xfe, 0x91, 0x0, 0xbe, 0x63, 0x6e,
+    0xc0, 0xf, 0x60, 0x0, 0x6f, 0x0, 0xcc, 0x20,
+    0x2b, 0xc0, 0x2, 0xef, 0xff, 0xe2, 0x0, 0xdc,
+    0x42, 0x4c, 0xd0, 0x5f, 0x20, 0x0, 0x1f, 0x55,
+    0xf2, 0x0, 0x2, 0xf5, 0xe, 0xd5, 0x35, 0xde,
+    0x0, 0x1a, 0xef, 0xea, 0x10,
+
+    /* U+0039 "9" */
+    0x3, 0xbf, 0xea, 0x20, 0x2f, 0xa4, 0x4b, 0xe1,
+    0x8e, 0x0, 0x0, 0xe9, 0x9d, 0x0, 0x0, 0xdd,
+    0x4f, 0x71, 0x29, 0xff, 0x7, 0xff, 0xfc, 0x9e,
+    0x0, 0x2, 0x10, 0xac, 0x0, 0x0, 0x2, 0xf6,
+    0x7, 0x65, 0x8f, 0xb0, 0xa, 0xef, 0xd7, 0x0,
+
+    /* U+003A ":" */
+    0x2e, 0x53, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0x52, 0xe4,
+
+    /* U+0044 "D" */
+    0x8f, 0xff, 0xfe, 0xa4, 0x0, 0x8e, 0x44, 0x46,
+    0xcf, 0x70, 0x8e, 0x0, 0x0, 0x7, 0xf3, 0x8e,
+    0x0, 0x0, 0x0, 0xda, 0x8e, 0x0, 0x0, 0x0,
+    0x9d, 0x8e, 0x0, 0x0, 0x0, 0x9d, 0x8e, 0x0,
+    0x0, 0x0, 0xda, 0x8e, 0x0, 0x0, 0x7, 0xf3,
+    0x8e, 0x44, 0x46, 0xbf, 0x70, 0x8f, 0xff, 0xfe,
+    0xa4, 0x0,
+
+    /* U+0046 "F" */
+    0x8f, 0xff, 0xff, 0xf6, 0x8e, 0x44, 0x44, 0x41,
+    0x8e, 0x0, 0x0, 0x0, 0x8e, 0x0, 0x0, 0x0,
+    0x8e, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xc0,
+    0x8e, 0x33, 0x33, 0x20, 0x8e, 0x0, 0x0, 0x0,
+    0x8e, 0x0, 0x0, 0x0, 0x8e, 0x0, 0x0, 0x0,
+
+    /* U+004B "K" */
+    0x8e, 0x0, 0x0, 0x4f, 0x50, 0x8e, 0x0, 0x4,
+    0xf6, 0x0, 0x8e, 0x0, 0x3f, 0x70, 0x0, 0x8e,
+    0x3, 0xf8, 0x0, 0x0, 0x8e, 0x2e, 0xc0, 0x0,
+    0x0, 0x8e, 0xec, 0xf6, 0x0, 0x0, 0x8f, 0xb0,
+    0x7f, 0x30, 0x0, 0x8e, 0x0, 0xa, 0xe1, 0x0,
+    0x8e, 0x0, 0x0, 0xcc, 0x0, 0x8e, 0x0, 0x0,
+    0x1e, 0xa0,
+
+    /* U+004F "O" */
+    0x0, 0x7, 0xcf, 0xeb, 0x50, 0x0, 0x0, 0xcf,
+    0x96, 0x6b, 0xf9, 0x0, 0xa, 0xe2, 0x0, 0x0,
+    0x5f, 0x60, 0x1f, 0x60, 0x0, 0x0, 0xa, 0xd0,
+    0x4f, 0x20, 0x0, 0x0, 0x6, 0xf0, 0x4f, 0x20,
+    0x0, 0x0, 0x6, 0xf0, 0x1f, 0x60, 0x0, 0x0,
+    0xa, 0xd0, 0xa, 0xe2, 0x0, 0x0, 0x5f, 0x60,
+    0x0, 0xcf, 0x96, 0x6b, 0xfa, 0x0, 0x0, 0x7,
+    0xdf, 0xeb, 0x50, 0x0,
+
+    /* U+0050 "P" */
+    0x8f, 0xff, 0xfd, 0x70, 0x8, 0xe4, 0x45, 0x8f,
+    0xb0, 0x8e, 0x0, 0x0, 0x5f, 0x38, 0xe0, 0x0,
+    0x1, 0xf5, 0x8e, 0x0, 0x0, 0x3f, 0x48, 0xe0,
+    0x1, 0x4d, 0xd0, 0x8f, 0xff, 0xff, 0xb2, 0x8,
+    0xe3, 0x33, 0x10, 0x0, 0x8e, 0x0, 0x0, 0x0,
+    0x8, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+0053 "S" */
+    0x1, 0x9e, 0xfd, 0xa2, 0x0, 0xce, 0x64, 0x6b,
+    0x70, 0x2f, 0x40, 0x0, 0x0, 0x1, 0xf8, 0x0,
+    0x0, 0x0, 0x6, 0xfd, 0x95, 0x0, 0x0, 0x1,
+    0x6a, 0xee, 0x50, 0x0, 0x0, 0x0, 0x9f, 0x0,
+    0x20, 0x0, 0x5, 0xf1, 0x3f, 0xa5, 0x47, 0xeb,
+    0x0, 0x4b, 0xef, 0xe9, 0x10,
+
+    /* U+0063 "c" */
+    0x0, 0x7d, 0xfd, 0x60, 0x9, 0xf7, 0x48, 0xf4,
+    0x2f, 0x50, 0x0, 0x20, 0x5f, 0x0, 0x0, 0x0,
+    0x5f, 0x0, 0x0, 0x0, 0x2f, 0x50, 0x0, 0x20,
+    0x9, 0xf7, 0x48, 0xf4, 0x0, 0x7d, 0xfd, 0x60,
+
+    /* U+0068 "h" */
+    0xba, 0x0, 0x0, 0x0, 0xba, 0x0, 0x0, 0x0,
+    0xba, 0x0, 0x0, 0x0, 0xba, 0x8e, 0xfb, 0x20,
+    0xbf, 0xc5, 0x6d, 0xd0, 0xbe, 0x0, 0x3, 0xf2,
+    0xba, 0x0, 0x0, 0xf4, 0xba, 0x0, 0x0, 0xf5,
+    0xba, 0x0, 0x0, 0xf5, 0xba, 0x0, 0x0, 0xf5,
+    0xba, 0x0, 0x0, 0xf5,
+
+    /* U+0069 "i" */
+    0xba, 0xa8, 0x0, 0xba, 0xba, 0xba, 0xba, 0xba,
+    0xba, 0xba, 0xba,
+
+    /* U+0074 "t" */
+    0x8, 0xd0, 0x0, 0x8, 0xd0, 0x0, 0xcf, 0xff,
+    0xf0, 0x29, 0xd3, 0x20, 0x8, 0xd0, 0x0, 0x8,
+    0xd0, 0x0, 0x8, 0xd0, 0x0, 0x8, 0xd0, 0x0,
+    0x5, 0xf5, 0x51, 0x0, 0x9f, 0xe3,
+
+    /* U+0077 "w" */
+    0xc8, 0x0, 0x6, 0xf1, 0x0, 0xd, 0x56, 0xd0,
+    0x0, 0xcf, 0x60, 0x3, 0xf0, 0x1f, 0x30, 0x2f,
+    0x9c, 0x0, 0x9a, 0x0, 0xb8, 0x7, 0xb2, 0xf1,
+    0xe, 0x40, 0x5, 0xe0, 0xd6, 0xc, 0x74, 0xe0,
+    0x0, 0xf, 0x6f, 0x0, 0x7c, 0x99, 0x0, 0x0,
+    0xaf, 0xa0, 0x1, 0xff, 0x40, 0x0, 0x5, 0xf4,
+    0x0, 0xb, 0xe0, 0x0
+};
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 60, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 51, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5, .adv_w = 149, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 50, .adv_w = 83, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 70, .adv_w = 129, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 110, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 150, .adv_w = 150, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 200, .adv_w = 129, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 240, .adv_w = 138, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 285, .adv_w = 134, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 325, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 370, .adv_w = 138, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 410, .adv_w = 51, .box_w = 3, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 422, .adv_w = 185, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 472, .adv_w = 142, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 512, .adv_w = 161, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 562, .adv_w = 188, .box_w = 12, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 622, .adv_w = 162, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 667, .adv_w = 139, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 712, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 744, .adv_w = 153, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 788, .adv_w = 62, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 799, .adv_w = 93, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 829, .adv_w = 201, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 0}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint8_t glyph_id_ofs_list_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 14, 0, 15, 0, 0, 0, 0, 16, 0, 0, 0, 17,
+    18, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 20, 0, 0, 0, 0, 21, 22, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 23, 0, 0, 24
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 88, .glyph_id_start = 0,
+        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_0, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 2, 3, 0, 4, 5, 6, 7, 8, 9, 10, 3, 11, 12, 13,
+    14, 12, 15, 1, 17, 16, 18, 19, 20
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 2, 3, 4, 5, 6, 7, 8, 3, 9, 10, 11, 12, 14, 14,
+    14, 13, 14, 1, 16, 15, 17, 18, 19
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 4, 0, -2, 0, -2, 2, 0, -2, 0, -2, -1, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, -3, -3, 2, 2, -2, 0, -3, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -3, 0, -1, -1, -2, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 2, -1, 0, 0, 0, -4,
+    0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0,
+    -1, -1, 0, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2,
+    4, 0, -6, -1, -3, 0, -1, -11, 2, -2, 2, 2, 0, 0, 3, 0,
+    0, -4, 0, 0, 0, 0, -1, -1, 0, -1, -3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 2, 0, 0, 0, 0, 0, 0, -2, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, -2, -2, -12, -4, 2, 0, -2, -15, -4,
+    0, -4, 0, -4, -4, 0, 0, -11, -5, -3, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, -2, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, -1, -2, -3, 3, 0, 0, -11, -4, 2, -4, 2, 0,
+    -2, 0, 0, -4, -2, 0, 1, -3, 0, -5, 4, 0, -2, -11, 0, 0,
+    -5, -2, 0, -6, 0, 0, -5, -2, -6, -8, 0, -6, 0, 0, -1, -3,
+    -7, -2, 0, -2, 0, 0, 0, -2, 0, -3, -4, 1, -2, 0, 0, 0,
+    -5, -1, 0, 0, 0, -5, 0, -3, 0, 0, 0, 0, 1, 0, 0, -2,
+    0, 4, -2, -5, -2, -4, -4, 0, -3, -1, -2, 2, -1, 0, -2, -2,
+    0, 2, -2, -4, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, -4, -4, -2, 0, -6, -2, -5, -2,
+    -3, 0, 0, 0, 0, -4, 0, -3, -2, -2, -7, 2, 2, 2, 0, -6,
+    2, 3, 2, 7, 2, -2, 0, 0, -3, 0, 3, -2
+};
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 20,
+    .right_class_cnt     = 19,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 1,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t lv_font_montserrat_14 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 16,          /*The maximum line height required by the font*/
+    .base_line = 3,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -1,
+    .underline_thickness = 1,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
+
+#endif /*#if !LV_FONT_MONTSERRAT_14*/
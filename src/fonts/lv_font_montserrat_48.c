@@ -0,0 +1,780 @@
+/*******************************************************************************
+ * Subset of lib/lvgl/src/font/lv_font_montserrat_48.c generated by scripts/subset_fonts.py, do not edit.
+ * Glyphs:  %0123456789
+ * Size: 48 px
+ * Bpp: 4
+ * Opts: --no-compress --no-prefilter --bpp 4 --size 48 --font Montserrat-Medium.ttf -r 0x20-0x7F,0xB0,0x2022 --font FontAwesome5-Solid+Brands+Regular.woff -r 61441,61448,61451,61452,61452,61453,61457,61459,61461,61465,61468,61473,61478,61479,61480,61502,61507,61512,61515,61516,61517,61521,61522,61523,61524,61543,61544,61550,61552,61553,61556,61559,61560,61561,61563,61587,61589,61636,61637,61639,61641,61664,61671,61674,61683,61724,61732,61787,61931,62016,62017,62018,62019,62020,62087,62099,62212,62189,62810,63426,63650 --format lvgl -o lv_font_montserrat_48.c --force-fast-kern-format
+ ******************************************************************************/
+
+#include <lvgl.h>
+
+#if !LV_FONT_MONTSERRAT_48
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0025 "%" */
+    0x0, 0x0, 0x5, 0xbe, 0xfe, 0xc7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xff,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0xfe, 0xcd, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xfe, 0x40, 0x0, 0x3c, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf2, 0x0,
+    0x0, 0x1, 0xdf, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x5f, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0x40, 0x0, 0x0,
+    0x3, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0x50, 0x0, 0x0, 0xd, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0x50, 0x0, 0x0, 0x8f, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x40, 0x0,
+    0x3, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0x30, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0x10, 0x0, 0xd, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x5f, 0xfd, 0x0, 0x0, 0x9f, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xf2, 0x0, 0x0, 0x1, 0xdf, 0xf7, 0x0,
+    0x4, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xfe, 0x50, 0x0, 0x3c,
+    0xff, 0xe0, 0x0, 0xe, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
+    0xfe, 0xce, 0xff, 0xff, 0x30, 0x0, 0x9f, 0xff,
+    0x20, 0x0, 0x16, 0xab, 0xb9, 0x40, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xff, 0xff, 0xe4, 0x0,
+    0x4, 0xff, 0xf6, 0x0, 0x5, 0xef, 0xff, 0xff,
+    0xfc, 0x30, 0x0, 0x0, 0x0, 0x5, 0xbe, 0xfe,
+    0xc7, 0x0, 0x0, 0x1e, 0xff, 0xb0, 0x0, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0x10, 0x3, 0xff, 0xfb, 0x30, 0x15, 0xef, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xf6, 0x0, 0xd, 0xff, 0xa0, 0x0,
+    0x0, 0x1d, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1e, 0xff, 0xb0, 0x0, 0x3f,
+    0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe,
+    0x10, 0x0, 0x8f, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xf5, 0x0, 0x0, 0xbf, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1e, 0xff, 0xb0, 0x0, 0x0,
+    0xdf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe,
+    0x10, 0x0, 0x0, 0xef, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xdf, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1e, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0xcf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x9f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xfd, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0x70, 0x0, 0x0, 0xc,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf7,
+    0x0, 0x2, 0xbf, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xfd, 0xdf, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x39, 0xdf, 0xfd, 0x81, 0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x8b, 0xef, 0xfe,
+    0xc8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xff, 0xfb, 0x75, 0x57,
+    0xbf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x1, 0xbf,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0xbf, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfb, 0x0,
+    0x2, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xff, 0x20, 0x8, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0x80, 0xd, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xd0, 0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf1,
+    0x5f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf5, 0x7f, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xf7, 0x9f, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xf9, 0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfa,
+    0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb, 0xaf, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xfb, 0xaf, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xfa, 0x9f, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf9,
+    0x7f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf7, 0x5f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xf5, 0x1f, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xf1, 0xd, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xd0,
+    0x8, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0x90, 0x2, 0xff,
+    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0x20, 0x0, 0xbf, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xfb, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xfb, 0x76, 0x67, 0xbf, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xc8, 0x30,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0031 "1" */
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x23, 0x33, 0x33, 0x34, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xfb,
+
+    /* U+0032 "2" */
+    0x0, 0x0, 0x0, 0x3, 0x7b, 0xde, 0xff, 0xed,
+    0x96, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x50, 0x0, 0xb, 0xff, 0xff, 0xff,
+    0xfa, 0x76, 0x55, 0x7a, 0xff, 0xff, 0xff, 0xf2,
+    0x0, 0x1c, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xbf,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0x0, 0x0, 0x9, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xfe,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0xff, 0xf5, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x1, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe,
+
+    /* U+0033 "3" */
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x38, 0xff, 0xff, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0xa7, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xee, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x13, 0x8e, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xf2, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xe0, 0x6,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0xff, 0x90, 0xe, 0xff, 0xfe, 0x72,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xff,
+    0x10, 0x8f, 0xff, 0xff, 0xff, 0xd9, 0x76, 0x56,
+    0x7a, 0xef, 0xff, 0xff, 0xf7, 0x0, 0x2d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x1, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x26, 0x9c, 0xef, 0xff, 0xec, 0x96, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x3, 0xbb, 0xbb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x7f,
+    0xff, 0xf4, 0x22, 0x22, 0x21, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x2f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xf2, 0x0, 0x0, 0x0,
+
+    /* U+0035 "5" */
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xf4, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xdc, 0x96, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x60, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x2, 0x33,
+    0x33, 0x33, 0x33, 0x45, 0x79, 0xdf, 0xff, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xbf, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xfa, 0x0, 0x4a, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf6, 0x0,
+    0xdf, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xf1, 0x6, 0xff, 0xff, 0xc5,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xff, 0xff,
+    0x90, 0xe, 0xff, 0xff, 0xff, 0xfc, 0x87, 0x65,
+    0x68, 0xcf, 0xff, 0xff, 0xfe, 0x10, 0x6, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe3, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0x7b, 0xde, 0xff, 0xfd, 0xb8, 0x40, 0x0,
+    0x0, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xac, 0xef,
+    0xfe, 0xdb, 0x84, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x81, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xb7, 0x53, 0x33, 0x57,
+    0xbf, 0xf4, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0xf8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x17, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0x50, 0x0, 0x5, 0xad, 0xef, 0xfe,
+    0xb8, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf3,
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0x22, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0xaf, 0xff, 0xf4, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0xb, 0xff, 0xff,
+    0xef, 0xff, 0xf9, 0x41, 0x0, 0x3, 0x8e, 0xff,
+    0xff, 0xf8, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xf2,
+    0x9, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0x90, 0x8f, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0x6, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xf2, 0x3f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x40, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xf4, 0xb, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0x30, 0x5f, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1, 0x0,
+    0xef, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xfd, 0x0, 0x7, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0x70, 0x0, 0xd, 0xff, 0xff, 0xc2, 0x0,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xfa, 0x41, 0x0, 0x3,
+    0x8e, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x49, 0xce, 0xff, 0xfd, 0xa6, 0x10,
+    0x0, 0x0, 0x0,
+
+    /* U+0037 "7" */
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x9f, 0xff, 0xf4, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xdf, 0xff,
+    0xf4, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xc0, 0x9f, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0x50, 0x9f, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0,
+    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xf7, 0x0, 0x9f, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xf1, 0x0, 0x25, 0x55, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x0, 0x0, 0x1, 0x69, 0xce, 0xff, 0xfe,
+    0xc9, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xf8, 0x41, 0x0, 0x1, 0x49, 0xff,
+    0xff, 0xff, 0x50, 0x0, 0xf, 0xff, 0xff, 0xb1,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xfe,
+    0x0, 0x5, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xf4, 0x0, 0x9f,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0x70, 0xa, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xf9, 0x0, 0xaf, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x80, 0x7,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xf6, 0x0, 0x3f, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0x10, 0x0, 0xbf, 0xff, 0xfc, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x2c, 0xff, 0xff, 0x90, 0x0,
+    0x1, 0xef, 0xff, 0xff, 0x95, 0x20, 0x0, 0x25,
+    0xaf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x2, 0xdf,
+    0xff, 0xff, 0xff, 0xdb, 0xbc, 0xdf, 0xff, 0xff,
+    0xff, 0xc1, 0x0, 0x1, 0xef, 0xff, 0xff, 0x93,
+    0x0, 0x0, 0x0, 0x4, 0xaf, 0xff, 0xff, 0xd1,
+    0x0, 0xbf, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3e, 0xff, 0xff, 0x90, 0x3f, 0xff,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0x29, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xf7, 0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xad, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xfc, 0xdf, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xcc, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfa, 0x8f,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0x73, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xf1, 0xb, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfa, 0x0,
+    0x2e, 0xff, 0xff, 0xfd, 0x73, 0x0, 0x0, 0x14,
+    0x8e, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x20, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x5, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x27, 0xac, 0xef, 0xff, 0xec, 0xa6, 0x20,
+    0x0, 0x0, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xff, 0xdb,
+    0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xff, 0xb5, 0x10, 0x0, 0x15, 0xbf, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0x70,
+    0x0, 0xe, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0xff, 0x20, 0x4, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xf9, 0x0, 0x8f, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xe0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x50, 0xaf,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xf9, 0x9, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xc0, 0x6f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x1,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xff, 0xff, 0xf1, 0xa, 0xff, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff,
+    0xff, 0xff, 0x20, 0x2f, 0xff, 0xff, 0xfb, 0x52,
+    0x0, 0x1, 0x5b, 0xff, 0xff, 0xef, 0xff, 0xf3,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb8, 0xff, 0xff, 0x40, 0x0, 0x4e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
+    0x8f, 0xff, 0xf4, 0x0, 0x0, 0x19, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x50, 0x9, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xec,
+    0x84, 0x0, 0x0, 0xaf, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x4, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xcf, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0xbf, 0xfa, 0x74, 0x33, 0x45, 0x9d, 0xff,
+    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x69, 0xce, 0xff, 0xfe, 0xb9, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0
+};
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 207, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 647, .box_w = 38, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 646, .adv_w = 512, .box_w = 28, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1122, .adv_w = 284, .box_w = 13, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1343, .adv_w = 441, .box_w = 26, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1785, .adv_w = 439, .box_w = 26, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2227, .adv_w = 514, .box_w = 31, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2754, .adv_w = 441, .box_w = 26, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3196, .adv_w = 474, .box_w = 27, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3655, .adv_w = 459, .box_w = 26, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4097, .adv_w = 495, .box_w = 27, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4556, .adv_w = 474, .box_w = 27, .box_h = 34, .ofs_x = 1, .ofs_y = 0}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint8_t glyph_id_ofs_list_0[] = {
+    1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 26, .glyph_id_start = 0,
+        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_0, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 6, 7, 8, 9, 2
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 2, 8, 9, 10
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    -93, 0, -15, 8, 8, 25, 15, -13, 15, 0, 0, 0, -2, -2, -8, 0,
+    0, -5, 0, 0, 8, -2, 0, 0, 0, -15, 0, -2, 0, 0, -8, 0,
+    0, -4, -4, 0, -8, -9, 0, 0, -23, 0, -19, -2, -9, 0, -2, -36,
+    8, -5, -8, 0, 0, -4, -4, 0, -4, -10, 0, 0, -15, 0, 0, 0,
+    0, 0, 0, -5, 0, 0, 2, -15, 8, 0, -6, -50, -14, 0, -14, 0,
+    -8, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 9,
+    .right_class_cnt     = 10,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 1,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t lv_font_montserrat_48 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 52,          /*The maximum line height required by the font*/
+    .base_line = 9,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -4,
+    .underline_thickness = 2,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
+
+#endif /*#if !LV_FONT_MONTSERRAT_48*/
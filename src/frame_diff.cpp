@@ -0,0 +1,128 @@
+#include "frame_diff.h"
+
+#include <new>
+#include <string.h>
+
+// Construtor
+FrameDiff::FrameDiff(int32_t width, int32_t height, SendCb send, uint32_t window_cost)
+    : width(width), height(height), send(send), window_cost(window_cost), shadow(nullptr), seeded(nullptr),
+      stats() {
+}
+
+// Destrutor - liberar o shadow framebuffer
+FrameDiff::~FrameDiff() {
+    delete[] shadow;
+    delete[] seeded;
+}
+
+bool FrameDiff::begin() {
+    if (shadow == nullptr) {
+        shadow = new (std::nothrow) uint16_t[width * height];
+        seeded = new (std::nothrow) bool[height];
+        if (shadow == nullptr || seeded == nullptr) {
+            delete[] shadow;
+            delete[] seeded;
+            shadow = nullptr;
+            seeded = nullptr;
+        }
+    }
+    invalidate();
+    return shadow != nullptr;
+}
+
+void FrameDiff::invalidate() {
+    if (seeded != nullptr) {
+        memset(seeded, 0, height * sizeof(bool));
+    }
+}
+
+void FrameDiff::flush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    uint16_t* px = reinterpret_cast<uint16_t*>(px_map);
+    const int32_t w = lv_area_get_width(area);
+    const int32_t h = lv_area_get_height(area);
+    stats.flushed_bytes += (uint64_t)w * h * 2;
+
+    Window windows[MAX_WINDOWS];
+    int count = 0;
+
+    if (shadow == nullptr) {
+        windows[count++] = {area->x1, area->y1, area->x2, area->y2};
+    } else {
+        const bool full_width = area->x1 == 0 && area->x2 == width - 1;
+        for (int32_t y = area->y1; y <= area->y2; y++) {
+            int32_t x1, x2;
+            if (!seeded[y]) {
+                // O shadow desta linha ainda não tem o que está no painel: envia a linha da área e guarda
+                // a cópia. A linha passa a ser comparada depois de ser copiada inteira.
+                memcpy(&shadow[y * width + area->x1], &px[(y - area->y1) * w], w * 2);
+                seeded[y] = full_width;
+                x1 = area->x1;
+                x2 = area->x2;
+            } else if (!diffRow(&px[(y - area->y1) * w], area->x1, y, w, &x1, &x2)) {
+                continue;
+            }
+
+            // Unir à janela anterior se reenviar as linhas iguais entre elas custa menos que abrir
+            // outra janela. Sem janelas livres, une sempre.
+            if (count > 0) {
+                Window& last = windows[count - 1];
+                const int32_t mx1 = LV_MIN(last.x1, x1);
+                const int32_t mx2 = LV_MAX(last.x2, x2);
+                const uint32_t merged = (mx2 - mx1 + 1) * (y - last.y1 + 1) * 2;
+                const uint32_t separate = (last.x2 - last.x1 + 1) * (last.y2 - last.y1 + 1) * 2 + window_cost +
+                                          (x2 - x1 + 1) * 2;
+                if (merged <= separate || count == MAX_WINDOWS) {
+                    last = {mx1, last.y1, mx2, y};
+                    continue;
+                }
+            }
+            windows[count++] = {x1, y, x2, y};
+        }
+    }
+
+    if (lv_display_flush_is_last(disp)) {
+        stats.frames++;
+    }
+
+    // As janelas são enviadas depois da comparação, porque o envio pode alterar os pixels
+    for (int i = 0; i < count; i++) {
+        sendWindow(i == count - 1 ? disp : nullptr, windows[i], area, px);
+    }
+    if (count == 0) {
+        lv_display_flush_ready(disp);
+    }
+}
+
+// Compara uma linha com o shadow, pelos dois lados, e copia a parte alterada
+bool FrameDiff::diffRow(const uint16_t* row, int32_t x, int32_t y, int32_t w, int32_t* x1, int32_t* x2) {
+    uint16_t* shadow_row = &shadow[y * width + x];
+
+    int32_t first = 0;
+    while (first < w && row[first] == shadow_row[first]) {
+        first++;
+    }
+    if (first == w) {
+        return false;
+    }
+
+    int32_t last = w - 1;
+    while (row[last] == shadow_row[last]) {
+        last--;
+    }
+
+    memcpy(&shadow_row[first], &row[first], (last - first + 1) * 2);
+    *x1 = x + first;
+    *x2 = x + last;
+    return true;
+}
+
+void FrameDiff::sendWindow(lv_display_t* disp, const Window& win, const lv_area_t* area, uint16_t* px) {
+    const int32_t stride = lv_area_get_width(area);
+    const int32_t w = win.x2 - win.x1 + 1;
+    const int32_t h = win.y2 - win.y1 + 1;
+    send(disp, win.x1, win.y1, w, h, &px[(win.y1 - area->y1) * stride + (win.x1 - area->x1)], stride);
+
+    stats.windows++;
+    stats.sent_bytes += (uint64_t)w * h * 2;
+    stats.setup_bytes += window_cost;
+}
@@ -0,0 +1,67 @@
+#ifndef FRAME_DIFF_H
+#define FRAME_DIFF_H
+
+#include <stdint.h>
+#include <lvgl.h>
+
+// Estatísticas dos envios ao painel, em bytes no barramento
+struct FrameDiffStats {
+    uint32_t frames;          // Quadros enviados
+    uint32_t windows;         // Janelas (setAddrWindow) enviadas
+    uint64_t flushed_bytes;   // Bytes que o LVGL entregou para enviar
+    uint64_t sent_bytes;      // Bytes de pixels realmente enviados
+    uint64_t setup_bytes;     // Custo estimado da configuração das janelas
+};
+
+// Estágio entre o flush do LVGL e o driver do painel que envia apenas os pixels que mudaram.
+// Guarda uma cópia do último quadro (shadow framebuffer), compara cada área linha a linha
+// e envia somente as janelas com diferenças. Feito para RGB565 e LV_DISPLAY_RENDER_MODE_PARTIAL.
+class FrameDiff {
+public:
+    // Envia uma janela ao painel: a área e os pixels, com o passo entre as linhas em pixels. disp só é
+    // passado com a última janela do flush, que chama lv_display_flush_ready() ao terminar o envio. Os
+    // pixels podem ser alterados (por exemplo, juntando as linhas da janela e trocando a ordem dos bytes).
+    typedef void (*SendCb)(lv_display_t* disp, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* px,
+                           int32_t stride);
+
+    // Máximo de janelas em que uma área é dividida
+    static const int MAX_WINDOWS = 4;
+
+    // window_cost: custo de abrir uma janela em bytes equivalentes (comandos CASET/RASET/RAMWR
+    // e o tempo da transação). Duas faixas alteradas são unidas numa só janela quando enviar
+    // as linhas iguais entre elas custa menos que abrir outra janela.
+    FrameDiff(int32_t width, int32_t height, SendCb send, uint32_t window_cost = 64);
+    ~FrameDiff();
+
+    // Aloca o shadow framebuffer. Sem memória, todas as áreas são enviadas inteiras.
+    bool begin();
+
+    // Chamada no flush_cb do LVGL com a área e os pixels renderizados. O flush termina pela última
+    // janela enviada, ou aqui se nada mudou.
+    void flush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map);
+
+    // Esquece o último quadro, por exemplo depois de reiniciar o painel
+    void invalidate();
+
+    const FrameDiffStats& getStats() const { return stats; }
+    void resetStats() { stats = FrameDiffStats(); }
+
+private:
+    struct Window {
+        int32_t x1, y1, x2, y2;
+    };
+
+    int32_t width;
+    int32_t height;
+    SendCb send;
+    uint32_t window_cost;
+    uint16_t* shadow;
+    bool* seeded;  // Linhas do shadow iguais às do painel, copiadas inteiras desde begin() ou invalidate()
+    FrameDiffStats stats;
+
+    // Compara uma linha com o shadow e o atualiza. Retorna false se não mudou.
+    bool diffRow(const uint16_t* row, int32_t x, int32_t y, int32_t w, int32_t* x1, int32_t* x2);
+    void sendWindow(lv_display_t* disp, const Window& win, const lv_area_t* area, uint16_t* px);
+};
+
+#endif // FRAME_DIFF_H
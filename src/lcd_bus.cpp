@@ -0,0 +1,55 @@
+#include "lcd_bus.h"
+
+#include <string.h>
+#include <src/drivers/display/lcd/lv_lcd_generic_mipi.h>
+
+LcdBus* LcdBus::active = nullptr;
+
+void LcdBus::sendCmdCb(lv_display_t* disp, const uint8_t* cmd, size_t cmd_size, const uint8_t* param,
+                       size_t param_size) {
+    LV_UNUSED(disp);
+    active->sendCmd(cmd, cmd_size, param, param_size);
+}
+
+// Usado quando o driver não tem o callback de lote: só o RAMWR e os pixels numa transação
+void LcdBus::sendColorCb(lv_display_t* disp, const uint8_t* cmd, size_t cmd_size, uint8_t* px, size_t px_size) {
+    LV_UNUSED(cmd);
+    LV_UNUSED(cmd_size);
+    static const uint8_t cmd_list[] = {LV_LCD_CMD_WRITE_MEMORY_START, 0};
+    sendBatchCb(disp, cmd_list, sizeof(cmd_list), px, px_size);
+}
+
+void LcdBus::sendBatchCb(lv_display_t* disp, const uint8_t* cmd_list, size_t cmd_list_size, uint8_t* px,
+                         size_t px_size) {
+    // O painel recebe o RGB565 com o byte mais significativo primeiro
+    lv_draw_sw_rgb565_swap(px, px_size / 2);
+    active->sendBatch(disp, cmd_list, cmd_list_size, px, px_size);
+}
+
+void LcdBus::sendWindowCb(lv_display_t* disp, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* px,
+                          int32_t stride) {
+    active->sendWindow(disp, x, y, w, h, px, stride);
+}
+
+void LcdBus::sendWindow(lv_display_t* disp, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* px,
+                        int32_t stride) {
+    // Cada linha vai para o fim da anterior; o destino nunca passa da origem, nem das janelas seguintes
+    if (stride != w) {
+        for (int32_t row = 1; row < h; row++) {
+            memmove(&px[row * w], &px[row * stride], w * 2);
+        }
+    }
+    lv_draw_sw_rgb565_swap(px, w * h);
+
+    const int32_t x2 = x + w - 1;
+    const int32_t y2 = y + h - 1;
+    uint8_t* cmds = window_cmds[window_cmds_next];
+    window_cmds_next ^= 1;
+    const uint8_t list[] = {
+        LV_LCD_CMD_SET_COLUMN_ADDRESS, 4, (uint8_t)(x >> 8), (uint8_t)x, (uint8_t)(x2 >> 8), (uint8_t)x2,
+        LV_LCD_CMD_SET_PAGE_ADDRESS,   4, (uint8_t)(y >> 8), (uint8_t)y, (uint8_t)(y2 >> 8), (uint8_t)y2,
+        LV_LCD_CMD_WRITE_MEMORY_START, 0,
+    };
+    memcpy(cmds, list, sizeof(list));
+    sendBatch(disp, cmds, sizeof(list), reinterpret_cast<uint8_t*>(px), (size_t)w * h * 2);
+}
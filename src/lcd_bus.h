@@ -0,0 +1,68 @@
+#ifndef LCD_BUS_H
+#define LCD_BUS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <lvgl.h>
+
+// Estatísticas das transferências ao painel
+struct LcdBusStats {
+    uint32_t transactions;  // Transações (CS ativo do início ao fim)
+    uint32_t commands;      // Comandos enviados, incluindo o RAMWR de cada flush
+    uint64_t cmd_bytes;     // Bytes de comandos e parâmetros
+    uint64_t px_bytes;      // Bytes de pixels
+    uint64_t busy_us;       // Tempo com o barramento ocupado
+};
+
+// Barramento do painel usado pelo driver MIPI genérico do LVGL (lv_gc9a01_create()).
+// Os comandos de inicialização são enviados de forma bloqueante; a janela e os pixels de cada
+// flush vão numa única transação assíncrona, que chama lv_display_flush_ready() ao terminar.
+class LcdBus {
+public:
+    virtual ~LcdBus() {}
+
+    // Envia um comando e os seus parâmetros, esperando o fim da transferência
+    virtual void sendCmd(const uint8_t* cmd, size_t cmd_size, const uint8_t* param, size_t param_size) = 0;
+
+    // Envia a lista de comandos de um flush (no formato de lv_lcd_generic_mipi_send_cmd_list(), o último
+    // é o RAMWR) seguida dos pixels, já na ordem de bytes do painel. A lista e os pixels são válidos até
+    // o fim da transferência. disp recebe lv_display_flush_ready() no fim, se não for nulo.
+    virtual void sendBatch(lv_display_t* disp, const uint8_t* cmd_list, size_t cmd_list_size, const uint8_t* px,
+                           size_t px_size) = 0;
+
+    // Chamada no loop para concluir as transferências que terminaram
+    virtual void poll() {}
+
+    // Envia uma janela de pixels RGB565 do LVGL com CASET, RASET e RAMWR numa transação, sem o driver
+    // (o GC9A01 não tem deslocamento da janela). As linhas, separadas por stride pixels, são juntadas e
+    // trocadas para a ordem de bytes do painel no próprio buffer. Com disp, é a última janela do flush e
+    // lv_display_flush_ready() é chamada ao terminar.
+    void sendWindow(lv_display_t* disp, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* px, int32_t stride);
+
+    const LcdBusStats& getStats() const { return stats; }
+    void resetStats() { stats = LcdBusStats(); }
+
+    // Callbacks para o driver do LVGL, que não recebem o barramento: usam o registrado aqui
+    static void attach(LcdBus* bus) { active = bus; }
+    static void sendCmdCb(lv_display_t* disp, const uint8_t* cmd, size_t cmd_size, const uint8_t* param,
+                          size_t param_size);
+    static void sendColorCb(lv_display_t* disp, const uint8_t* cmd, size_t cmd_size, uint8_t* px, size_t px_size);
+    static void sendBatchCb(lv_display_t* disp, const uint8_t* cmd_list, size_t cmd_list_size, uint8_t* px,
+                            size_t px_size);
+    // Para o FrameDiff
+    static void sendWindowCb(lv_display_t* disp, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* px,
+                             int32_t stride);
+
+protected:
+    LcdBusStats stats;
+
+private:
+    // CASET e RASET com 4 parâmetros e RAMWR. São duas listas porque a anterior pode estar sendo
+    // enviada enquanto a próxima é montada.
+    uint8_t window_cmds[2][14] = {};
+    int window_cmds_next = 0;
+
+    static LcdBus* active;
+};
+
+#endif // LCD_BUS_H
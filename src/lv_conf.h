@@ -3,6 +3,9 @@
 
 #define LV_COLOR_DEPTH      16
 #define LV_USE_LOG          1
+/*The logs are stored in binary form and sent when the loop is idle, format them with scripts/decode_log.py*/
+#define LV_LOG_DEFERRED     1
+#define LV_LOG_DEFERRED_BUF_SIZE 2048
 #define LV_USE_LABEL        1
 #define LV_USE_BTN          1
 #define LV_USE_DEMO_WIDGETS 1
@@ -11,9 +14,18 @@
 #define LV_TICK_CUSTOM_INCLUDE  Arduino.h
 #define LV_TICK_CUSTOM_SYS_TIME_EXPR millis()
 
-#define LV_FONT_MONTSERRAT_14 1
+/*Montserrat 14 and 48 are subset to the glyphs of the UI in src/fonts by scripts/subset_fonts.py.
+ *Set them to 1 to use the complete built-in fonts instead.*/
+#define LV_FONT_MONTSERRAT_14 0
 #define LV_FONT_MONTSERRAT_18 0
 #define LV_FONT_MONTSERRAT_22 0
-#define LV_FONT_MONTSERRAT_48 1
+#define LV_FONT_MONTSERRAT_48 0
+#define LV_FONT_CUSTOM_DECLARE LV_FONT_DECLARE(lv_font_montserrat_14) LV_FONT_DECLARE(lv_font_montserrat_48)
+
+#define LV_TEXT_LAYOUT_CACHE_CNT 16
+#define LV_OBJ_POOL_DEPTH        8
+
+/*GC9A01 through the generic MIPI driver, used with LCD_GENERIC_MIPI in main.cpp*/
+#define LV_USE_GC9A01            1
 
 #endif /*LV_CONF_H*/
@@ -1,8 +1,8 @@
 #include <Arduino.h>
 #include <lvgl.h>
-#include <Adafruit_GC9A01A.h>
 #include <ui/ui.h>
 #include "button_manager.h"
+#include "frame_diff.h"
 
 #define POT_PIN   A0
 
@@ -26,12 +26,38 @@
 
 #define DEBUG    0
 
+// 1: Usa o driver GC9A01 do LVGL (MIPI genérico) com SPI por DMA em vez da biblioteca Adafruit.
+// Cada flush vai numa transação assíncrona e o LVGL renderiza na outra metade do buffer enquanto isso.
+#define LCD_GENERIC_MIPI 0
+
+// 1: Envia ao painel apenas os pixels que mudaram em relação ao quadro anterior. Opcional: o shadow
+// framebuffer ocupa 115 KB do heap.
+#define FRAME_DIFF 0
+
+#if LCD_GENERIC_MIPI != 0
+#include <src/drivers/display/gc9a01/lv_gc9a01.h>
+#include "spi_lcd_bus.h"
+
+// Barramento do display
+SpiLcdBus lcd_bus(SCK, MOSI, TFT_CS, TFT_DC, TFT_RST);
+#else
+#include <Adafruit_GC9A01A.h>
+
 // Instância do display
 Adafruit_GC9A01A tft(TFT_CS, TFT_DC, TFT_RST);
+#endif
 
-static lv_color_t draw_buf[TFT_HOR_RES * TFT_VER_RES / 4];
+// Alinhado para o DMA ler os pixels direto do buffer
+alignas(4) static lv_color_t draw_buf[TFT_HOR_RES * TFT_VER_RES / 4];
 
-#if LV_USE_LOG != 0
+#if LV_USE_LOG != 0 && LV_LOG_DEFERRED
+// Envia os registros de log binários sem esperar a UART: só o que cabe no buffer de transmissão
+uint32_t log_serial_write(const void* data, uint32_t size)
+{
+    const uint32_t room = std::min<uint32_t>(size, Serial.availableForWrite());
+    return Serial.write(static_cast<const uint8_t*>(data), room);
+}
+#elif LV_USE_LOG != 0
 void my_print(lv_log_level_t level, const char* buf)
 {
     LV_UNUSED(level);
@@ -40,18 +66,52 @@ void my_print(lv_log_level_t level, const char* buf)
 }
 #endif
 
-void gfx_disp_flush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map)
+#if LCD_GENERIC_MIPI == 0
+// Envia uma janela de pixels ao painel, linha por linha se ela for parte de uma área maior.
+// Com disp, é a última janela do flush.
+void tft_send_window(lv_display_t* disp, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* px, int32_t stride)
 {
-    uint32_t w = (area->x2 - area->x1 + 1);
-    uint32_t h = (area->y2 - area->y1 + 1);
+    tft.setAddrWindow(x, y, w, h);
+    if (stride == w) {
+        tft.writePixels(px, w * h);
+    } else {
+        for (int32_t row = 0; row < h; row++) {
+            tft.writePixels(px + row * stride, w);
+        }
+    }
+
+    if (disp != nullptr) {
+        lv_display_flush_ready(disp);
+    }
+}
+#endif
+
+#if FRAME_DIFF != 0
+// As janelas alteradas vão pela biblioteca Adafruit ou pelo mesmo barramento do driver do LVGL
+#if LCD_GENERIC_MIPI != 0
+FrameDiff frame_diff(TFT_HOR_RES, TFT_VER_RES, LcdBus::sendWindowCb);
+#else
+FrameDiff frame_diff(TFT_HOR_RES, TFT_VER_RES, tft_send_window);
+#endif
+#endif
 
+#if LCD_GENERIC_MIPI == 0 || FRAME_DIFF != 0
+void gfx_disp_flush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map)
+{
+#if LCD_GENERIC_MIPI == 0
     tft.startWrite();
-    tft.setAddrWindow(area->x1, area->y1, w, h);
-    tft.writePixels((uint16_t*)px_map, w * h);
+#endif
+#if FRAME_DIFF != 0
+    frame_diff.flush(disp, area, px_map);
+#else
+    int32_t w = lv_area_get_width(area);
+    tft_send_window(disp, area->x1, area->y1, w, lv_area_get_height(area), (uint16_t*)px_map, w);
+#endif
+#if LCD_GENERIC_MIPI == 0
     tft.endWrite();
-
-    lv_display_flush_ready(disp);
+#endif
 }
+#endif
 
 /*use Arduinos millis() as tick source*/
 static uint32_t my_tick(void)
@@ -59,19 +119,42 @@ static uint32_t my_tick(void)
     return millis();
 }
 
+// Para medir o tempo de decodificação das imagens, que o cache usa como custo
+static uint32_t my_tick_us(void)
+{
+    return micros();
+}
+
 uint8_t button_pins[] = {BT_UP, BT_DN, BT_LT, BT_RT, BT_OK};
 ButtonManager button_manager(button_pins, std::size(button_pins));
 
+// Valor do potenciômetro em %, entregue aos widgets uma vez por quadro
+lv_subject_t pot_subject;
+
 std::array<lv_obj_t*, 3> screen2_switches = {nullptr, nullptr, nullptr};
 int current_switch_index = 0;
 
-// Esta função deve ser chamada depois que a tela for inicializada
+void bind_screen1_pot();
+#if LV_USE_LOG != 0
+void stats_timer_cb(lv_timer_t* timer);
+#endif
+
+// Estado dos switches, preservado quando a Screen2 é destruída
+std::array<bool, 3> screen2_switch_states = {false, false, false};
+
+// Chamada sempre que a Screen2 for construída
 void initialize_screen2_switches()
 {
     // Associe os ponteiros já existentes ao array
     screen2_switches[0] = ui_Switch1;
     screen2_switches[1] = ui_Switch2;
     screen2_switches[2] = ui_Switch3;
+
+    // Restaure o foco e o estado anteriores à destruição da tela
+    for (size_t s = 0; s < screen2_switches.size(); s++) {
+        lv_obj_set_state(screen2_switches[s], LV_STATE_FOCUSED, (int)s == current_switch_index);
+        lv_obj_set_state(screen2_switches[s], LV_STATE_CHECKED, screen2_switch_states[s]);
+    }
 }
 
 void setup()
@@ -79,8 +162,14 @@ void setup()
     Serial.begin(115200);
     Serial.println("Setup start");
 
+#if LCD_GENERIC_MIPI != 0
+    if (!lcd_bus.begin()) {
+        Serial.println("SpiLcdBus: falha ao iniciar o SPI");
+    }
+#else
     tft.begin();
     tft.setRotation(TFT_ROTATION);
+#endif
 
     pinMode(BT_UP, INPUT_PULLUP);
     pinMode(BT_DN, INPUT_PULLUP);
@@ -90,7 +179,7 @@ void setup()
 
     button_manager.begin(true);
 
-#if DEBUG != 0
+#if DEBUG != 0 && LCD_GENERIC_MIPI == 0
     tft.setRotation(0);
     tft.fillScreen(GC9A01A_BLACK);
     tft.setTextColor(GC9A01A_WHITE);
@@ -107,16 +196,40 @@ void setup()
 
     lv_init();
     lv_tick_set_cb(my_tick);
+    lv_tick_set_us_cb(my_tick_us);
 
     /* register print function for debugging */
-#if LV_USE_LOG != 0
+#if LV_USE_LOG != 0 && !LV_LOG_DEFERRED
     lv_log_register_print_cb(my_print);
 #endif
 
     /* setup lvgl to work with display driver */
+#if LCD_GENERIC_MIPI != 0
+    // Rotação de 180 graus como TFT_ROTATION 2 na Adafruit: MADCTL com MY e BGR
+    LcdBus::attach(&lcd_bus);
+    lv_display_t* disp = lv_gc9a01_create(TFT_HOR_RES, TFT_VER_RES, LV_LCD_FLAG_BGR | LV_LCD_FLAG_MIRROR_Y,
+                                          LcdBus::sendCmdCb, LcdBus::sendColorCb);
+    lv_lcd_generic_mipi_set_send_batch_cb(disp, LcdBus::sendBatchCb);
+    // Dois buffers com metade do tamanho: um é renderizado enquanto o outro é enviado
+    lv_display_set_buffers(disp, draw_buf, draw_buf + std::size(draw_buf) / 2, sizeof(draw_buf) / 2,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+#if FRAME_DIFF != 0
+    // O driver inicializa e gira o painel, as janelas alteradas são enviadas pelo FrameDiff
+    lv_display_set_flush_cb(disp, gfx_disp_flush);
+#endif
+#else
     lv_display_t* disp = lv_display_create(TFT_HOR_RES, TFT_VER_RES);
     lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
     lv_display_set_flush_cb(disp, gfx_disp_flush);
+#endif
+    // Une as áreas invalidadas considerando o custo fixo de cada envio pelo SPI, não só os pixels
+    lv_display_set_refr_cost(disp, LV_DISPLAY_REFR_FLUSH_COST_SPI, LV_DISPLAY_REFR_PX_COST_SPI);
+
+#if FRAME_DIFF != 0
+    if (!frame_diff.begin()) {
+        Serial.println("FrameDiff: sem memória para o shadow framebuffer, enviando as áreas inteiras");
+    }
+#endif
 
 #if DEBUG != 0
     lv_obj_t* label = lv_label_create(lv_screen_active());
@@ -127,8 +240,26 @@ void setup()
 
     pinMode(POT_PIN, INPUT);
 
+    lv_subject_init_int(&pot_subject, 0);
+    lv_subject_set_coalesce(&pot_subject, true);
+
+    // As telas são construídas na primeira navegação (UI_LAZY_SCREENS), então
+    // as ligações com os widgets são refeitas a cada construção
+    ui_Screen1_dsc.created_cb = bind_screen1_pot;
+    ui_Screen2_dsc.created_cb = initialize_screen2_switches;
+
+    const uint32_t ui_init_start = micros();
     ui_init();
-    initialize_screen2_switches();
+    const uint32_t ui_init_time = micros() - ui_init_start;
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    Serial.printf("ui_init (%s): %lu us, peak heap %lu bytes\n", UI_LAZY_SCREENS ? "lazy" : "eager",
+                  (unsigned long)ui_init_time, (unsigned long)mon.max_used);
+
+#if LV_USE_LOG != 0
+    lv_timer_create(stats_timer_cb, 5000, NULL);
+#endif
 
     Serial.println("Setup done");
 }
@@ -193,25 +324,73 @@ void update_arc_color(const lv_color_t color)
     }
 }
 
-void update_arc(int percent_value)
+void arc_color_observer_cb(lv_observer_t* observer, lv_subject_t* subject)
 {
-    percent_value = std::max(0, std::min(100, percent_value));
+    LV_UNUSED(observer);
+
+    int percent_value = std::max(0, std::min(100, (int)lv_subject_get_int(subject)));
 
     uint16_t hue = 240 - (percent_value * 240 / 100);
     uint8_t saturation = 100;
     uint8_t value = 100;
-    lv_color_t color = lv_color_hsv_to_rgb(hue, saturation, value);
+    update_arc_color(lv_color_hsv_to_rgb(hue, saturation, value));
+}
+
+// Desenha o arco do medidor com o rasterizador analítico do LVGL, só ele: os outros arcos seguem com as máscaras
+void gauge_draw_task_cb(lv_event_t* e)
+{
+    lv_draw_arc_dsc_t* arc_dsc = lv_draw_task_get_arc_dsc(lv_event_get_draw_task(e));
+    if (arc_dsc != NULL) {
+        arc_dsc->analytic = 1;
+    }
+}
+
+// Liga o arco e o label da Screen1 ao potenciômetro
+void bind_screen1_pot()
+{
+    // A tela recém-construída volta com a cor padrão do arco
+    previous_color = lv_obj_get_style_arc_color(ui_Arc1, LV_PART_INDICATOR);
+
+    lv_obj_add_event_cb(ui_Arc1, gauge_draw_task_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+    lv_obj_add_flag(ui_Arc1, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
 
-    lv_arc_set_value(ui_Arc1, percent_value);
-    update_arc_color(color);
+    lv_arc_bind_value(ui_Arc1, &pot_subject);
+    lv_label_bind_text(ui_Label1, &pot_subject, "%d%%");
+    lv_subject_add_observer_obj(&pot_subject, arc_color_observer_cb, ui_Arc1, NULL);
 }
 
-void update_label(int percent_value)
+#if LV_USE_LOG != 0
+void stats_timer_cb(lv_timer_t* timer)
 {
-    char buffer[16];
-    sprintf(buffer, "%d%%", percent_value);
-    lv_label_set_text(ui_Label1, buffer);
+    LV_UNUSED(timer);
+    LV_LOG_USER("pot: %" LV_PRIu32 " notifications merged", lv_subject_get_merged_count(&pot_subject));
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    LV_LOG_USER("heap: %" LV_PRIu32 " bytes peak, %" LV_PRIu32 " objects recycled", (uint32_t)mon.max_used,
+                lv_obj_class_pool_get_reuse_count());
+#if LV_LOG_DEFERRED
+    LV_LOG_USER("log: %" LV_PRIu32 " records dropped", lv_log_deferred_get_dropped_count());
+#endif
+
+#if FRAME_DIFF != 0
+    const FrameDiffStats& st = frame_diff.getStats();
+    if (st.frames > 0) {
+        LV_LOG_USER("spi: %" LV_PRIu32 " of %" LV_PRIu32 " bytes/frame sent in %" LV_PRIu32 " windows",
+                    (uint32_t)((st.sent_bytes + st.setup_bytes) / st.frames), (uint32_t)(st.flushed_bytes / st.frames),
+                    st.windows);
+    }
+    frame_diff.resetStats();
+#endif
+
+#if LCD_GENERIC_MIPI != 0
+    const LcdBusStats& bus = lcd_bus.getStats();
+    LV_LOG_USER("spi: %" LV_PRIu32 " transactions, %" LV_PRIu32 " commands, %" LV_PRIu32 " px bytes, %" LV_PRIu32
+                " us busy", bus.transactions, bus.commands, (uint32_t)bus.px_bytes, (uint32_t)bus.busy_us);
+    lcd_bus.resetStats();
+#endif
 }
+#endif
 
 void update_fps()
 {
@@ -235,26 +414,29 @@ void loop()
 
     // Handle screen navigation with left and right buttons
     if (lt_event == BUTTON_CLICK) {
-        // Navigate to previous screen
+        // Navigate to previous screen, prebuilding the one after it
         if (lv_screen_active() == ui_Screen2) {
-            lv_screen_load(ui_Screen1);
+            _ui_screen_lazy_change(&ui_Screen1_dsc, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_Screen2_dsc);
         } else if (lv_screen_active() == ui_Screen3) {
-            lv_screen_load(ui_Screen2);
+            _ui_screen_lazy_change(&ui_Screen2_dsc, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_Screen1_dsc);
         }
     }
 
     if (rt_event == BUTTON_CLICK) {
-        // Navigate to next screen
+        // Navigate to next screen, prebuilding the one after it
         if (lv_screen_active() == ui_Screen1) {
-            lv_screen_load(ui_Screen2);
+            _ui_screen_lazy_change(&ui_Screen2_dsc, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_Screen3_dsc);
         } else if (lv_screen_active() == ui_Screen2) {
-            lv_screen_load(ui_Screen3);
+            _ui_screen_lazy_change(&ui_Screen3_dsc, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_Screen2_dsc);
         }
     }
 
+    // Com coalescência, várias leituras entre dois quadros geram uma única atualização
+    if (pot_percent_val != lv_subject_get_int(&pot_subject)) {
+        lv_subject_set_int(&pot_subject, pot_percent_val);
+    }
+
     if (lv_screen_active() == ui_Screen1) {
-        update_label(pot_percent_val);
-        update_arc(pot_percent_val);
         update_fps();
     }
 
@@ -291,6 +473,7 @@ void loop()
                 } else {
                     lv_obj_add_state(screen2_switches[current_switch_index], LV_STATE_CHECKED);
                 }
+                screen2_switch_states[current_switch_index] = !current_state;
             }
         }
     }
@@ -304,5 +487,11 @@ void loop()
     }
 
     lv_timer_handler();
+
+#if LV_USE_LOG != 0 && LV_LOG_DEFERRED
+    // Os logs são enviados depois do quadro, quando o loop estaria parado
+    lv_log_deferred_drain(log_serial_write);
+#endif
+
     delay(2);
 }
@@ -0,0 +1,144 @@
+#include "spi_lcd_bus.h"
+
+#include <driver/gpio.h>
+#include <esp_timer.h>
+#include <string.h>
+
+// Bits de spi_transaction_t::user
+#define TRANS_DATA 0x1  // DC em nível alto: parâmetros ou pixels
+#define TRANS_LAST 0x2  // Última transação do flush
+
+SpiLcdBus* SpiLcdBus::instance = nullptr;
+
+// Construtor
+SpiLcdBus::SpiLcdBus(int8_t sclk, int8_t mosi, int8_t cs, int8_t dc, int8_t rst, uint32_t clock_hz,
+                     size_t max_transfer)
+    : sclk(sclk), mosi(mosi), cs(cs), dc(dc), rst(rst), clock_hz(clock_hz), max_transfer(max_transfer), dev(nullptr),
+      queued(0), pending_disp(nullptr), start_us(0) {
+}
+
+bool SpiLcdBus::begin() {
+    instance = this;
+
+    pinMode(dc, OUTPUT);
+    if (rst >= 0) {
+        pinMode(rst, OUTPUT);
+        digitalWrite(rst, HIGH);
+        delay(10);
+        digitalWrite(rst, LOW);
+        delay(10);
+        digitalWrite(rst, HIGH);
+        delay(120);
+    }
+
+    spi_bus_config_t bus = {};
+    bus.mosi_io_num = mosi;
+    bus.miso_io_num = -1;
+    bus.sclk_io_num = sclk;
+    bus.quadwp_io_num = -1;
+    bus.quadhd_io_num = -1;
+    bus.max_transfer_sz = max_transfer;
+    if (spi_bus_initialize(SPI2_HOST, &bus, SPI_DMA_CH_AUTO) != ESP_OK) {
+        return false;
+    }
+
+    spi_device_interface_config_t cfg = {};
+    cfg.mode = 0;
+    cfg.clock_speed_hz = clock_hz;
+    cfg.spics_io_num = cs;
+    cfg.queue_size = MAX_TRANS;
+    cfg.pre_cb = preCb;
+    cfg.post_cb = postCb;
+    return spi_bus_add_device(SPI2_HOST, &cfg, &dev) == ESP_OK;
+}
+
+void SpiLcdBus::sendCmd(const uint8_t* cmd, size_t cmd_size, const uint8_t* param, size_t param_size) {
+    finish();
+    spi_device_acquire_bus(dev, portMAX_DELAY);
+
+    spi_transaction_t t;
+    setTransaction(&t, cmd, cmd_size, 0, param_size > 0);
+    spi_device_polling_transmit(dev, &t);
+    if (param_size > 0) {
+        setTransaction(&t, param, param_size, TRANS_DATA, false);
+        spi_device_polling_transmit(dev, &t);
+    }
+
+    spi_device_release_bus(dev);
+    stats.transactions++;
+    stats.commands++;
+    stats.cmd_bytes += cmd_size + param_size;
+}
+
+void SpiLcdBus::sendBatch(lv_display_t* disp, const uint8_t* cmd_list, size_t cmd_list_size, const uint8_t* px,
+                          size_t px_size) {
+    finish();
+    spi_device_acquire_bus(dev, portMAX_DELAY);
+    pending_disp = disp;
+
+    int n = 0;
+    for (size_t i = 0; i + 1 < cmd_list_size; i += 2 + cmd_list[i + 1]) {
+        setTransaction(&trans[n++], &cmd_list[i], 1, 0, true);
+        if (cmd_list[i + 1] > 0) {
+            setTransaction(&trans[n++], &cmd_list[i + 2], cmd_list[i + 1], TRANS_DATA, true);
+        }
+        stats.commands++;
+        stats.cmd_bytes += 1 + cmd_list[i + 1];
+    }
+    for (size_t sent = 0; sent < px_size; sent += max_transfer) {
+        const size_t size = LV_MIN(max_transfer, px_size - sent);
+        const bool last = sent + size == px_size;
+        LV_ASSERT(n < MAX_TRANS);
+        setTransaction(&trans[n++], px + sent, size, TRANS_DATA | (last ? TRANS_LAST : 0), !last);
+    }
+    stats.transactions++;
+    stats.px_bytes += px_size;
+
+    start_us = esp_timer_get_time();
+    for (queued = 0; queued < n; queued++) {
+        spi_device_queue_trans(dev, &trans[queued], portMAX_DELAY);
+    }
+}
+
+void SpiLcdBus::finish() {
+    if (queued == 0) {
+        return;
+    }
+
+    spi_transaction_t* t;
+    for (; queued > 0; queued--) {
+        spi_device_get_trans_result(dev, &t, portMAX_DELAY);
+    }
+    spi_device_release_bus(dev);
+}
+
+// Parâmetros curtos vão dentro da transação, sem DMA da memória de quem chamou
+void SpiLcdBus::setTransaction(spi_transaction_t* t, const uint8_t* data, size_t size, uint32_t user, bool keep_cs) {
+    memset(t, 0, sizeof(*t));
+    t->length = size * 8;
+    if (size <= sizeof(t->tx_data)) {
+        t->flags = SPI_TRANS_USE_TXDATA;
+        memcpy(t->tx_data, data, size);
+    } else {
+        t->tx_buffer = data;
+    }
+    if (keep_cs) {
+        t->flags |= SPI_TRANS_CS_KEEP_ACTIVE;
+    }
+    t->user = (void*)(uintptr_t)user;
+}
+
+// Chamadas pelo driver SPI na interrupção, antes e depois de cada transação
+void IRAM_ATTR SpiLcdBus::preCb(spi_transaction_t* t) {
+    gpio_set_level((gpio_num_t)instance->dc, ((uintptr_t)t->user & TRANS_DATA) != 0);
+}
+
+void IRAM_ATTR SpiLcdBus::postCb(spi_transaction_t* t) {
+    if ((uintptr_t)t->user & TRANS_LAST) {
+        instance->stats.busy_us += esp_timer_get_time() - instance->start_us;
+        // As janelas do FrameDiff antes da última não terminam o flush
+        if (instance->pending_disp != nullptr) {
+            lv_display_flush_ready(instance->pending_disp);
+        }
+    }
+}
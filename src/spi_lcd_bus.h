@@ -0,0 +1,53 @@
+#ifndef SPI_LCD_BUS_H
+#define SPI_LCD_BUS_H
+
+#include <Arduino.h>
+#include <driver/spi_master.h>
+#include "lcd_bus.h"
+
+// Barramento SPI do ESP32 com DMA. Cada flush é uma fila de transações com o CS mantido ativo,
+// o pino DC é trocado entre elas pelo callback do driver e o fim é avisado ao LVGL pela interrupção,
+// então o LVGL renderiza no outro buffer enquanto os pixels são enviados.
+class SpiLcdBus : public LcdBus {
+public:
+    // max_transfer: maior transferência de DMA, os pixels de um flush são divididos em até 4 partes
+    SpiLcdBus(int8_t sclk, int8_t mosi, int8_t cs, int8_t dc, int8_t rst, uint32_t clock_hz = 40000000,
+              size_t max_transfer = 32768);
+
+    // Inicializa o SPI e reinicia o painel pelo pino de reset
+    bool begin();
+
+    void sendCmd(const uint8_t* cmd, size_t cmd_size, const uint8_t* param, size_t param_size) override;
+    void sendBatch(lv_display_t* disp, const uint8_t* cmd_list, size_t cmd_list_size, const uint8_t* px,
+                   size_t px_size) override;
+
+private:
+    // CASET, RASET e RAMWR com os parâmetros, mais as partes dos pixels
+    static const int MAX_TRANS = 10;
+
+    int8_t sclk;
+    int8_t mosi;
+    int8_t cs;
+    int8_t dc;
+    int8_t rst;
+    uint32_t clock_hz;
+    size_t max_transfer;
+    spi_device_handle_t dev;
+    spi_transaction_t trans[MAX_TRANS];
+    int queued;
+    lv_display_t* pending_disp;
+    int64_t start_us;
+
+    static SpiLcdBus* instance;
+
+    // Espera as transações do último flush e libera o barramento
+    void finish();
+    void setTransaction(spi_transaction_t* t, const uint8_t* data, size_t size, uint32_t user, bool keep_cs);
+
+    // IRAM_ATTR só na definição: no IDF 5 ele leva __COUNTER__ no nome da seção, e a declaração
+    // com outra seção não compila
+    static void preCb(spi_transaction_t* t);
+    static void postCb(spi_transaction_t* t);
+};
+
+#endif // SPI_LCD_BUS_H
@@ -11,6 +11,11 @@
 // EVENTS
 lv_obj_t * ui____initial_actions0;
 
+// SCREEN LIFECYCLE
+ui_screen_t ui_Screen1_dsc = {&ui_Screen1, ui_Screen1_screen_init, ui_Screen1_screen_destroy, NULL};
+ui_screen_t ui_Screen2_dsc = {&ui_Screen2, ui_Screen2_screen_init, ui_Screen2_screen_destroy, NULL};
+ui_screen_t ui_Screen3_dsc = {&ui_Screen3, ui_Screen3_screen_init, ui_Screen3_screen_destroy, NULL};
+
 // IMAGES AND IMAGE SETS
 
 ///////////////////// TEST LVGL SETTINGS ////////////////////
@@ -30,11 +35,13 @@ void ui_init(void)
     lv_theme_t * theme = lv_theme_default_init(dispp, lv_palette_main(LV_PALETTE_BLUE), lv_palette_main(LV_PALETTE_RED),
                                                true, LV_FONT_DEFAULT);
     lv_disp_set_theme(dispp, theme);
-    ui_Screen1_screen_init();
-    ui_Screen2_screen_init();
-    ui_Screen3_screen_init();
+#if !UI_LAZY_SCREENS
+    _ui_screen_build(&ui_Screen1_dsc);
+    _ui_screen_build(&ui_Screen2_dsc);
+    _ui_screen_build(&ui_Screen3_dsc);
+#endif
     ui____initial_actions0 = lv_obj_create(NULL);
-    lv_disp_load_scr(ui_Screen1);
+    _ui_screen_lazy_change(&ui_Screen1_dsc, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_Screen2_dsc);
 }
 
 void ui_destroy(void)
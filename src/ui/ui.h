@@ -25,6 +25,11 @@ extern "C" {
 // EVENTS
 extern lv_obj_t * ui____initial_actions0;
 
+// SCREEN LIFECYCLE
+extern struct _ui_screen_t ui_Screen1_dsc;
+extern struct _ui_screen_t ui_Screen2_dsc;
+extern struct _ui_screen_t ui_Screen3_dsc;
+
 // UI INIT
 void ui_init(void);
 void ui_destroy(void);
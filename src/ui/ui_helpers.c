@@ -122,6 +122,61 @@ void scr_unloaded_delete_cb(lv_event_t * e)
     (*var) = NULL;
 }
 
+static ui_screen_t * ui_screen_kept;
+static lv_timer_t * ui_screen_prebuild_timer;
+
+static void ui_screen_unloaded_cb(lv_event_t * e)
+{
+    ui_screen_t * screen = lv_event_get_user_data(e);
+    if(!UI_LAZY_SCREENS || screen == ui_screen_kept) return;
+    screen->destroy();
+}
+
+static void ui_screen_prebuild_timer_cb(lv_timer_t * timer)
+{
+    ui_screen_t * screen = lv_timer_get_user_data(timer);
+    ui_screen_prebuild_timer = NULL;
+    _ui_screen_build(screen);
+    ui_screen_kept = screen;
+}
+
+void _ui_screen_build(ui_screen_t * screen)
+{
+    if(*screen->target) return;
+    screen->init();
+    lv_obj_add_event_cb(*screen->target, ui_screen_unloaded_cb, LV_EVENT_SCREEN_UNLOADED, screen);
+    if(screen->created_cb) screen->created_cb();
+}
+
+void _ui_screen_lazy_change(ui_screen_t * screen, lv_screen_load_anim_t fademode, int spd, int delay,
+                            ui_screen_t * next)
+{
+    if(ui_screen_prebuild_timer) {
+        lv_timer_delete(ui_screen_prebuild_timer);
+        ui_screen_prebuild_timer = NULL;
+    }
+
+    _ui_screen_build(screen);
+
+    // A prebuilt screen which is neither the target nor the next likely one is not needed anymore
+    ui_screen_t * kept = ui_screen_kept;
+    ui_screen_kept = NULL;
+    if(UI_LAZY_SCREENS && kept && kept != screen && kept != next && *kept->target != lv_screen_active()) {
+        kept->destroy();
+    }
+
+    // Keep `next` before loading as a load without animation unloads the old screen synchronously
+    if(next && *next->target) ui_screen_kept = next;
+
+    lv_screen_load_anim(*screen->target, fademode, spd, delay, false);
+
+    if(UI_LAZY_SCREENS && next && *next->target == NULL) {
+        ui_screen_prebuild_timer = lv_timer_create(ui_screen_prebuild_timer_cb, spd + delay + _UI_SCREEN_PREBUILD_DELAY,
+                                                   next);
+        lv_timer_set_repeat_count(ui_screen_prebuild_timer, 1);
+    }
+}
+
 void _ui_opacity_set(lv_obj_t * target, int val)
 {
     lv_obj_set_style_opa(target, val, 0);
@@ -72,6 +72,27 @@ void _ui_textarea_move_cursor(lv_obj_t * target, int val)
 
 void scr_unloaded_delete_cb(lv_event_t * e);
 
+/* Screen lifecycle: with UI_LAZY_SCREENS a screen is built on its first navigation and destroyed
+ * when it gets unloaded, unless it was prebuilt as the next likely target.*/
+#ifndef UI_LAZY_SCREENS
+#define UI_LAZY_SCREENS 1
+#endif
+
+#define _UI_SCREEN_PREBUILD_DELAY 100
+
+/** Describes a screen managed by _ui_screen_lazy_change()*/
+typedef struct _ui_screen_t {
+    lv_obj_t ** target;
+    void (*init)(void);
+    void (*destroy)(void);
+    void (*created_cb)(void);
+} ui_screen_t;
+
+void _ui_screen_build(ui_screen_t * screen);
+
+void _ui_screen_lazy_change(ui_screen_t * screen, lv_screen_load_anim_t fademode, int spd, int delay,
+                            ui_screen_t * next);
+
 void _ui_opacity_set(lv_obj_t * target, int val);
 
 /** Describes an animation*/
@@ -0,0 +1,215 @@
+// Roda centenas de animações ao mesmo tempo no motor de animações do LVGL.
+//
+// Primeiro confere as tabelas dos caminhos de Bézier embutidos (ease_in, ease_out, ease_in_out e
+// overshoot) com a curva calculada em ponto flutuante, em todos os passos: não podem errar mais que meia
+// unidade além de lv_cubic_bezier, que os calculava antes. Depois anima 500 variáveis com todos os caminhos, atrasos,
+// ida e volta e repetições, com um exec_cb que apaga outra animação e um completed_cb que começa uma
+// nova, e confere o valor final e o número de conclusões de cada uma. Por fim mede o tempo de um passo
+// de 500 animações com caminho de Bézier.
+//
+// Compilar e rodar:
+//   make -C test/host run-anim_bench
+// Só compilar: make -C test/host, o programa fica em .host/anim_bench.
+
+#include <lvgl.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define ANIMS       500
+#define BENCH_STEPS 2000
+#define DELETER     3    // o exec_cb desta animação apaga a DELETED
+#define DELETED     4
+#define STARTER     5    // o completed_cb desta começa a animação ANIMS
+#define LUT_SLACK   0.5  // quanto as tabelas podem errar além de lv_cubic_bezier, num intervalo de 1000
+
+struct AnimState {
+    int32_t value;
+    int32_t expected;
+    int completed;
+    int expected_completed;
+};
+
+static uint32_t tick_ms;
+static AnimState anims[ANIMS + 1];
+
+static uint32_t tick_cb() {
+    return tick_ms;
+}
+
+static void exec_cb(void* var, int32_t value) {
+    AnimState* s = static_cast<AnimState*>(var);
+    s->value = value;
+    if (s == &anims[DELETER] && value > 50) {
+        lv_anim_delete(&anims[DELETED], exec_cb);
+    }
+}
+
+static void start(AnimState* s, int32_t from, int32_t to, uint32_t duration, lv_anim_path_cb_t path) {
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, s);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_values(&a, from, to);
+    lv_anim_set_duration(&a, duration);
+    lv_anim_set_path_cb(&a, path);
+    lv_anim_start(&a);
+}
+
+static void completed_cb(lv_anim_t* a) {
+    AnimState* s = static_cast<AnimState*>(a->var);
+    s->completed++;
+    if (s == &anims[STARTER]) {
+        start(&anims[ANIMS], 0, 1000, 300, lv_anim_path_linear);
+    }
+}
+
+static double now() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// y da curva cubic-bezier(x1, y1, x2, y2) em x, tudo em 0..1
+static double bezier(double x, double x1, double y1, double x2, double y2) {
+    double lo = 0;
+    double hi = 1;
+    for (int i = 0; i < 50; i++) {
+        const double s = (lo + hi) / 2;
+        const double xs = 3 * (1 - s) * (1 - s) * s * x1 + 3 * (1 - s) * s * s * x2 + s * s * s;
+        (xs < x ? lo : hi) = s;
+    }
+    const double s = (lo + hi) / 2;
+    return 3 * (1 - s) * (1 - s) * s * y1 + 3 * (1 - s) * s * s * y2 + s * s * s;
+}
+
+// Distância de uma animação de 0 a 1000 em cada passo de 1024 até a curva exata, pelo caminho e por
+// lv_cubic_bezier
+static bool check_luts() {
+    struct Bezier {
+        const char* name;
+        lv_anim_path_cb_t path;
+        int32_t x1, y1, x2, y2;
+    };
+    static const Bezier paths[] = {
+        {"ease_in", lv_anim_path_ease_in, LV_BEZIER_VAL_FLOAT(0.42), 0, LV_BEZIER_VAL_MAX, LV_BEZIER_VAL_MAX},
+        {"ease_out", lv_anim_path_ease_out, 0, 0, LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_MAX},
+        {"ease_in_out", lv_anim_path_ease_in_out, LV_BEZIER_VAL_FLOAT(0.42), 0, LV_BEZIER_VAL_FLOAT(0.58),
+         LV_BEZIER_VAL_MAX},
+        {"overshoot", lv_anim_path_overshoot, 341, 0, 683, 1300},
+    };
+
+    bool ok = true;
+    for (const Bezier& p : paths) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_values(&a, 0, 1000);
+        lv_anim_set_duration(&a, LV_BEZIER_VAL_MAX);
+        double lut_err = 0;
+        double cubic_err = 0;
+        for (int32_t t = 0; t <= LV_BEZIER_VAL_MAX; t++) {
+            a.act_time = t;
+            const double m = LV_BEZIER_VAL_MAX;
+            const double exact = 1000 * bezier(t / m, p.x1 / m, p.y1 / m, p.x2 / m, p.y2 / m);
+            const int32_t cubic = (lv_cubic_bezier(t, p.x1, p.y1, p.x2, p.y2) * 1000) >> LV_BEZIER_VAL_SHIFT;
+            lut_err = LV_MAX(lut_err, fabs(p.path(&a) - exact));
+            cubic_err = LV_MAX(cubic_err, fabs(cubic - exact));
+        }
+        const bool lut_ok = lut_err <= cubic_err + LUT_SLACK;
+        printf("%-12s max %.1f away from the exact curve in 0..1000, lv_cubic_bezier %.1f: %s\n", p.name, lut_err,
+               cubic_err, lut_ok ? "ok" : "FAILED");
+        ok &= lut_ok;
+    }
+    return ok;
+}
+
+static bool check_anims() {
+    static const lv_anim_path_cb_t paths[] = {lv_anim_path_linear,   lv_anim_path_ease_in,  lv_anim_path_ease_out,
+                                              lv_anim_path_ease_in_out, lv_anim_path_overshoot, lv_anim_path_bounce,
+                                              lv_anim_path_step};
+
+    for (int i = 0; i < ANIMS; i++) {
+        const bool playback = i % 5 == 0;
+        const uint32_t repeat = i % 9 == 0 ? 3 : 1;
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, &anims[i]);
+        lv_anim_set_exec_cb(&a, exec_cb);
+        lv_anim_set_values(&a, -i * 7, 1000 + i);
+        lv_anim_set_duration(&a, 200 + i * 3);
+        lv_anim_set_delay(&a, i % 40);
+        lv_anim_set_path_cb(&a, paths[i % 7]);
+        if (playback) {
+            lv_anim_set_playback_duration(&a, 150);
+        }
+        lv_anim_set_repeat_count(&a, repeat);
+        lv_anim_set_completed_cb(&a, completed_cb);
+        lv_anim_start(&a);
+
+        anims[i].expected = playback ? -i * 7 : 1000 + i;
+        anims[i].expected_completed = 1;
+    }
+    anims[DELETED].expected_completed = 0;
+    anims[ANIMS].expected = 1000;
+
+    const uint32_t running = lv_anim_count_running();
+    while (lv_anim_count_running() > 0 && tick_ms < 60000) {
+        tick_ms += 7;
+        lv_timer_handler();
+    }
+
+    int wrong = 0;
+    for (int i = 0; i <= ANIMS; i++) {
+        const AnimState& s = anims[i];
+        const bool value_ok = i == DELETED || s.value == s.expected;
+        if (!value_ok || s.completed != s.expected_completed) {
+            if (wrong++ < 5) {
+                printf("  animation %d: value %d, expected %d, completed %d times\n", i, s.value, s.expected,
+                       s.completed);
+            }
+        }
+    }
+    printf("%u animations at once: %s, %u still running\n", running, wrong ? "WRONG" : "all ended right",
+           lv_anim_count_running());
+    return wrong == 0 && lv_anim_count_running() == 0;
+}
+
+static void bench() {
+    static int32_t values[ANIMS];
+    for (int i = 0; i < ANIMS; i++) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, &values[i]);
+        lv_anim_set_exec_cb(&a, [](void* var, int32_t v) { *static_cast<int32_t*>(var) = v; });
+        lv_anim_set_values(&a, 0, 1000 + i);
+        lv_anim_set_duration(&a, 1000 + i);
+        lv_anim_set_path_cb(&a, lv_anim_path_ease_in_out);
+        lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+        lv_anim_start(&a);
+    }
+
+    double best = 1e9;
+    for (int r = 0; r < 5; r++) {
+        const double t0 = now();
+        for (int i = 0; i < BENCH_STEPS; i++) {
+            tick_ms++;
+            lv_anim_refr_now();
+        }
+        best = LV_MIN(best, now() - t0);
+    }
+    printf("%d ease_in_out animations: %.1f us per step\n", ANIMS, best * 1e6 / BENCH_STEPS);
+    lv_anim_delete_all();
+}
+
+int main() {
+    lv_init();
+    lv_tick_set_cb(tick_cb);
+
+    bool ok = check_luts();
+    ok &= check_anims();
+    bench();
+
+    lv_deinit();
+    return ok ? 0 : 1;
+}
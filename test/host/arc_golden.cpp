@@ -0,0 +1,208 @@
+// Compara os arcos do rasterizador analítico (lv_draw_arc_dsc_t.analytic) com os das máscaras do LVGL,
+// que servem de imagem de referência: a mesma cena é desenhada das duas formas e os pixels comparados.
+// Cenas: seis arcos de 4 a 49 px de largura, os mesmos com pontas arredondadas, o medidor da Screen1 e
+// voltas inteiras com imagem (90..450° e 30..390°), que devem sair iguais ao anel sem imagem, sem
+// costura onde o início e o fim se encontram.
+// Falha se a diferença passar dos limites de cada cena.
+//
+// Com o argumento "ppm" grava cada cena em .host/arc_golden_<cena>.ppm, referência em cima e
+// analítico embaixo.
+//
+// Compilar e rodar:
+//   make -C test/host run-arc_golden
+// Só compilar: make -C test/host, o programa fica em .host/arc_golden.
+
+#include <lvgl.h>
+#include <ui/ui.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HOR_RES 480
+#define VER_RES 320
+#define RING    240
+
+struct Diff {
+    int pixels;  // pixels diferentes
+    int max;     // maior diferença de um canal, 0..255
+    int big;     // pixels com diferença maior que 64
+};
+
+static uint16_t draw_buf[HOR_RES * VER_RES];
+static uint16_t frames[2][HOR_RES * VER_RES];
+static int frame;
+static bool analytic;
+static int32_t full_turn = -1;  // início da volta inteira com imagem, -1 sem
+static bool write_ppm;
+
+static uint16_t ring_px[RING * RING];
+static lv_image_dsc_t ring_img;
+
+static void flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    memcpy(frames[frame], px_map, lv_area_get_size(area) * 2);
+    lv_display_flush_ready(disp);
+}
+
+// O analítico é ligado desenho a desenho, como no medidor do firmware
+static void draw_task_cb(lv_event_t* e) {
+    lv_draw_arc_dsc_t* arc_dsc = lv_draw_task_get_arc_dsc(lv_event_get_draw_task(e));
+    if (arc_dsc == NULL) {
+        return;
+    }
+    arc_dsc->analytic = analytic;
+    if (full_turn >= 0) {
+        arc_dsc->start_angle = full_turn;
+        arc_dsc->end_angle = full_turn + 360;
+        arc_dsc->img_src = &ring_img;
+    }
+}
+
+static void hook(lv_obj_t* obj) {
+    lv_obj_add_event_cb(obj, draw_task_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+}
+
+static int channel(uint16_t c, int i) {
+    return i == 0 ? (c >> 11) << 3 : i == 1 ? ((c >> 5) & 63) << 2 : (c & 31) << 3;
+}
+
+static void save_ppm(const char* name, int w, int h) {
+    char path[64];
+    snprintf(path, sizeof(path), ".host/arc_golden_%s.ppm", name);
+    FILE* f = fopen(path, "wb");
+    if (f == NULL) {
+        return;
+    }
+    fprintf(f, "P6 %d %d 255\n", w, h * 2);
+    for (int k = 0; k < 2; k++) {
+        for (int i = 0; i < w * h; i++) {
+            const uint8_t px[3] = {(uint8_t)channel(frames[k][i], 0), (uint8_t)channel(frames[k][i], 1),
+                                   (uint8_t)channel(frames[k][i], 2)};
+            fwrite(px, 1, 3, f);
+        }
+    }
+    fclose(f);
+}
+
+// Quadro 0 com as máscaras, quadro 1 com o analítico, ou a volta inteira com imagem no quadro 1
+static Diff render(lv_display_t* disp, int32_t turn) {
+    analytic = false;
+    full_turn = -1;
+    frame = 0;
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+
+    analytic = true;
+    full_turn = turn;
+    frame = 1;
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+
+    Diff diff = {};
+    const int n = lv_display_get_horizontal_resolution(disp) * lv_display_get_vertical_resolution(disp);
+    for (int i = 0; i < n; i++) {
+        if (frames[0][i] == frames[1][i]) {
+            continue;
+        }
+        int d = 0;
+        for (int c = 0; c < 3; c++) {
+            d = LV_MAX(d, abs(channel(frames[0][i], c) - channel(frames[1][i], c)));
+        }
+        diff.pixels++;
+        diff.max = LV_MAX(diff.max, d);
+        diff.big += d > 64;
+    }
+    return diff;
+}
+
+static bool check(const char* name, lv_display_t* disp, int32_t turn, int max_pixels, int max_diff, int max_big) {
+    const Diff d = render(disp, turn);
+    const bool ok = d.pixels <= max_pixels && d.max <= max_diff && d.big <= max_big;
+    printf("%-14s %5d px differ, max %3d, %3d over 64: %s\n", name, d.pixels, d.max, d.big, ok ? "ok" : "FAILED");
+    if (write_ppm) {
+        save_ppm(name, lv_display_get_horizontal_resolution(disp), lv_display_get_vertical_resolution(disp));
+    }
+    return ok;
+}
+
+static lv_obj_t* blank_screen() {
+    lv_obj_t* screen = lv_obj_create(NULL);
+    lv_obj_remove_style_all(screen);
+    lv_obj_set_style_bg_opa(screen, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(screen, lv_color_white(), 0);
+    lv_screen_load(screen);
+    return screen;
+}
+
+static void arcs_screen(bool rounded) {
+    lv_obj_t* screen = blank_screen();
+    for (int i = 0; i < 6; i++) {
+        lv_obj_t* arc = lv_arc_create(screen);
+        lv_obj_remove_style_all(arc);
+        hook(arc);
+        lv_obj_set_pos(arc, 10 + (i % 3) * 155, 10 + (i / 3) * 155);
+        lv_obj_set_size(arc, 145, 145);
+        lv_arc_set_bg_angles(arc, 0, 360);
+        lv_arc_set_angles(arc, 37 * i + 5, 37 * i + 5 + 40 + 50 * i);
+        lv_obj_set_style_arc_width(arc, 4 + i * 9, LV_PART_MAIN);
+        lv_obj_set_style_arc_width(arc, 4 + i * 9, LV_PART_INDICATOR);
+        lv_obj_set_style_arc_color(arc, lv_palette_lighten(LV_PALETTE_GREY, 2), LV_PART_MAIN);
+        lv_obj_set_style_arc_color(arc, lv_palette_main(LV_PALETTE_GREEN), LV_PART_INDICATOR);
+        lv_obj_set_style_arc_rounded(arc, rounded, LV_PART_MAIN);
+        lv_obj_set_style_arc_rounded(arc, rounded, LV_PART_INDICATOR);
+    }
+}
+
+// O anel de referência vai de 0° a 360° sem imagem, que o LVGL desenha como uma borda redonda
+static void ring_screen() {
+    const lv_color_t color = lv_color_hex(0xFF4040);
+    for (int i = 0; i < RING * RING; i++) {
+        ring_px[i] = lv_color_to_u16(color);
+    }
+    ring_img.header.magic = LV_IMAGE_HEADER_MAGIC;
+    ring_img.header.cf = LV_COLOR_FORMAT_RGB565;
+    ring_img.header.w = RING;
+    ring_img.header.h = RING;
+    ring_img.header.stride = RING * 2;
+    ring_img.data_size = sizeof(ring_px);
+    ring_img.data = (const uint8_t*)ring_px;
+
+    lv_obj_t* arc = lv_arc_create(blank_screen());
+    lv_obj_remove_style_all(arc);
+    hook(arc);
+    lv_obj_set_size(arc, RING, RING);
+    lv_obj_center(arc);
+    lv_arc_set_bg_angles(arc, 0, 360);
+    lv_obj_set_style_arc_width(arc, 30, LV_PART_MAIN);
+    lv_obj_set_style_arc_color(arc, color, LV_PART_MAIN);
+}
+
+int main(int argc, char** argv) {
+    write_ppm = argc > 1 && strcmp(argv[1], "ppm") == 0;
+    lv_init();
+
+    lv_display_t* wide = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_buffers(wide, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_FULL);
+    lv_display_set_flush_cb(wide, flush_cb);
+
+    lv_display_t* round = lv_display_create(RING, RING);
+    lv_display_set_buffers(round, draw_buf, NULL, RING * RING * 2, LV_DISPLAY_RENDER_MODE_FULL);
+    lv_display_set_flush_cb(round, flush_cb);
+
+    bool ok = true;
+    lv_display_set_default(wide);
+    arcs_screen(false);
+    ok &= check("arcs", wide, -1, 2500, 96, 40);
+    arcs_screen(true);
+    ok &= check("arcs_rounded", wide, -1, 3000, 160, 300);
+
+    lv_display_set_default(round);
+    ui_init();
+    hook(ui_Arc1);
+    ok &= check("gauge", round, -1, 600, 64, 0);
+    ring_screen();
+    ok &= check("full_turn_90", round, 90, 1500, 64, 0);
+    ok &= check("full_turn_30", round, 30, 1500, 64, 0);
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,276 @@
+// Carrega uma fonte binária grande e uma imagem .bin pelo driver POSIX com LV_FS_POSIX_MMAP, primeiro
+// mapeando os arquivos e depois copiando-os para o heap (sem o map_cb do driver), e mostra o tempo de
+// carga e quanto o RSS cresceu.
+//
+// O repositório não tem fonte CJK, então o programa gera uma parecida em .host/binfont_mmap_font.bin:
+// 20000 glifos de 32x32 px em 4 bpp a partir de U+4E00, com tabela de kerning, uns 10 MB. A imagem
+// .host/binfont_mmap_img.bin é RGB565 de 1024x1024. A configuração os liga LV_FONT_FMT_TXT_LARGE, sem o
+// qual os bitmaps de uma fonte acima de 1 MB não podem ser usados direto do arquivo.
+// Falha se os glifos lidos das duas formas forem diferentes, se a fonte mapeada não usar bem menos
+// memória que a copiada ou se os pixels da imagem mapeada não forem os do arquivo.
+//
+// Compilar e rodar:
+//   make -C test/host run-binfont_mmap
+// Só compilar: make -C test/host, o programa fica em .host/binfont_mmap.
+
+#include <lvgl.h>
+#include <src/draw/lv_image_decoder_private.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+#define FONT_PATH  ".host/binfont_mmap_font.bin"
+#define IMG_PATH   ".host/binfont_mmap_img.bin"
+#define GLYPHS     20000
+#define GLYPH_SIZE 32
+#define FIRST_CP   0x4E00
+#define IMG_SIZE   1024
+
+struct Load {
+    double us;
+    long rss_kb;
+    uint32_t hash;
+};
+
+typedef std::vector<uint8_t> Bytes;
+
+static void put8(Bytes& b, uint32_t v) {
+    b.push_back((uint8_t)v);
+}
+
+static void put16(Bytes& b, uint32_t v) {
+    put8(b, v);
+    put8(b, v >> 8);
+}
+
+static void put32(Bytes& b, uint32_t v) {
+    put16(b, v);
+    put16(b, v >> 16);
+}
+
+// Uma tabela da fonte: tamanho com o cabeçalho, nome de 4 letras e conteúdo
+static void put_table(Bytes& font, const char* name, const Bytes& body) {
+    put32(font, 8 + body.size());
+    font.insert(font.end(), name, name + 4);
+    font.insert(font.end(), body.begin(), body.end());
+}
+
+static bool write_font() {
+    Bytes head;
+    put32(head, 1);                 // version
+    put16(head, 4);                 // tables
+    put16(head, GLYPH_SIZE);        // font_size
+    put16(head, 30);                // ascent
+    put16(head, (uint16_t)-8);      // descent
+    put16(head, 30);                // typo_ascent
+    put16(head, (uint16_t)-8);      // typo_descent
+    put16(head, 0);                 // typo_line_gap
+    put16(head, (uint16_t)-8);      // min_y
+    put16(head, 30);                // max_y
+    put16(head, 0);                 // default_advance_width
+    put16(head, 16);                // kerning_scale
+    put8(head, 1);                  // index_to_loc_format: 32 bits
+    put8(head, 1);                  // glyph_id_format: 16 bits
+    put8(head, 0);                  // advance_width_format: inteiro
+    put8(head, 4);                  // bits_per_pixel
+    put8(head, 4);                  // xy_bits
+    put8(head, 8);                  // wh_bits
+    put8(head, 8);                  // advance_width_bits
+    put8(head, 0);                  // compression_id
+    put8(head, 0);                  // subpixels_mode
+    put8(head, 0);                  // padding
+    put16(head, (uint16_t)-4);      // underline_position
+    put16(head, 2);                 // underline_thickness
+
+    // Um intervalo contínuo de códigos (formato 2, FORMAT0_TINY), os dados logo depois da subtabela
+    Bytes cmap;
+    put32(cmap, 1);
+    put32(cmap, 8 + 4 + 16);
+    put32(cmap, FIRST_CP);
+    put16(cmap, GLYPHS);
+    put16(cmap, 1);
+    put16(cmap, 0);
+    put8(cmap, 2);
+    put8(cmap, 0);
+
+    // Glifo 0 vazio. Cada glifo: avanço de 8 bits, x e y de 4 bits, w e h de 8 bits e o bitmap.
+    // Os primeiros 64 são aleatórios, os outros um padrão que muda com o glifo.
+    Bytes glyf;
+    Bytes loca;
+    put32(loca, GLYPHS + 1);
+    put32(loca, 8);
+    uint32_t seed = 1;
+    for (uint32_t i = 0; i < GLYPHS; i++) {
+        put32(loca, 8 + glyf.size());
+        put8(glyf, 30);
+        put8(glyf, (1 << 4) | (-4 & 0xF));
+        put8(glyf, GLYPH_SIZE);
+        put8(glyf, GLYPH_SIZE);
+        for (uint32_t k = 0; k < GLYPH_SIZE * GLYPH_SIZE / 2; k++) {
+            seed = seed * 1103515245u + 12345u;
+            put8(glyf, i < 64 ? seed >> 16 : i * 7 + k);
+        }
+    }
+
+    // Kerning por classes (formato 3), 4 classes de cada lado
+    Bytes kern = {3, 0, 0, 0};
+    put16(kern, GLYPHS + 1);
+    put8(kern, 4);
+    put8(kern, 4);
+    put8(kern, 0);
+    for (uint32_t i = 0; i < GLYPHS; i++) put8(kern, 1 + i % 4);
+    put8(kern, 0);
+    for (uint32_t i = 0; i < GLYPHS; i++) put8(kern, 1 + i * 3 % 4);
+    for (int v = 0; v < 16; v++) put8(kern, v - 8);
+
+    Bytes font;
+    put_table(font, "head", head);
+    put_table(font, "cmap", cmap);
+    put_table(font, "loca", loca);
+    put_table(font, "glyf", glyf);
+    put_table(font, "kern", kern);
+
+    FILE* f = fopen(FONT_PATH, "wb");
+    if (f == NULL) {
+        return false;
+    }
+    fwrite(font.data(), 1, font.size(), f);
+    fclose(f);
+    return true;
+}
+
+static uint32_t fnv(const void* data, size_t len, uint32_t hash = 2166136261u) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    while (len--) {
+        hash = (hash ^ *p++) * 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t write_image() {
+    static uint16_t px[IMG_SIZE * IMG_SIZE];
+    for (uint32_t i = 0; i < IMG_SIZE * IMG_SIZE; i++) {
+        px[i] = (uint16_t)(i * 2654435761u >> 16);
+    }
+    lv_image_header_t header = {};
+    header.magic = LV_IMAGE_HEADER_MAGIC;
+    header.cf = LV_COLOR_FORMAT_RGB565;
+    header.w = IMG_SIZE;
+    header.h = IMG_SIZE;
+    header.stride = IMG_SIZE * 2;
+
+    FILE* f = fopen(IMG_PATH, "wb");
+    if (f == NULL) {
+        return 0;
+    }
+    fwrite(&header, 1, sizeof(header), f);
+    fwrite(px, 1, sizeof(px), f);
+    fclose(f);
+    return fnv(px, sizeof(px));
+}
+
+static double now_us() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e6 + t.tv_nsec * 1e-3;
+}
+
+static long rss_kb() {
+    FILE* f = fopen("/proc/self/status", "r");
+    char line[256];
+    long kb = 0;
+    while (fgets(line, sizeof(line), f)) {
+        if (strncmp(line, "VmRSS:", 6) == 0) {
+            sscanf(line + 6, "%ld", &kb);
+        }
+    }
+    fclose(f);
+    return kb;
+}
+
+// Tempo e RSS da carga e um hash de um glifo a cada 97, com as métricas e o kerning
+static bool load_font(Load* load) {
+    const long rss = rss_kb();
+    const double start = now_us();
+    lv_font_t* font = lv_binfont_create("A:" FONT_PATH);
+    load->us = now_us() - start;
+    load->rss_kb = rss_kb() - rss;
+    if (font == NULL) {
+        printf("the font didn't load\n");
+        return false;
+    }
+
+    lv_draw_buf_t* buf = lv_draw_buf_create(GLYPH_SIZE, GLYPH_SIZE, LV_COLOR_FORMAT_A8, 0);
+    load->hash = 2166136261u;
+    for (uint32_t cp = FIRST_CP; cp < FIRST_CP + GLYPHS; cp += 97) {
+        lv_font_glyph_dsc_t g;
+        if (!lv_font_get_glyph_dsc(font, &g, cp, cp + 1)) {
+            printf("no glyph for U+%X\n", cp);
+            return false;
+        }
+        load->hash = fnv(&g.adv_w, sizeof(g.adv_w), load->hash);
+        load->hash = fnv(&g.box_w, sizeof(g.box_w), load->hash);
+        g.resolved_font = font;
+        lv_memzero(buf->data, buf->data_size);
+        lv_font_get_glyph_bitmap(&g, buf);
+        load->hash = fnv(buf->data, buf->data_size, load->hash);
+    }
+    lv_draw_buf_destroy(buf);
+    lv_binfont_destroy(font);
+    return true;
+}
+
+static bool check_image(uint32_t expected) {
+    lv_image_decoder_dsc_t dsc;
+    lv_image_decoder_args_t args = {};
+    args.no_cache = true;
+    const long rss = rss_kb();
+    const double start = now_us();
+    if (lv_image_decoder_open(&dsc, "A:" IMG_PATH, &args) != LV_RESULT_OK || dsc.decoded == NULL) {
+        printf("the image isn't mapped\n");
+        return false;
+    }
+    const double us = now_us() - start;
+    const long kb = rss_kb() - rss;
+    const uint32_t hash = fnv(dsc.decoded->data, dsc.decoded->header.stride * dsc.decoded->header.h);
+    lv_image_decoder_close(&dsc);
+
+    const bool ok = hash == expected;
+    printf("image %dx%d mapped: open %.0f us, RSS +%ld kB, %s\n", IMG_SIZE, IMG_SIZE, us, kb,
+           ok ? "same pixels" : "PIXELS DIFFER");
+    return ok;
+}
+
+int main() {
+    lv_init();
+    const uint32_t img_hash = write_image();
+    if (!write_font() || img_hash == 0) {
+        printf("can't write the files into .host\n");
+        return 1;
+    }
+
+    lv_fs_drv_t* drv = lv_fs_get_drv('A');
+    const auto map_cb = drv->map_cb;
+
+    Load mapped;
+    Load copied;
+    if (!load_font(&mapped)) {
+        return 1;
+    }
+    drv->map_cb = NULL;
+    if (!load_font(&copied)) {
+        return 1;
+    }
+    drv->map_cb = map_cb;
+
+    printf("font mapped: load %.0f us, RSS +%ld kB\n", mapped.us, mapped.rss_kb);
+    printf("font copied: load %.0f us, RSS +%ld kB\n", copied.us, copied.rss_kb);
+    bool ok = mapped.hash == copied.hash;
+    printf("glyphs: %s\n", ok ? "same" : "DIFFERENT");
+    ok &= mapped.rss_kb * 4 < copied.rss_kb;
+    ok &= check_image(img_hash);
+
+    lv_deinit();
+    return ok ? 0 : 1;
+}
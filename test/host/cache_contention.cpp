@@ -0,0 +1,166 @@
+// Mede a disputa pelo lock do cache com várias threads: cada thread busca chaves aleatórias de um
+// conjunto maior que o cache (lv_cache_acquire_or_create e release) e o tempo é comparado entre o cache de um
+// lock só e o dividido em 4 e 8 partes (lv_cache_create_sharded). Com uma CPU só as threads não rodam
+// juntas e os números mostram só o custo do lock, o ganho das partes aparece com várias CPUs.
+//
+// Confere também que os contadores somam as partes, que lv_cache_reset_stats os zera e que
+// lv_cache_evict_one passa para outra parte quando a mais cheia só tem entradas em uso.
+//
+// Compilar e rodar:
+//   make -C test/host run-cache_contention
+// Só compilar: make -C test/host, o programa fica em .host/cache_contention.
+
+#include <lvgl.h>
+#include <src/lvgl_private.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <time.h>
+
+#define CACHE_SIZE  512
+#define KEYS        2000
+#define OPS         400000
+#define MAX_THREADS 8
+
+struct Item {
+    lv_cache_slot_size_t slot;
+    uint32_t key;
+};
+
+static lv_cache_t* cache;
+
+static lv_cache_compare_res_t compare_cb(const Item* a, const Item* b) {
+    return a->key == b->key ? 0 : (a->key > b->key ? 1 : -1);
+}
+
+static uint32_t hash_cb(const Item* item) {
+    return (item->key * 2654435761u) >> 8;
+}
+
+static bool create_cb(Item* item, void* user_data) {
+    LV_UNUSED(item);
+    LV_UNUSED(user_data);
+    return true;
+}
+
+static void free_cb(Item* item, void* user_data) {
+    LV_UNUSED(item);
+    LV_UNUSED(user_data);
+}
+
+// Busca e criação sob o mesmo lock: com acquire e add separados duas threads podem criar a mesma chave
+static lv_cache_entry_t* get(uint32_t key) {
+    Item item = {1, key};
+    return lv_cache_acquire_or_create(cache, &item, NULL);
+}
+
+static void* worker(void* arg) {
+    uint32_t seed = (uint32_t)(uintptr_t)arg * 7919 + 1;
+    for (int i = 0; i < OPS; i++) {
+        seed = seed * 1103515245u + 12345u;
+        lv_cache_entry_t* entry = get((seed >> 8) % KEYS);
+        if (entry != NULL) {
+            lv_cache_release(cache, entry, NULL);
+        }
+    }
+    return NULL;
+}
+
+static double now() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static lv_cache_t* create(uint32_t size, uint32_t shard_cnt) {
+    lv_cache_ops_t ops = {};
+    ops.compare_cb = (lv_cache_compare_cb_t)compare_cb;
+    ops.create_cb = (lv_cache_create_cb_t)create_cb;
+    ops.free_cb = (lv_cache_free_cb_t)free_cb;
+    return lv_cache_create_sharded(&lv_cache_class_lru_rb_count, sizeof(Item), size, ops,
+                                   (lv_cache_hash_cb_t)hash_cb, shard_cnt);
+}
+
+static bool bench(uint32_t shard_cnt) {
+    bool ok = true;
+    for (int thread_cnt = 1; thread_cnt <= MAX_THREADS; thread_cnt *= 2) {
+        cache = create(CACHE_SIZE, shard_cnt);
+
+        pthread_t threads[MAX_THREADS];
+        const double start = now();
+        for (int i = 0; i < thread_cnt; i++) {
+            pthread_create(&threads[i], NULL, worker, (void*)(uintptr_t)i);
+        }
+        for (int i = 0; i < thread_cnt; i++) {
+            pthread_join(threads[i], NULL);
+        }
+        const double elapsed = now() - start;
+
+        lv_cache_stats_t stats;
+        lv_cache_get_stats(cache, &stats);
+        printf("shards %u, threads %d: %6.2f Mops/s, %4.0f ns/op, hit %u%%\n", shard_cnt, thread_cnt,
+               thread_cnt * OPS / elapsed / 1e6, elapsed * 1e9 / OPS,
+               (uint32_t)((uint64_t)stats.hit_cnt * 100 / (stats.hit_cnt + stats.miss_cnt)));
+        if (stats.hit_cnt + stats.miss_cnt != (uint32_t)thread_cnt * OPS) {
+            printf("  lookups %u, expected %u\n", stats.hit_cnt + stats.miss_cnt, (uint32_t)thread_cnt * OPS);
+            ok = false;
+        }
+
+        lv_cache_reset_stats(cache);
+        lv_cache_get_stats(cache, &stats);
+        if (stats.hit_cnt != 0 || stats.miss_cnt != 0 || stats.evict_cnt != 0) {
+            printf("  stats not reset\n");
+            ok = false;
+        }
+
+        lv_cache_destroy(cache, NULL);
+    }
+    return ok;
+}
+
+// Enche uma parte com entradas em uso e as outras com entradas livres
+static bool evict_fallback() {
+    const uint32_t shard_cnt = 4;
+    cache = create(64, shard_cnt);
+
+    Item probe = {1, 0};
+    const uint32_t full = hash_cb(&probe) % shard_cnt;
+    lv_cache_entry_t* held[3];
+    int held_cnt = 0;
+    for (uint32_t key = 0; held_cnt < 3; key++) {
+        probe.key = key;
+        if (hash_cb(&probe) % shard_cnt == full) {
+            held[held_cnt++] = get(key);
+        }
+    }
+    for (uint32_t key = 1000; key < 1002; key++) {
+        probe.key = key;
+        if (hash_cb(&probe) % shard_cnt != full) {
+            lv_cache_release(cache, get(key), NULL);
+        }
+    }
+
+    const size_t before = lv_cache_get_size(cache, NULL);
+    const bool evicted = lv_cache_evict_one(cache, NULL);
+    const size_t after = lv_cache_get_size(cache, NULL);
+    printf("evict with the fullest shard in use: %s, size %zu -> %zu\n", evicted ? "ok" : "FAILED", before, after);
+
+    for (int i = 0; i < held_cnt; i++) {
+        lv_cache_release(cache, held[i], NULL);
+    }
+    lv_cache_destroy(cache, NULL);
+    return evicted && after < before;
+}
+
+int main() {
+    lv_init();
+
+    bool ok = true;
+    const uint32_t shard_cnts[] = {1, 4, 8};
+    for (uint32_t shard_cnt : shard_cnts) {
+        ok &= bench(shard_cnt);
+    }
+    ok &= evict_fallback();
+
+    lv_deinit();
+    return ok ? 0 : 1;
+}
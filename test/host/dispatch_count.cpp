@@ -0,0 +1,119 @@
+// Conta os envios de eventos por quadro na Screen1, com um callback de CLICKED em cada objeto e um de
+// VALUE_CHANGED no arco: o arco e os labels mudam a cada quadro e um CLICKED é enviado a cada 10.
+// lv_event_send é interceptado pelo ligador (--wrap) para contar os envios, os que chegam a uma lista
+// com callbacks e os que nenhum callback da lista aceita, que a máscara de códigos pula sem percorrer.
+// Falha se os callbacks não rodarem uma vez por evento enviado a eles.
+//
+// Compilar e rodar:
+//   make -C test/host run-dispatch_count
+// Só compilar: make -C test/host, o programa fica em .host/dispatch_count.
+
+#include <lvgl.h>
+#include <src/lvgl_private.h>
+#include <ui/ui.h>
+#include <stdio.h>
+#include <time.h>
+
+#define HOR_RES 240
+#define VER_RES 240
+#define FRAMES  500
+
+alignas(4) static lv_color_t draw_buf[HOR_RES * VER_RES / 4];
+
+static uint32_t tick_ms;
+static uint32_t obj_cnt;
+static uint64_t sends;
+static uint64_t with_list;
+static uint64_t without_handler;
+static uint64_t callbacks;
+
+extern "C" lv_result_t __real_lv_event_send(lv_event_list_t* list, lv_event_t* e, bool preprocess);
+
+// Conta e repassa ao lv_event_send verdadeiro
+extern "C" lv_result_t __wrap_lv_event_send(lv_event_list_t* list, lv_event_t* e, bool preprocess) {
+    sends++;
+    if (list != NULL && lv_array_size(&list->array) > 0) {
+        with_list++;
+        bool handled = false;
+        lv_event_dsc_t** dsc = static_cast<lv_event_dsc_t**>(lv_array_front(&list->array));
+        for (uint32_t i = 0; i < lv_array_size(&list->array); i++) {
+            const uint32_t filter = dsc[i]->filter & ~LV_EVENT_PREPROCESS;
+            handled |= filter == LV_EVENT_ALL || filter == lv_event_get_code(e);
+        }
+        if (!handled) {
+            without_handler++;
+        }
+    }
+    return __real_lv_event_send(list, e, preprocess);
+}
+
+static uint32_t tick_cb() {
+    return tick_ms;
+}
+
+static void flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+    lv_display_flush_ready(disp);
+}
+
+static void event_cb(lv_event_t* e) {
+    LV_UNUSED(e);
+    callbacks++;
+}
+
+static void add_clicked_cbs(lv_obj_t* obj) {
+    obj_cnt++;
+    lv_obj_add_event_cb(obj, event_cb, LV_EVENT_CLICKED, NULL);
+    for (uint32_t i = 0; i < lv_obj_get_child_count(obj); i++) {
+        add_clicked_cbs(lv_obj_get_child(obj, i));
+    }
+}
+
+static double now() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main() {
+    lv_init();
+    lv_tick_set_cb(tick_cb);
+
+    lv_display_t* disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    ui_init();
+
+    add_clicked_cbs(lv_screen_active());
+    lv_obj_add_event_cb(ui_Arc1, event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    lv_refr_now(disp);
+
+    sends = with_list = without_handler = callbacks = 0;
+    const double start = now();
+    for (int f = 0; f < FRAMES; f++) {
+        tick_ms += 16;
+        lv_arc_set_value(ui_Arc1, f % 100);
+        lv_obj_send_event(ui_Arc1, LV_EVENT_VALUE_CHANGED, NULL);
+        lv_label_set_text_fmt(ui_Label1, "%d%%", f % 100);
+        lv_label_set_text_fmt(ui_Label2, "FPS: %d.%d", 30 + f % 3, f % 10);
+        if (f % 10 == 0) {
+            lv_obj_send_event(ui_Arc1, LV_EVENT_CLICKED, NULL);
+        }
+        lv_timer_handler();
+        lv_refr_now(disp);
+    }
+    const double elapsed = now() - start;
+
+    printf("%u objects, per frame: %.1f sends, %.1f to lists with callbacks, %.1f with no callback for the "
+           "event, %.2f callbacks, %.1f us\n",
+           obj_cnt, (double)sends / FRAMES, (double)with_list / FRAMES, (double)without_handler / FRAMES,
+           (double)callbacks / FRAMES, elapsed * 1e6 / FRAMES);
+
+    const uint64_t expected = FRAMES + FRAMES / 10;
+    if (callbacks != expected) {
+        printf("%llu callbacks, expected %llu\n", (unsigned long long)callbacks, (unsigned long long)expected);
+        return 1;
+    }
+    return 0;
+}
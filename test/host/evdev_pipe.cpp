@@ -0,0 +1,205 @@
+// Alimenta o driver de evdev do LVGL com input_events sintéticos escritos num pipe, sem uinput, e
+// confere a leitura por epoll e o agrupamento dos eventos.
+//
+// Cada toque é escrito de uma vez: posição, toque, 20 movimentos com o dedo na tela e a soltura, cada
+// um seguido de SYN_REPORT. São 3 toques lidos pelo epoll do laço principal e depois 3 pelo timer do
+// indev, como antes. Também mede a latência de um toque que espera 3 ms no pipe e um arraste de 100
+// movimentos.
+// Falha se um modo não der 3 pressionamentos e 3 cliques, se o epoll precisar de mais que 2 leituras
+// por toque, se o LVGL chamar read() no pipe vazio no modo epoll, se a latência medida for menor que a
+// espera ou se o arraste não soltar na última posição. read() é interceptado pelo ligador (--wrap) para
+// contar as chamadas.
+//
+// Compilar e rodar:
+//   make -C test/host run-evdev_pipe
+// Só compilar: make -C test/host, o programa fica em .host/evdev_pipe.
+
+#include <lvgl.h>
+#include <linux/input.h>
+#include <stdio.h>
+#include <sys/epoll.h>
+#include <time.h>
+#include <unistd.h>
+
+#define TAPS    3
+#define MOVES   20
+#define DRAG    100
+#define WAIT_US 3000
+
+static uint32_t tick_ms;
+static uint8_t draw_buf[240 * 40 * 2];
+static int pipe_rd = -1;
+static int pipe_wr = -1;
+static int read_calls;
+static int presses;
+static int clicks;
+static lv_point_t released_at;
+
+extern "C" ssize_t __real_read(int fd, void* buf, size_t count);
+
+extern "C" ssize_t __wrap_read(int fd, void* buf, size_t count) {
+    if (fd == pipe_rd) {
+        read_calls++;
+    }
+    return __real_read(fd, buf, count);
+}
+
+static uint32_t tick_cb() {
+    return tick_ms;
+}
+
+static void flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    lv_display_flush_ready(disp);
+}
+
+static void button_cb(lv_event_t* e) {
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_PRESSED:
+            presses++;
+            break;
+        case LV_EVENT_CLICKED:
+            clicks++;
+            break;
+        default:
+            lv_indev_get_point(lv_indev_active(), &released_at);
+            break;
+    }
+}
+
+// Com o relógio que o driver usa num arquivo que não aceita EVIOCSCLOCKID
+static void write_event(int type, int code, int value) {
+    timespec t;
+    clock_gettime(CLOCK_REALTIME, &t);
+    input_event in = {};
+    in.input_event_sec = t.tv_sec;
+    in.input_event_usec = t.tv_nsec / 1000;
+    in.type = type;
+    in.code = code;
+    in.value = value;
+    if (write(pipe_wr, &in, sizeof(in)) != sizeof(in)) {
+        perror("write");
+    }
+}
+
+static void write_report(int type, int code, int value) {
+    write_event(type, code, value);
+    write_event(EV_SYN, SYN_REPORT, 0);
+}
+
+static void write_touch(int x, int moves) {
+    write_event(EV_ABS, ABS_X, x);
+    write_event(EV_ABS, ABS_Y, 100);
+    write_report(EV_KEY, BTN_TOUCH, 1);
+    for (int m = 1; m <= moves; m++) {
+        write_report(EV_ABS, ABS_X, x + m);
+    }
+    write_report(EV_KEY, BTN_TOUCH, 0);
+}
+
+static lv_indev_t* create_indev() {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return NULL;
+    }
+    pipe_rd = fds[0];
+    pipe_wr = fds[1];
+    lv_indev_t* indev = lv_evdev_create_fd(LV_INDEV_TYPE_POINTER, pipe_rd);
+    lv_evdev_set_calibration(indev, 0, 0, 239, 239);
+    return indev;
+}
+
+static void delete_indev(lv_indev_t* indev) {
+    lv_evdev_delete(indev);
+    close(pipe_wr);
+    presses = 0;
+    clicks = 0;
+}
+
+// Lê quando o epoll avisa, até o pipe ficar vazio. Devolve quantas leituras fez.
+static int drain_epoll(int epoll_fd) {
+    int reads = 0;
+    epoll_event ev;
+    while (epoll_wait(epoll_fd, &ev, 1, 0) == 1) {
+        lv_indev_read(static_cast<lv_indev_t*>(ev.data.ptr));
+        reads++;
+    }
+    return reads;
+}
+
+static bool check_epoll() {
+    lv_indev_t* indev = create_indev();
+    const int epoll_fd = epoll_create1(0);
+    if (lv_evdev_set_epoll(indev, epoll_fd) != LV_RESULT_OK) {
+        printf("lv_evdev_set_epoll failed\n");
+        return false;
+    }
+
+    // Sem entrada o timer do indev não lê
+    read_calls = 0;
+    for (int i = 0; i < 100; i++) {
+        tick_ms += 5;
+        lv_timer_handler();
+    }
+    const int idle_reads = read_calls;
+
+    for (int t = 0; t < TAPS; t++) {
+        write_touch(100, MOVES);
+    }
+    const int reads = drain_epoll(epoll_fd);
+    const int taps_presses = presses;
+    const int taps_clicks = clicks;
+
+    write_touch(100, 0);
+    usleep(WAIT_US);
+    drain_epoll(epoll_fd);
+    const uint32_t latency = lv_evdev_get_latency(indev);
+
+    write_touch(20, DRAG);
+    drain_epoll(epoll_fd);
+
+    printf("epoll: %d presses, %d clicks in %d reads of %d events, %d read() with no input, latency %u us "
+           "after %d us, drag released at x %d\n",
+           taps_presses, taps_clicks, reads, TAPS * (2 * MOVES + 6), idle_reads, latency, WAIT_US,
+           (int)released_at.x);
+    const bool ok = taps_presses == TAPS && taps_clicks == TAPS && reads <= 2 * TAPS && idle_reads == 0 &&
+                    latency >= WAIT_US && released_at.x == 20 + DRAG;
+    delete_indev(indev);
+    close(epoll_fd);
+    return ok;
+}
+
+static bool check_timer() {
+    lv_indev_t* indev = create_indev();
+    for (int t = 0; t < TAPS; t++) {
+        write_touch(100, MOVES);
+    }
+    read_calls = 0;
+    for (int i = 0; i < 100; i++) {
+        tick_ms += 5;
+        lv_timer_handler();
+    }
+    printf("timer: %d presses, %d clicks, %d read()\n", presses, clicks, read_calls);
+    const bool ok = presses == TAPS && clicks == TAPS;
+    delete_indev(indev);
+    return ok;
+}
+
+int main() {
+    lv_init();
+    lv_tick_set_cb(tick_cb);
+    lv_display_t* disp = lv_display_create(240, 240);
+    lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    lv_obj_t* button = lv_button_create(lv_screen_active());
+    lv_obj_set_size(button, 240, 240);
+    lv_obj_add_event_cb(button, button_cb, LV_EVENT_PRESSED, NULL);
+    lv_obj_add_event_cb(button, button_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(button, button_cb, LV_EVENT_RELEASED, NULL);
+    lv_timer_handler();
+
+    bool ok = check_epoll();
+    ok &= check_timer();
+    lv_deinit();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,194 @@
+// Roda o driver de fbdev do LVGL num framebuffer falso: um arquivo em .host/fbdev_fb no lugar do
+// dispositivo, com os ioctl interceptados pelo ligador (--wrap) como faria um driver de 800x480 em 32 bits
+// com linhas de 3328 bytes, que deixa mudar a resolução virtual e rolar a tela. Roda em dois programas:
+//   fbdev       copia cada área renderizada para o framebuffer (LV_LINUX_FBDEV_PAGE_FLIP 0, o da
+//               configuração os), em modo direto com dois buffers
+//   fbdev_flip  renderiza direto nas duas metades do framebuffer e troca entre elas rolando a tela (com
+//               fbdev_flip.c)
+//
+// Move seis objetos por 200 quadros e mostra o tempo por quadro e quanto o lv_memcpy copiou por quadro,
+// somando a cópia do driver e a sincronização dos dois buffers. Falha se o driver não usar o modo pedido
+// (o argumento flip pede as duas metades) ou se não mostrar a metade que acabou de renderizar. O make run
+// confere que os dois programas mostram os mesmos quadros.
+//
+// Compilar e rodar:
+//   make -C test/host run-fbdev run-fbdev_flip
+// Só compilar: make -C test/host, os programas ficam em .host/fbdev e .host/fbdev_flip.
+
+#include <lvgl.h>
+#include <src/display/lv_display_private.h>
+#include <fcntl.h>
+#include <linux/fb.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#define FB_PATH     ".host/fbdev_fb"
+#define HOR_RES     800
+#define VER_RES     480
+#define LINE_LENGTH 3328
+#define OBJS        6
+#define FRAMES      200
+
+static int fb_fd = -1;
+static fb_var_screeninfo vinfo;
+static fb_fix_screeninfo finfo;
+static uint32_t pans;
+static size_t copied;
+
+extern "C" int __real_ioctl(int fd, unsigned long request, ...);
+
+// O driver do framebuffer: guarda a resolução virtual pedida, aumentando o arquivo, e o deslocamento
+// da rolagem
+extern "C" int __wrap_ioctl(int fd, unsigned long request, ...) {
+    va_list args;
+    va_start(args, request);
+    void* arg = va_arg(args, void*);
+    va_end(args);
+    if (fd != fb_fd) {
+        return __real_ioctl(fd, request, arg);
+    }
+
+    switch (request) {
+        case FBIOGET_VSCREENINFO:
+            *static_cast<fb_var_screeninfo*>(arg) = vinfo;
+            return 0;
+        case FBIOGET_FSCREENINFO:
+            *static_cast<fb_fix_screeninfo*>(arg) = finfo;
+            return 0;
+        case FBIOPUT_VSCREENINFO: {
+            const fb_var_screeninfo* v = static_cast<const fb_var_screeninfo*>(arg);
+            vinfo.yres_virtual = LV_MAX(v->yres_virtual, vinfo.yres);
+            vinfo.yoffset = v->yoffset;
+            finfo.smem_len = LINE_LENGTH * vinfo.yres_virtual;
+            return ftruncate(fd, finfo.smem_len);
+        }
+        case FBIOPAN_DISPLAY: {
+            const fb_var_screeninfo* v = static_cast<const fb_var_screeninfo*>(arg);
+            if (v->yoffset + vinfo.yres > vinfo.yres_virtual) {
+                return -1;
+            }
+            vinfo.yoffset = v->yoffset;
+            pans++;
+            return 0;
+        }
+        case FBIOBLANK:
+        case FBIO_WAITFORVSYNC:
+            return 0;
+        default:
+            return -1;
+    }
+}
+
+extern "C" void* __real_lv_memcpy(void* dst, const void* src, size_t len);
+
+extern "C" void* __wrap_lv_memcpy(void* dst, const void* src, size_t len) {
+    copied += len;
+    return __real_lv_memcpy(dst, src, len);
+}
+
+// Abre o arquivo antes do driver para saber qual descritor será o dele
+static bool create_fb() {
+    vinfo.xres = HOR_RES;
+    vinfo.yres = VER_RES;
+    vinfo.xres_virtual = HOR_RES;
+    vinfo.yres_virtual = VER_RES;
+    vinfo.bits_per_pixel = 32;
+    finfo.line_length = LINE_LENGTH;
+    finfo.ypanstep = 1;
+    finfo.smem_len = LINE_LENGTH * VER_RES;
+
+    const int fd = open(FB_PATH, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0 || ftruncate(fd, finfo.smem_len) != 0) {
+        return false;
+    }
+    close(fd);
+    fb_fd = fd;
+    return true;
+}
+
+static double now() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// Hash da parte visível do framebuffer, sem o resto das linhas
+static uint32_t visible_hash(uint32_t hash) {
+    const uint8_t* fb = static_cast<const uint8_t*>(
+        mmap(NULL, finfo.smem_len, PROT_READ, MAP_SHARED, fb_fd, 0));
+    const uint8_t* row = fb + vinfo.yoffset * LINE_LENGTH;
+    for (uint32_t y = 0; y < VER_RES; y++, row += LINE_LENGTH) {
+        for (uint32_t i = 0; i < HOR_RES * 4; i++) {
+            hash = (hash ^ row[i]) * 16777619u;
+        }
+    }
+    munmap(const_cast<uint8_t*>(fb), finfo.smem_len);
+    return hash;
+}
+
+static void move(lv_obj_t** objs, int frame) {
+    for (int i = 0; i < OBJS; i++) {
+        lv_obj_set_pos(objs[i], (frame * 7 + i * 90) % 600, (frame * 3 + i * 60) % 360);
+    }
+}
+
+int main(int argc, char** argv) {
+    const bool expect_flip = argc > 1 && strcmp(argv[1], "flip") == 0;
+    lv_init();
+    if (!create_fb()) {
+        printf("can't create " FB_PATH "\n");
+        return 1;
+    }
+    lv_display_t* disp = lv_linux_fbdev_create();
+    lv_linux_fbdev_set_file(disp, FB_PATH);
+    const bool flip = vinfo.yres_virtual == 2 * VER_RES;
+
+    lv_obj_t* objs[OBJS];
+    for (int i = 0; i < OBJS; i++) {
+        objs[i] = lv_obj_create(lv_screen_active());
+        lv_obj_set_size(objs[i], 200, 120);
+    }
+    lv_refr_now(disp);
+
+    // Cada quadro tem que aparecer inteiro na metade que está à mostra
+    bool ok = disp->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT && flip == expect_flip;
+    uint32_t hash = 2166136261u;
+    for (int f = 0; f < FRAMES; f++) {
+        move(objs, f);
+        const uint32_t pans_before = pans;
+        lv_refr_now(disp);
+        if (flip) {
+            // O próximo quadro vai para a metade escondida
+            const uint8_t* base = LV_MIN(disp->buf_1->data, disp->buf_2->data);
+            const size_t next = lv_display_get_buf_active(disp)->data - base;
+            ok &= pans == pans_before + 1 && next != vinfo.yoffset * LINE_LENGTH;
+        }
+        hash = visible_hash(hash);
+    }
+
+    double best = 1e9;
+    size_t copied_per_frame = 0;
+    for (int r = 0; r < 5; r++) {
+        copied = 0;
+        const double start = now();
+        for (int f = 0; f < FRAMES; f++) {
+            move(objs, f);
+            lv_refr_now(disp);
+        }
+        best = LV_MIN(best, now() - start);
+        copied_per_frame = copied / FRAMES;
+    }
+
+    printf("%s: %.0f us/frame, lv_memcpy %zu kB/frame, %u pans\n", flip ? "render into the framebuffer" :
+           "copy to the framebuffer", best * 1e6 / FRAMES, copied_per_frame / 1024, pans);
+    if (!ok) {
+        printf("the driver didn't render in the expected mode or didn't show the last frame\n");
+    }
+    printf("frames hash 0x%08x\n", hash);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,6 @@
+// O driver de fbdev com LV_LINUX_FBDEV_PAGE_FLIP, para o fbdev_flip. Os símbolos do lv_linux_fbdev.c
+// já estão aqui, então o ligador não puxa os da liblvgl.a.
+
+#define LV_LINUX_FBDEV_PAGE_FLIP 1
+
+#include "../../lib/lvgl/src/drivers/display/fb/lv_linux_fbdev.c"
@@ -0,0 +1,156 @@
+// Mede quantos bytes o FrameDiff envia ao painel por quadro na Screen1, contra o que o LVGL entrega
+// para enviar, com o painel simulado numa imagem em memória. Cada caso roda 100 quadros com janelas
+// de 0, 64 e 256 bytes de custo:
+//   pot steps  o potenciômetro indo e voltando entre 57% e 58%, com o label de FPS
+//   sweep      o potenciômetro de 0% a 99%, com o label de FPS
+//   fps label  só o label de FPS
+// Mostra os bytes de pixels e os de configuração das janelas (o custo de cada uma) por quadro.
+//
+// Antes confere o começo do FrameDiff: um quadro que nunca chegou ao painel, com o painel cheio de
+// lixo, e begin() com uma área parcial como primeiro quadro e depois a tela inteira.
+// Falha se a imagem do painel não for igual à de um flush simples depois de cada caso.
+//
+// Compilar e rodar:
+//   make -C test/host run-frame_diff
+// Só compilar: make -C test/host, o programa fica em .host/frame_diff.
+
+#include <lvgl.h>
+#include <ui/ui.h>
+#include <stdio.h>
+#include <string.h>
+#include "frame_diff.h"
+
+#define HOR_RES 240
+#define VER_RES 240
+#define FRAMES  100
+
+static uint16_t panel[HOR_RES * VER_RES];
+static uint16_t ref_panel[HOR_RES * VER_RES];
+alignas(4) static lv_color_t draw_buf[HOR_RES * VER_RES / 4];
+
+static uint32_t tick_ms;
+static FrameDiff* frame_diff;
+
+static uint32_t tick_cb() {
+    return tick_ms;
+}
+
+// O painel: copia a janela para a imagem
+static void send_cb(lv_display_t* disp, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* px,
+                    int32_t stride) {
+    for (int32_t r = 0; r < h; r++) {
+        memcpy(&panel[(y + r) * HOR_RES + x], px + r * stride, w * 2);
+    }
+    if (disp != NULL) {
+        lv_display_flush_ready(disp);
+    }
+}
+
+// A referência recebe todas as áreas, o painel só as que passam pelo FrameDiff
+static void flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    const int32_t w = lv_area_get_width(area);
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&ref_panel[y * HOR_RES + area->x1], px_map + (y - area->y1) * w * 2, w * 2);
+    }
+    if (frame_diff != NULL) {
+        frame_diff->flush(disp, area, px_map);
+    } else {
+        lv_display_flush_ready(disp);
+    }
+}
+
+static int wrong_pixels() {
+    int wrong = 0;
+    for (int i = 0; i < HOR_RES * VER_RES; i++) {
+        wrong += panel[i] != ref_panel[i];
+    }
+    return wrong;
+}
+
+static void set_pot(int value) {
+    lv_arc_set_value(ui_Arc1, value);
+    lv_label_set_text_fmt(ui_Label1, "%d%%", value);
+}
+
+static void set_fps(int frame) {
+    lv_label_set_text_fmt(ui_Label2, "FPS: %d.%d", 30 + frame % 3, frame % 10);
+}
+
+static void frame(lv_display_t* disp) {
+    tick_ms += 16;
+    lv_timer_handler();
+    lv_refr_now(disp);
+}
+
+// Painel com lixo, o FrameDiff começando depois de um quadro que não foi enviado e com uma área parcial
+static bool check_begin(lv_display_t* disp) {
+    for (int i = 0; i < HOR_RES * VER_RES; i++) {
+        panel[i] = 0x1234;
+    }
+    lv_refr_now(disp);
+
+    FrameDiff diff(HOR_RES, VER_RES, send_cb);
+    diff.begin();
+    frame_diff = &diff;
+    set_fps(1);
+    frame(disp);
+    lv_obj_invalidate(lv_screen_active());
+    frame(disp);
+    frame_diff = NULL;
+
+    const int wrong = wrong_pixels();
+    printf("begin after an unsent frame, partial first frame: %d pixels differ\n", wrong);
+    return wrong == 0;
+}
+
+static bool run(lv_display_t* disp, const char* name, int scenario, uint32_t window_cost) {
+    FrameDiff diff(HOR_RES, VER_RES, send_cb, window_cost);
+    diff.begin();
+    frame_diff = &diff;
+    set_pot(0);
+    lv_obj_invalidate(lv_screen_active());
+    frame(disp);
+    diff.resetStats();
+
+    for (int f = 0; f < FRAMES; f++) {
+        if (scenario == 0) {
+            set_pot(57 + f % 2);
+        } else if (scenario == 1) {
+            set_pot(f);
+        }
+        set_fps(f);
+        frame(disp);
+    }
+    frame_diff = NULL;
+
+    const FrameDiffStats& s = diff.getStats();
+    const int wrong = wrong_pixels();
+    printf("%-9s cost %3u: flushed %6llu B/frame, sent %6llu B + %4llu B setup/frame, %.2f windows/frame, "
+           "%d pixels differ\n",
+           name, (unsigned)window_cost, (unsigned long long)(s.flushed_bytes / FRAMES),
+           (unsigned long long)(s.sent_bytes / FRAMES), (unsigned long long)(s.setup_bytes / FRAMES),
+           s.windows / (double)FRAMES, wrong);
+    return wrong == 0;
+}
+
+int main() {
+    lv_init();
+    lv_tick_set_cb(tick_cb);
+    lv_display_t* disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    ui_init();
+
+    bool ok = check_begin(disp);
+
+    static const char* const names[] = {"pot steps", "sweep", "fps label"};
+    static const uint32_t costs[] = {0, 64, 256};
+    for (int scenario = 0; scenario < 3; scenario++) {
+        for (uint32_t cost : costs) {
+            ok &= run(disp, names[scenario], scenario, cost);
+        }
+    }
+
+    lv_deinit();
+    return ok ? 0 : 1;
+}
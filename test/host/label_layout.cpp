@@ -0,0 +1,187 @@
+// Desenha telas cheias de rótulos com o cache de layout de texto ligado e desligado, confere que os
+// quadros saem iguais e mostra o tempo por quadro.
+//
+// Cenas:
+//   grid    24 rótulos quebrando linha, alinhados à esquerda, ao centro e à direita, trocando a cada
+//           quadro entre 8 textos já vistos
+//   scroll  um rótulo de 40 linhas centralizado, rolado aos poucos, e um rótulo com rolagem circular
+// Também confere que lv_text_get_size dá o mesmo tamanho com e sem o cache.
+//
+// Compilar e rodar:
+//   make -C test/host run-label_layout
+// Só compilar: make -C test/host, o programa fica em .host/label_layout.
+
+#include <lvgl.h>
+#include <stdio.h>
+#include <time.h>
+
+#define HOR_RES       320
+#define VER_RES       240
+#define LABELS        24
+#define FRAMES        300
+#define CACHE_LAYOUTS 16
+
+static const char* texts[] = {
+    "Hello world",
+    "The quick brown fox jumps over the lazy dog again and again",
+    "12%",
+    "Temperature: 23.5 C\nHumidity: 40%",
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore",
+    "OK",
+    "Cancel",
+    "Settings\n\nWiFi\nBluetooth\nDisplay\n",
+};
+
+static uint16_t draw_buf[HOR_RES * 40];
+static uint32_t tick_ms;
+static uint32_t hash;
+static char long_text[400];
+
+struct Result {
+    uint32_t hash;
+    double us_per_frame;
+};
+
+static uint32_t tick_cb() {
+    return tick_ms;
+}
+
+static void flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    const int32_t size = lv_area_get_size(area) * 2;
+    for (int32_t i = 0; i < size; i++) {
+        hash = (hash ^ px_map[i]) * 16777619u;
+    }
+    lv_display_flush_ready(disp);
+}
+
+static double now() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static lv_obj_t* new_screen() {
+    lv_obj_t* screen = lv_obj_create(NULL);
+    lv_screen_load(screen);
+    return screen;
+}
+
+static Result grid() {
+    lv_obj_t* screen = new_screen();
+    lv_obj_set_flex_flow(screen, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_t* labels[LABELS];
+    for (int i = 0; i < LABELS; i++) {
+        labels[i] = lv_label_create(screen);
+        lv_obj_set_width(labels[i], 60 + (i % 4) * 20);
+        const lv_text_align_t align = i % 3 == 0 ? LV_TEXT_ALIGN_CENTER
+                                      : i % 3 == 1 ? LV_TEXT_ALIGN_RIGHT
+                                                   : LV_TEXT_ALIGN_LEFT;
+        lv_obj_set_style_text_align(labels[i], align, 0);
+        lv_label_set_text(labels[i], texts[i % 8]);
+    }
+    lv_obj_scroll_to_y(screen, 37, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+
+    hash = 2166136261u;
+    const double start = now();
+    for (int f = 0; f < FRAMES; f++) {
+        for (int i = 0; i < LABELS; i++) {
+            lv_label_set_text(labels[i], texts[(i + f) % 8]);
+        }
+        lv_refr_now(NULL);
+    }
+    const Result res = {hash, (now() - start) * 1e6 / FRAMES};
+    lv_obj_delete(screen);
+    return res;
+}
+
+static Result scroll() {
+    lv_obj_t* screen = new_screen();
+    lv_obj_t* label = lv_label_create(screen);
+    lv_label_set_text(label, long_text);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_set_style_text_line_space(label, 3, 0);
+    lv_obj_set_width(label, 200);
+
+    lv_obj_t* circular = lv_label_create(screen);
+    lv_label_set_long_mode(circular, LV_LABEL_LONG_SCROLL_CIRCULAR);
+    lv_obj_set_width(circular, 100);
+    lv_obj_set_y(circular, 500);
+    lv_label_set_text(circular, "scrolling circular text that is long");
+
+    hash = 2166136261u;
+    int frames = 0;
+    const double start = now();
+    for (int y = 0; y < 600; y += 7) {
+        lv_obj_scroll_to_y(screen, y, LV_ANIM_OFF);
+        tick_ms += 50;
+        lv_refr_now(NULL);
+        frames++;
+    }
+    const Result res = {hash, (now() - start) * 1e6 / frames};
+    lv_obj_delete(screen);
+    return res;
+}
+
+static void set_cache(bool on) {
+    lv_text_layout_cache_drop_all();
+    lv_text_layout_cache_resize(on ? CACHE_LAYOUTS : 0, true);
+}
+
+static bool compare(const char* name, Result (*scene)()) {
+    set_cache(false);
+    const Result off = scene();
+    set_cache(true);
+    const Result on = scene();
+    const bool same = off.hash == on.hash;
+    printf("%-8s %7.1f us -> %7.1f us per frame with the cache, %s\n", name, off.us_per_frame, on.us_per_frame,
+           same ? "same frames" : "FRAMES DIFFER");
+    return same;
+}
+
+static bool check_sizes() {
+    static const int32_t widths[] = {40, 100, 200, LV_COORD_MAX};
+    int wrong = 0;
+    for (const char* text : texts) {
+        for (int32_t width : widths) {
+            lv_point_t off;
+            lv_point_t on;
+            set_cache(false);
+            lv_text_get_size(&off, text, LV_FONT_DEFAULT, 1, 3, width, LV_TEXT_FLAG_NONE);
+            set_cache(true);
+            lv_text_get_size(&on, text, LV_FONT_DEFAULT, 1, 3, width, LV_TEXT_FLAG_NONE);
+            lv_text_get_size(&on, text, LV_FONT_DEFAULT, 1, 3, width, LV_TEXT_FLAG_NONE);
+            if (off.x != on.x || off.y != on.y) {
+                if (wrong++ < 5) {
+                    printf("  \"%.20s\" in %d px: %dx%d with the cache, %dx%d without\n", text, width, on.x, on.y,
+                           off.x, off.y);
+                }
+            }
+        }
+    }
+    printf("lv_text_get_size: %s\n", wrong ? "DIFFERENT" : "same sizes");
+    return wrong == 0;
+}
+
+int main() {
+    lv_init();
+    lv_tick_set_cb(tick_cb);
+    if (!lv_text_layout_cache_is_enabled()) {
+        printf("LV_TEXT_LAYOUT_CACHE_CNT is 0\n");
+        return 1;
+    }
+
+    lv_display_t* disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    char* p = long_text;
+    for (int i = 0; i < 40; i++) {
+        p += sprintf(p, "line %d\n", i);
+    }
+
+    bool ok = check_sizes();
+    ok &= compare("grid", grid);
+    ok &= compare("scroll", scroll);
+    return ok ? 0 : 1;
+}
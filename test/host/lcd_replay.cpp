@@ -0,0 +1,141 @@
+// Reproduz no PC o caminho do painel com o MockLcdBus, sem Arduino: a Screen1 com a varredura do
+// potenciômetro e o label de FPS por 100 quadros. Mostra as transações por quadro e um hash da memória
+// do painel, que deve ser igual ao do modo "ref" (flush_cb simples, sem o driver).
+//
+// Modos: ref, cmd (driver sem o callback de lote), batch (janela e pixels numa transação), async (lote com
+// dois buffers e o fim do flush pelo tempo estimado do barramento) e diff e diff-async (os mesmos com o
+// FrameDiff enviando as janelas alteradas pelo barramento).
+//
+// Compilar e rodar todos os modos, comparando o hash de cada um com o do "ref":
+//   make -C test/host run-lcd_replay
+// Só compilar: make -C test/host, o programa fica em .host/lcd_replay.
+
+#include <lvgl.h>
+#include <ui/ui.h>
+#include <src/drivers/display/gc9a01/lv_gc9a01.h>
+#include <stdio.h>
+#include <string.h>
+#include <iterator>
+#include "frame_diff.h"
+#include "mock_lcd_bus.h"
+
+#define HOR_RES 240
+#define VER_RES 240
+#define FRAMES  100
+
+static uint16_t ref_panel[HOR_RES * VER_RES];
+alignas(4) static lv_color_t draw_buf[HOR_RES * VER_RES / 4];
+
+static uint32_t tick_ms;
+static uint64_t bus_us;
+static MockLcdBus* mock_bus;
+static FrameDiff frame_diff(HOR_RES, VER_RES, LcdBus::sendWindowCb);
+
+static uint32_t tick_cb() {
+    return tick_ms;
+}
+
+static void delay_cb(uint32_t ms) {
+    LV_UNUSED(ms);
+}
+
+static uint64_t clock_cb() {
+    return bus_us;
+}
+
+// O tempo passa enquanto o LVGL espera o barramento
+static void flush_wait_cb(lv_display_t* disp) {
+    LV_UNUSED(disp);
+    bus_us++;
+    mock_bus->poll();
+}
+
+// Referência: copia as áreas direto para a imagem do painel
+static void ref_flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    const int32_t w = lv_area_get_width(area);
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&ref_panel[y * HOR_RES + area->x1], px_map + (y - area->y1) * w * 2, w * 2);
+    }
+    lv_display_flush_ready(disp);
+}
+
+static void diff_flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    frame_diff.flush(disp, area, px_map);
+}
+
+// FNV-1a dos pixels RGB565
+static uint32_t panel_hash(const uint16_t* panel) {
+    uint32_t hash = 2166136261u;
+    for (int32_t i = 0; i < HOR_RES * VER_RES; i++) {
+        hash = (hash ^ (panel[i] & 0xff)) * 16777619u;
+        hash = (hash ^ (panel[i] >> 8)) * 16777619u;
+    }
+    return hash;
+}
+
+int main(int argc, char** argv) {
+    const char* mode = argc > 1 ? argv[1] : "ref";
+    const bool ref = strcmp(mode, "ref") == 0;
+
+    lv_init();
+    lv_tick_set_cb(tick_cb);
+    lv_delay_set_cb(delay_cb);
+
+    MockLcdBus bus(HOR_RES, VER_RES);
+    mock_bus = &bus;
+
+    lv_display_t* disp;
+    if (ref) {
+        disp = lv_display_create(HOR_RES, VER_RES);
+        lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+        lv_display_set_flush_cb(disp, ref_flush_cb);
+    } else {
+        LcdBus::attach(&bus);
+        disp = lv_gc9a01_create(HOR_RES, VER_RES, LV_LCD_FLAG_NONE, LcdBus::sendCmdCb, LcdBus::sendColorCb);
+        if (strcmp(mode, "cmd") != 0) {
+            lv_lcd_generic_mipi_set_send_batch_cb(disp, LcdBus::sendBatchCb);
+        }
+        const bool diff = strncmp(mode, "diff", 4) == 0;
+        if (strcmp(mode, "async") == 0 || strcmp(mode, "diff-async") == 0) {
+            bus.setClock(clock_cb);
+            lv_display_set_flush_wait_cb(disp, flush_wait_cb);
+            lv_display_set_buffers(disp, draw_buf, draw_buf + std::size(draw_buf) / 2, sizeof(draw_buf) / 2,
+                                   LV_DISPLAY_RENDER_MODE_PARTIAL);
+        } else {
+            lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+        }
+        if (diff) {
+            frame_diff.begin();
+            lv_display_set_flush_cb(disp, diff_flush_cb);
+        }
+    }
+
+    ui_init();
+    lv_refr_now(disp);
+    bus.resetStats();
+    bus.clearLog();
+
+    for (int f = 0; f < FRAMES; f++) {
+        tick_ms += 16;
+        lv_arc_set_value(ui_Arc1, f);
+        lv_label_set_text_fmt(ui_Label1, "%d%%", f);
+        lv_label_set_text_fmt(ui_Label2, "FPS: %d.%d", 30 + f % 3, f % 10);
+        lv_timer_handler();
+        lv_refr_now(disp);
+    }
+
+    // Deixa a última transferência assíncrona terminar
+    bus_us += 100000;
+    bus.poll();
+
+    printf("%s: panel hash 0x%08x", mode, (unsigned)panel_hash(ref ? ref_panel : bus.getPanel()));
+    if (!ref) {
+        const LcdBusStats& s = bus.getStats();
+        printf(", %.2f transactions/frame, %.2f commands/frame, %llu px bytes/frame, bus %.1f us/frame",
+               s.transactions / (double)FRAMES, s.commands / (double)FRAMES,
+               (unsigned long long)(s.px_bytes / FRAMES), s.busy_us / (double)FRAMES);
+    }
+    printf("\n");
+
+    return 0;
+}
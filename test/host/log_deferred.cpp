@@ -0,0 +1,144 @@
+// Várias threads gravam logs adiados ao mesmo tempo enquanto a principal os drena. Cada thread grava
+// registros numerados e o programa lê os bytes drenados registro por registro: falha se um registro
+// estiver corrompido, se os de uma thread saírem fora de ordem ou se gravados + descartados não derem o
+// total. lv_memcpy é interceptado pelo ligador (--wrap) e cede a CPU no meio da cópia de cada registro,
+// para que uma thread reserve e escreva enquanto a outra ainda não terminou. Mostra também o tempo de um
+// log com uma thread só.
+//
+// Compilar e rodar:
+//   make -C test/host run-log_deferred
+// Só compilar: make -C test/host, o programa fica em .host/log_deferred.
+
+#include <lvgl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define THREADS    4
+#define RECORDS    20000
+#define HEADER     (12 + 3 * sizeof(void*))
+#define BENCH_LOGS 200000
+
+static const char record_fmt[] = "thread %d record %d";
+
+static uint8_t sink[THREADS * RECORDS * 64];
+static uint32_t sink_len;
+static int running;
+static bool yield_in_copy;
+
+extern "C" void* __real_lv_memcpy(void* dst, const void* src, size_t len);
+
+extern "C" void* __wrap_lv_memcpy(void* dst, const void* src, size_t len) {
+    void* res = __real_lv_memcpy(dst, src, len);
+    if (yield_in_copy && len > 8) {
+        sched_yield();
+    }
+    return res;
+}
+
+static uint32_t write_cb(const void* data, uint32_t size) {
+    size = LV_MIN(size, (uint32_t)sizeof(sink) - sink_len);
+    memcpy(&sink[sink_len], data, size);
+    sink_len += size;
+    return size;
+}
+
+static uint32_t discard_cb(const void* data, uint32_t size) {
+    LV_UNUSED(data);
+    return size;
+}
+
+static void* worker(void* arg) {
+    const int id = (int)(intptr_t)arg;
+    for (int i = 0; i < RECORDS; i++) {
+        LV_LOG_WARN(record_fmt, id, i);
+    }
+    __atomic_fetch_sub(&running, 1, __ATOMIC_SEQ_CST);
+    return NULL;
+}
+
+static double now() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static bool check_records() {
+    uint32_t records = 0;
+    uint32_t others = 0;
+    uint32_t out_of_order = 0;
+    int last[THREADS];
+    memset(last, -1, sizeof(last));
+
+    uint32_t pos = 0;
+    while (pos + HEADER <= sink_len) {
+        if (sink[pos] != 0xA0 + sizeof(void*)) {
+            printf("corrupt record at byte %u\n", pos);
+            return false;
+        }
+        const uint32_t args_size = sink[pos + 2];
+        const char* fmt;
+        memcpy(&fmt, &sink[pos + 12], sizeof(fmt));
+        if (fmt == record_fmt) {
+            int32_t id;
+            int32_t n;
+            memcpy(&id, &sink[pos + HEADER], sizeof(id));
+            memcpy(&n, &sink[pos + HEADER + 4], sizeof(n));
+            if (args_size != 8 || id < 0 || id >= THREADS || n < 0 || n >= RECORDS) {
+                printf("corrupt arguments at byte %u\n", pos);
+                return false;
+            }
+            out_of_order += n <= last[id];
+            last[id] = n;
+            records++;
+        } else {
+            others++;
+        }
+        pos += HEADER + args_size;
+    }
+
+    const uint32_t dropped = lv_log_deferred_get_dropped_count();
+    printf("%d threads: %u records + %u dropped of %u, %u out of order, %u other records\n", THREADS, records,
+           dropped, THREADS * RECORDS, out_of_order, others);
+    return pos == sink_len && out_of_order == 0 && records + dropped == THREADS * RECORDS;
+}
+
+int main() {
+    lv_init();
+
+    // Tempo de um log sem disputa, drenando quando o buffer enche
+    const double start = now();
+    for (int i = 0; i < BENCH_LOGS; i++) {
+        LV_LOG_WARN(record_fmt, 0, i);
+        if (i % 32 == 0) {
+            lv_log_deferred_drain(discard_cb);
+        }
+    }
+    printf("1 thread: %.0f ns/log\n", (now() - start) * 1e9 / BENCH_LOGS);
+    lv_log_deferred_drain(discard_cb);
+    const uint32_t bench_dropped = lv_log_deferred_get_dropped_count();
+
+    yield_in_copy = true;
+    running = THREADS;
+    pthread_t threads[THREADS];
+    for (int i = 0; i < THREADS; i++) {
+        pthread_create(&threads[i], NULL, worker, (void*)(intptr_t)i);
+    }
+    while (__atomic_load_n(&running, __ATOMIC_SEQ_CST) > 0) {
+        lv_log_deferred_drain(write_cb);
+        sched_yield();
+    }
+    for (int i = 0; i < THREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    lv_log_deferred_drain(write_cb);
+    yield_in_copy = false;
+
+    if (bench_dropped != 0) {
+        printf("%u records dropped without contention\n", bench_dropped);
+        return 1;
+    }
+    return check_records() ? 0 : 1;
+}
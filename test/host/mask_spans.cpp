@@ -0,0 +1,223 @@
+// Compara as duas formas de aplicar as máscaras do desenho por software numa linha:
+// lv_draw_sw_mask_apply escreve a opacidade de todos os pixels e lv_draw_sw_mask_apply_spans divide a
+// linha em partes transparentes, cobertas e parciais e só calcula os pixels das parciais.
+//
+// Primeiro confere, pixel por pixel, que as duas dão a mesma cobertura com combinações aleatórias de
+// máscaras de raio, ângulo, linha, fade e mapa, em várias posições e larguras da linha. Depois mede o
+// tempo das duas com as máscaras de um arco, de uma borda arredondada e de um triângulo.
+//
+// Compilar e rodar:
+//   make -C test/host run-mask_spans
+// Só compilar: make -C test/host, o programa fica em .host/mask_spans.
+
+#include <lvgl.h>
+#include <src/draw/sw/lv_draw_sw_mask_private.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define AREA     400
+#define CASES    300
+#define MASKS    3
+#define ROUNDS   200
+
+union MaskParam {
+    lv_draw_sw_mask_line_param_t line;
+    lv_draw_sw_mask_angle_param_t angle;
+    lv_draw_sw_mask_radius_param_t radius;
+    lv_draw_sw_mask_fade_param_t fade;
+    lv_draw_sw_mask_map_param_t map;
+};
+
+static uint32_t seed = 1;
+static lv_opa_t map[AREA * AREA];
+
+static int32_t rnd(int32_t max) {
+    seed = seed * 1103515245u + 12345u;
+    return (seed >> 8) % max;
+}
+
+static void init_random_mask(MaskParam* p) {
+    switch (rnd(5)) {
+        case 0: {
+            lv_area_t rect = {rnd(AREA), rnd(AREA), 0, 0};
+            rect.x2 = rect.x1 + rnd(AREA);
+            rect.y2 = rect.y1 + rnd(AREA);
+            const int32_t short_side = LV_MIN(lv_area_get_width(&rect), lv_area_get_height(&rect));
+            lv_draw_sw_mask_radius_init(&p->radius, &rect, rnd(short_side / 2 + 1), rnd(2));
+            break;
+        }
+        case 1:
+            lv_draw_sw_mask_angle_init(&p->angle, rnd(AREA), rnd(AREA), rnd(360), rnd(360));
+            break;
+        case 2:
+            lv_draw_sw_mask_line_points_init(&p->line, rnd(AREA), rnd(AREA), rnd(AREA), rnd(AREA),
+                                             (lv_draw_sw_mask_line_side_t)rnd(4));
+            break;
+        case 3: {
+            lv_area_t coords = {rnd(AREA), rnd(AREA), 0, 0};
+            coords.x2 = coords.x1 + rnd(AREA);
+            coords.y2 = coords.y1 + rnd(AREA);
+            lv_draw_sw_mask_fade_init(&p->fade, &coords, rnd(256), coords.y1 + rnd(AREA), rnd(256),
+                                      coords.y1 + rnd(AREA));
+            break;
+        }
+        default: {
+            lv_area_t coords = {rnd(AREA / 2), rnd(AREA / 2), 0, 0};
+            coords.x2 = coords.x1 + rnd(AREA / 2);
+            coords.y2 = coords.y1 + rnd(AREA / 2);
+            lv_draw_sw_mask_map_init(&p->map, &coords, map);
+            break;
+        }
+    }
+}
+
+// Cobertura de uma linha pelas máscaras, com cada uma das funções
+static void apply_full(void* masks[], lv_opa_t* buf, int32_t x, int32_t y, int32_t len) {
+    memset(buf, 0xff, len);
+    if (lv_draw_sw_mask_apply(masks, buf, x, y, len) == LV_DRAW_SW_MASK_RES_TRANSP) {
+        memset(buf, 0, len);
+    }
+}
+
+static bool apply_spans(void* masks[], lv_opa_t* buf, int32_t x, int32_t y, int32_t len) {
+    lv_draw_sw_mask_span_t spans[LV_DRAW_SW_MASK_SPAN_MAX];
+    uint32_t span_cnt;
+    memset(buf, 0xaa, len);
+    lv_draw_sw_mask_apply_spans(masks, buf, x, y, len, spans, &span_cnt);
+    if (span_cnt == 0) {
+        memset(buf, 0, len);
+    }
+
+    int32_t end = 0;
+    for (uint32_t i = 0; i < span_cnt; i++) {
+        if (spans[i].x != end || spans[i].len <= 0) {
+            return false;
+        }
+        if (spans[i].type == LV_DRAW_SW_MASK_SPAN_TRANSP) {
+            memset(&buf[spans[i].x], 0, spans[i].len);
+        } else if (spans[i].type == LV_DRAW_SW_MASK_SPAN_COVER) {
+            memset(&buf[spans[i].x], 0xff, spans[i].len);
+        }
+        end += spans[i].len;
+    }
+    return span_cnt == 0 || end == len;
+}
+
+static bool check() {
+    static const int32_t windows[][2] = {{0, AREA}, {-17, AREA + 40}, {123, 50}, {190, 20}, {37, 1}, {301, 99}};
+    static lv_opa_t full[AREA + 40];
+    static lv_opa_t spans[AREA + 40];
+
+    int wrong = 0;
+    for (int c = 0; c < CASES; c++) {
+        MaskParam params[MASKS];
+        void* masks[MASKS + 1] = {};
+        const int mask_cnt = 1 + rnd(MASKS);
+        for (int m = 0; m < mask_cnt; m++) {
+            init_random_mask(&params[m]);
+            masks[m] = &params[m];
+        }
+
+        for (const auto& w : windows) {
+            for (int32_t y = -5; y < AREA + 5; y++) {
+                apply_full(masks, full, w[0], y, w[1]);
+                const bool spans_ok = apply_spans(masks, spans, w[0], y, w[1]);
+                if (!spans_ok || memcmp(full, spans, w[1]) != 0) {
+                    if (wrong++ < 5) {
+                        int32_t x = 0;
+                        while (x < w[1] && full[x] == spans[x]) x++;
+                        printf("case %d, line %d from %d: %s, x %d: %u instead of %u\n", c, y, w[0],
+                               spans_ok ? "pixel differs" : "bad spans", x, spans[x], full[x]);
+                    }
+                }
+            }
+        }
+
+        for (int m = 0; m < mask_cnt; m++) {
+            lv_draw_sw_mask_free_param(&params[m]);
+        }
+    }
+
+    printf("%d random mask sets: %s\n", CASES, wrong ? "DIFFERENT" : "same coverage");
+    return wrong == 0;
+}
+
+static double now() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static double time_lines(void* masks[], bool spans) {
+    static lv_opa_t buf[AREA];
+    lv_draw_sw_mask_span_t span_buf[LV_DRAW_SW_MASK_SPAN_MAX];
+    uint32_t span_cnt;
+    double best = 1e9;
+    for (int r = 0; r < 5; r++) {
+        const double start = now();
+        for (int k = 0; k < ROUNDS; k++) {
+            for (int32_t y = 0; y < AREA; y++) {
+                if (spans) {
+                    lv_draw_sw_mask_apply_spans(masks, buf, 0, y, AREA, span_buf, &span_cnt);
+                } else {
+                    memset(buf, 0xff, AREA);
+                    lv_draw_sw_mask_apply(masks, buf, 0, y, AREA);
+                }
+            }
+        }
+        best = LV_MIN(best, now() - start);
+    }
+    return best * 1e6 / ROUNDS;
+}
+
+static void bench(const char* name, void* masks[]) {
+    const double full = time_lines(masks, false);
+    const double spans = time_lines(masks, true);
+    printf("%-14s %6.1f us -> %6.1f us per %d lines of %d px\n", name, full, spans, AREA, AREA);
+}
+
+int main() {
+    lv_init();
+
+    for (uint32_t i = 0; i < sizeof(map); i++) {
+        map[i] = rnd(256);
+    }
+    bool ok = check();
+
+    // Arco de 40 px de 20° a 250°, como o desenha lv_draw_sw_arc
+    lv_area_t area = {0, 0, AREA - 1, AREA - 1};
+    lv_area_t inner = {40, 40, AREA - 41, AREA - 41};
+    lv_draw_sw_mask_radius_param_t outer_circle;
+    lv_draw_sw_mask_radius_param_t inner_circle;
+    lv_draw_sw_mask_angle_param_t angle;
+    lv_draw_sw_mask_radius_init(&outer_circle, &area, AREA / 2, false);
+    lv_draw_sw_mask_radius_init(&inner_circle, &inner, AREA / 2 - 40, true);
+    lv_draw_sw_mask_angle_init(&angle, AREA / 2, AREA / 2, 20, 250);
+    void* arc[] = {&outer_circle, &inner_circle, &angle, NULL};
+    bench("arc", arc);
+
+    // Borda de 4 px com raio 40
+    lv_draw_sw_mask_radius_param_t outer_rect;
+    lv_draw_sw_mask_radius_param_t inner_rect;
+    lv_area_t border_inner = {4, 4, AREA - 5, AREA - 5};
+    lv_draw_sw_mask_radius_init(&outer_rect, &area, 40, false);
+    lv_draw_sw_mask_radius_init(&inner_rect, &border_inner, 36, true);
+    void* border[] = {&outer_rect, &inner_rect, NULL};
+    bench("rounded border", border);
+
+    lv_draw_sw_mask_line_param_t lines[3];
+    lv_draw_sw_mask_line_points_init(&lines[0], 20, 380, 200, 10, LV_DRAW_SW_MASK_LINE_SIDE_RIGHT);
+    lv_draw_sw_mask_line_points_init(&lines[1], 200, 10, 380, 380, LV_DRAW_SW_MASK_LINE_SIDE_LEFT);
+    lv_draw_sw_mask_line_points_init(&lines[2], 20, 380, 380, 380, LV_DRAW_SW_MASK_LINE_SIDE_TOP);
+    void* triangle[] = {&lines[0], &lines[1], &lines[2], NULL};
+    bench("triangle", triangle);
+
+    lv_draw_sw_mask_free_param(&outer_circle);
+    lv_draw_sw_mask_free_param(&inner_circle);
+    lv_draw_sw_mask_free_param(&angle);
+    lv_draw_sw_mask_free_param(&outer_rect);
+    lv_draw_sw_mask_free_param(&inner_rect);
+    lv_deinit();
+    return ok ? 0 : 1;
+}
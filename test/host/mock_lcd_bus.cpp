@@ -0,0 +1,104 @@
+#include "mock_lcd_bus.h"
+
+#include <new>
+#include <src/drivers/display/lcd/lv_lcd_generic_mipi.h>
+
+// Construtor
+MockLcdBus::MockLcdBus(int32_t width, int32_t height, uint32_t clock_hz, uint32_t setup_ns, uint32_t dc_ns)
+    : width(width), height(height), clock_hz(clock_hz), setup_ns(setup_ns), dc_ns(dc_ns), panel(nullptr),
+      columns{0, 0}, rows{0, 0}, x(0), y(0), now_us(nullptr), elapsed_ns(0), bus_free_us(0), pending_disp(nullptr) {
+    panel = new (std::nothrow) uint16_t[width * height]();
+}
+
+// Destrutor
+MockLcdBus::~MockLcdBus() {
+    delete[] panel;
+}
+
+void MockLcdBus::sendCmd(const uint8_t* cmd, size_t cmd_size, const uint8_t* param, size_t param_size) {
+    execute(cmd[0], param, param_size);
+    record(cmd[0], 1, cmd_size + param_size, 0, param_size > 0 ? 1 : 0);
+}
+
+void MockLcdBus::sendBatch(lv_display_t* disp, const uint8_t* cmd_list, size_t cmd_list_size, const uint8_t* px,
+                           size_t px_size) {
+    uint16_t commands = 0;
+    uint32_t dc_switches = 0;
+    for (size_t i = 0; i + 1 < cmd_list_size; i += 2 + cmd_list[i + 1]) {
+        execute(cmd_list[i], &cmd_list[i + 2], cmd_list[i + 1]);
+        commands++;
+        // Comando e dados alternam: o DC muda antes e depois de cada lista de parâmetros
+        dc_switches += cmd_list[i + 1] > 0 ? 2 : 0;
+    }
+    writePixels(px, px_size);
+    dc_switches += px_size > 0 ? 1 : 0;
+    record(cmd_list[0], commands, cmd_list_size - commands, px_size, dc_switches);
+
+    pending_disp = disp;
+    if (now_us == nullptr) {
+        poll();
+    }
+}
+
+void MockLcdBus::poll() {
+    if (pending_disp != nullptr && (now_us == nullptr || now_us() >= bus_free_us)) {
+        lv_display_t* disp = pending_disp;
+        pending_disp = nullptr;
+        lv_display_flush_ready(disp);
+    }
+}
+
+// Reproduz os comandos de endereçamento da memória do controlador
+void MockLcdBus::execute(uint8_t cmd, const uint8_t* param, size_t size) {
+    if ((cmd == LV_LCD_CMD_SET_COLUMN_ADDRESS || cmd == LV_LCD_CMD_SET_PAGE_ADDRESS) && size == 4) {
+        uint16_t* range = cmd == LV_LCD_CMD_SET_COLUMN_ADDRESS ? columns : rows;
+        range[0] = (param[0] << 8) | param[1];
+        range[1] = (param[2] << 8) | param[3];
+    } else if (cmd == LV_LCD_CMD_WRITE_MEMORY_START) {
+        x = columns[0];
+        y = rows[0];
+    }
+}
+
+// Os pixels chegam com o byte mais significativo primeiro e percorrem a janela linha por linha
+void MockLcdBus::writePixels(const uint8_t* px, size_t size) {
+    for (size_t i = 0; i + 1 < size; i += 2) {
+        if (panel != nullptr && x < width && y < height) {
+            panel[y * width + x] = (px[i] << 8) | px[i + 1];
+        }
+        if (++x > columns[1]) {
+            x = columns[0];
+            if (++y > rows[1]) {
+                y = rows[0];
+            }
+        }
+    }
+}
+
+void MockLcdBus::record(uint8_t first_cmd, uint16_t commands, size_t cmd_bytes, size_t px_bytes,
+                        uint32_t dc_switches) {
+    const uint64_t bits = (uint64_t)(cmd_bytes + px_bytes) * 8;
+    const uint32_t duration_ns = setup_ns + dc_switches * dc_ns + (uint32_t)(bits * 1000000000ULL / clock_hz);
+
+    MockLcdTransaction t;
+    if (now_us != nullptr) {
+        const uint64_t now = now_us();
+        t.start_us = now > bus_free_us ? now : bus_free_us;
+        bus_free_us = t.start_us + (duration_ns + 999) / 1000;
+    } else {
+        t.start_us = elapsed_ns / 1000;
+        elapsed_ns += duration_ns;
+    }
+    t.duration_ns = duration_ns;
+    t.first_cmd = first_cmd;
+    t.commands = commands;
+    t.cmd_bytes = cmd_bytes;
+    t.px_bytes = px_bytes;
+    log.push_back(t);
+
+    stats.transactions++;
+    stats.commands += commands;
+    stats.cmd_bytes += t.cmd_bytes;
+    stats.px_bytes += px_bytes;
+    stats.busy_us += (duration_ns + 500) / 1000;
+}
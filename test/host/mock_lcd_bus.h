@@ -0,0 +1,65 @@
+#ifndef MOCK_LCD_BUS_H
+#define MOCK_LCD_BUS_H
+
+#include <vector>
+#include "lcd_bus.h"
+
+// Uma transação registrada pelo MockLcdBus
+struct MockLcdTransaction {
+    uint64_t start_us;     // Início estimado
+    uint32_t duration_ns;  // Duração estimada no barramento
+    uint8_t first_cmd;     // Primeiro comando da transação
+    uint16_t commands;     // Comandos
+    uint32_t cmd_bytes;    // Bytes de comandos e parâmetros enviados
+    uint32_t px_bytes;     // Bytes de pixels
+};
+
+// Barramento simulado para rodar e medir o driver do painel no PC, sem Arduino. Registra as transações,
+// estima o tempo de cada uma no SPI e reproduz a memória do painel (CASET, RASET e RAMWR, sem MADCTL)
+// para comparar a imagem recebida com a esperada.
+class MockLcdBus : public LcdBus {
+public:
+    // clock_hz: clock do SPI; setup_ns: custo fixo de cada transação (CS, configuração do DMA e da
+    // interrupção); dc_ns: custo de cada troca do pino DC entre comando e dados
+    MockLcdBus(int32_t width, int32_t height, uint32_t clock_hz = 40000000, uint32_t setup_ns = 8000,
+               uint32_t dc_ns = 1000);
+    ~MockLcdBus();
+
+    // Com uma fonte de tempo em us, o flush termina em poll() depois do tempo estimado, como com DMA
+    // (registre um flush_wait_cb no display que chame poll()). Sem ela, termina na hora.
+    void setClock(uint64_t (*now_us)()) { this->now_us = now_us; }
+
+    void sendCmd(const uint8_t* cmd, size_t cmd_size, const uint8_t* param, size_t param_size) override;
+    void sendBatch(lv_display_t* disp, const uint8_t* cmd_list, size_t cmd_list_size, const uint8_t* px,
+                   size_t px_size) override;
+    void poll() override;
+
+    const std::vector<MockLcdTransaction>& getLog() const { return log; }
+    void clearLog() { log.clear(); }
+
+    // Memória do painel em RGB565, linha por linha
+    const uint16_t* getPanel() const { return panel; }
+
+private:
+    int32_t width;
+    int32_t height;
+    uint32_t clock_hz;
+    uint32_t setup_ns;
+    uint32_t dc_ns;
+    uint16_t* panel;
+    uint16_t columns[2];
+    uint16_t rows[2];
+    int32_t x;
+    int32_t y;
+    uint64_t (*now_us)();
+    uint64_t elapsed_ns;   // Tempo total estimado, usado sem fonte de tempo
+    uint64_t bus_free_us;  // Fim da última transação
+    lv_display_t* pending_disp;
+    std::vector<MockLcdTransaction> log;
+
+    void execute(uint8_t cmd, const uint8_t* param, size_t size);
+    void writePixels(const uint8_t* px, size_t size);
+    void record(uint8_t first_cmd, uint16_t commands, size_t cmd_bytes, size_t px_bytes, uint32_t dc_switches);
+};
+
+#endif // MOCK_LCD_BUS_H
@@ -0,0 +1,32 @@
+/*Configuration of the host harnesses that start threads or read files:
+ *the one of the firmware with pthread, the malloc of the C library, the POSIX file system,
+ *fonts larger than 1 MB, TrueType fonts, the fbdev and evdev drivers and moving scrolled content.*/
+#ifndef LV_CONF_OS_H
+#define LV_CONF_OS_H
+
+#include "../../../src/lv_conf.h"
+
+#define LV_USE_OS               LV_OS_PTHREAD
+#define LV_USE_STDLIB_MALLOC    LV_STDLIB_CLIB
+
+#define LV_USE_FS_POSIX         1
+#define LV_FS_POSIX_LETTER      'A'
+#define LV_FS_POSIX_MMAP        1
+
+/*The glyph bitmaps of a mapped font are used in place only if `bitmap_index` can address them*/
+#define LV_FONT_FMT_TXT_LARGE   1
+
+/*Without an atlas: tiny_ttf_atlas.c compiles lv_tiny_ttf.c again with one*/
+#define LV_USE_TINY_TTF         1
+
+/*Copying into the framebuffer: fbdev_flip.c compiles lv_linux_fbdev.c again with page flipping*/
+#define LV_USE_LINUX_FBDEV          1
+#define LV_LINUX_FBDEV_RENDER_MODE  LV_DISPLAY_RENDER_MODE_DIRECT
+#define LV_LINUX_FBDEV_BUFFER_COUNT 2
+
+#define LV_USE_EVDEV                1
+
+/*Only in LV_DISPLAY_RENDER_MODE_DIRECT, as the one of fbdev: the harnesses in PARTIAL mode don't use it*/
+#define LV_USE_SCROLL_BLIT          1
+
+#endif /*LV_CONF_OS_H*/
@@ -0,0 +1,209 @@
+// Grava as áreas invalidadas de cada quadro e as reproduz com lv_inv_area e lv_refr_now, juntando as
+// áreas como o LVGL fazia antes (custo 0 por flush e 1 por pixel) e com o modelo do painel SPI
+// (LV_DISPLAY_REFR_FLUSH_COST_SPI e LV_DISPLAY_REFR_PX_COST_SPI, o que o main.cpp usa). Mostra os flushes
+// e os pixels por quadro e o tempo que o modelo SPI estima para eles.
+//
+// Traços:
+//   pot sweep    Screen1 com o potenciômetro de 0% a 59% e o label de FPS, 60 quadros gravados
+//   pot steps    Screen1 com o potenciômetro entre 57% e 58% e o label de FPS, 60 quadros gravados
+//   fps label    Screen1 só com o label de FPS, 60 quadros gravados
+//   icons        6 ícones de 16 px com 4 px entre eles
+//   digits       4 dígitos de 12x20 de um relógio
+//   corners      4 labels nos cantos da tela
+//   chart        10 pontos de 6 px de um gráfico
+// Falha se um pixel invalidado não for enviado, se o modelo SPI estimar mais tempo que a junção antiga
+// num traço ou se não juntar os ícones e os dígitos em menos flushes.
+//
+// Compilar e rodar:
+//   make -C test/host run-refr_join
+// Só compilar: make -C test/host, o programa fica em .host/refr_join.
+
+#include <lvgl.h>
+#include <src/core/lv_refr_private.h>
+#include <ui/ui.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#define HOR_RES 240
+#define VER_RES 240
+#define FRAMES  60
+
+typedef std::vector<lv_area_t> Frame;
+typedef std::vector<Frame> Trace;
+
+struct Policy {
+    const char* name;
+    uint32_t flush_cost;
+    uint32_t px_cost;
+};
+
+struct Result {
+    uint64_t flushes;
+    uint64_t pixels;
+    uint32_t frames;
+    int missed;
+};
+
+alignas(4) static lv_color_t draw_buf[HOR_RES * VER_RES / 4];
+static uint32_t tick_ms;
+static Trace* recording;
+static bool refreshing;
+static uint64_t flushes;
+static uint64_t pixels;
+static bool flushed[HOR_RES * VER_RES];
+
+static uint32_t tick_cb() {
+    return tick_ms;
+}
+
+static void flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    flushes++;
+    pixels += lv_area_get_size(area);
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memset(&flushed[y * HOR_RES + area->x1], 1, lv_area_get_width(area));
+    }
+    lv_display_flush_ready(disp);
+}
+
+// Grava as áreas invalidadas fora do refresh: durante ele o LVGL manda o mesmo evento para ajustar a
+// altura das faixas do buffer
+static void display_event_cb(lv_event_t* e) {
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_REFR_START:
+            refreshing = true;
+            break;
+        case LV_EVENT_REFR_READY:
+            refreshing = false;
+            break;
+        default:
+            if (recording != NULL && !refreshing) {
+                recording->back().push_back(*static_cast<lv_area_t*>(lv_event_get_param(e)));
+            }
+            break;
+    }
+}
+
+static Trace record_ui(lv_display_t* disp, int scenario) {
+    Trace trace;
+    recording = &trace;
+    for (int f = 0; f < FRAMES; f++) {
+        trace.push_back(Frame());
+        tick_ms += 16;
+        const int value = scenario == 0 ? f : 57 + f % 2;
+        if (scenario < 2) {
+            lv_arc_set_value(ui_Arc1, value);
+            lv_label_set_text_fmt(ui_Label1, "%d%%", value);
+        }
+        lv_label_set_text_fmt(ui_Label2, "FPS: %d.%d", 30 + f % 3, f % 10);
+        lv_timer_handler();
+        lv_refr_now(disp);
+    }
+    recording = NULL;
+    return trace;
+}
+
+static Trace layout(int scenario) {
+    Frame frame;
+    for (int i = 0; i < 6 && scenario == 0; i++) {
+        frame.push_back({100 + i * 20, 2, 115 + i * 20, 17});
+    }
+    for (int i = 0; i < 4 && scenario == 1; i++) {
+        const int32_t x = 80 + i * 14 + (i >= 2) * 8;
+        frame.push_back({x, 200, x + 11, 219});
+    }
+    if (scenario == 2) {
+        frame.push_back({0, 0, 39, 15});
+        frame.push_back({200, 0, 239, 15});
+        frame.push_back({0, 224, 39, 239});
+        frame.push_back({200, 224, 239, 239});
+    }
+    for (int i = 0; i < 10 && scenario == 3; i++) {
+        const int32_t y = 120 + (i % 3) * 4;
+        frame.push_back({20 + i * 20, y, 25 + i * 20, y + 5});
+    }
+    return Trace(FRAMES, frame);
+}
+
+// Quadros sem áreas não são contados
+static Result replay(lv_display_t* disp, const Trace& trace, const Policy& policy) {
+    lv_display_set_refr_cost(disp, policy.flush_cost, policy.px_cost);
+    Result r = {};
+    flushes = 0;
+    pixels = 0;
+    for (const Frame& frame : trace) {
+        if (frame.empty()) {
+            continue;
+        }
+        memset(flushed, 0, sizeof(flushed));
+        for (const lv_area_t& a : frame) {
+            lv_area_t area = a;
+            lv_inv_area(disp, &area);
+        }
+        lv_refr_now(disp);
+        r.frames++;
+
+        for (const lv_area_t& a : frame) {
+            for (int32_t y = a.y1; y <= a.y2; y++) {
+                for (int32_t x = a.x1; x <= a.x2; x++) {
+                    r.missed += !flushed[y * HOR_RES + x];
+                }
+            }
+        }
+    }
+    r.flushes = flushes;
+    r.pixels = pixels;
+    return r;
+}
+
+static double modelled_us(const Result& r) {
+    return (r.flushes * (double)LV_DISPLAY_REFR_FLUSH_COST_SPI + r.pixels * (double)LV_DISPLAY_REFR_PX_COST_SPI) /
+           1000.0 / r.frames;
+}
+
+int main() {
+    lv_init();
+    lv_tick_set_cb(tick_cb);
+    lv_display_t* disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_add_event_cb(disp, display_event_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    lv_display_add_event_cb(disp, display_event_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(disp, display_event_cb, LV_EVENT_REFR_READY, NULL);
+    ui_init();
+    lv_refr_now(disp);
+
+    static const char* const names[] = {"pot sweep", "pot steps", "fps label", "icons", "digits", "corners",
+                                        "chart"};
+    std::vector<Trace> traces;
+    for (int scenario = 0; scenario < 3; scenario++) {
+        traces.push_back(record_ui(disp, scenario));
+    }
+    for (int scenario = 0; scenario < 4; scenario++) {
+        traces.push_back(layout(scenario));
+    }
+
+    static const Policy legacy = {"legacy", 0, 1};
+    static const Policy spi = {"SPI", LV_DISPLAY_REFR_FLUSH_COST_SPI, LV_DISPLAY_REFR_PX_COST_SPI};
+    bool ok = true;
+    for (size_t t = 0; t < traces.size(); t++) {
+        Result results[2];
+        for (int p = 0; p < 2; p++) {
+            const Policy& policy = p == 0 ? legacy : spi;
+            const Result& r = results[p] = replay(disp, traces[t], policy);
+            printf("%-9s %-6s %2u frames: %5.2f flushes/frame, %6llu px/frame, modelled %6.1f us/frame", names[t],
+                   policy.name, r.frames, r.flushes / (double)r.frames, (unsigned long long)(r.pixels / r.frames),
+                   modelled_us(r));
+            printf(r.missed ? ", %d invalidated pixels not flushed\n" : "\n", r.missed);
+            ok &= r.missed == 0;
+        }
+
+        // Os ícones e os dígitos estão perto o bastante para um flush só custar menos
+        const bool close = strcmp(names[t], "icons") == 0 || strcmp(names[t], "digits") == 0;
+        ok &= modelled_us(results[1]) <= modelled_us(results[0]);
+        ok &= !close || results[1].flushes < results[0].flushes;
+    }
+
+    lv_deinit();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,168 @@
+// Mede a rotação por software de lv_draw_sw_rotate, que o driver de fbdev e o de SDL fazem a cada área
+// enviada, em cada formato de cor, em 90, 180 e 270 graus.
+//
+// Primeiro confere cada formato e rotação pixel a pixel com uma rotação simples em tamanhos que não são
+// múltiplos dos ladrilhos de 32x32 e com sobra no fim das linhas. Depois mede em Mpx/s a rotação do LVGL
+// e a simples, que em 90 e 270 graus escreve uma linha inteira do destino por coluna da origem como o
+// LVGL fazia antes dos ladrilhos, numa tela de 1920x1080, numa de 800x480 e numa faixa de 240x24 do modo
+// parcial.
+//
+// Compilar e rodar:
+//   make -C test/host run-rotate_bench
+// Só compilar: make -C test/host, o programa fica em .host/rotate_bench.
+
+#include <lvgl.h>
+#include <src/draw/sw/lv_draw_sw.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_W 1920
+#define MAX_H 1080
+
+struct Format {
+    lv_color_format_t cf;
+    const char* name;
+};
+
+struct Size {
+    int32_t w;
+    int32_t h;
+    const char* name;
+};
+
+static const Format formats[] = {
+    {LV_COLOR_FORMAT_L8, "L8"},
+    {LV_COLOR_FORMAT_RGB565, "RGB565"},
+    {LV_COLOR_FORMAT_RGB888, "RGB888"},
+    {LV_COLOR_FORMAT_ARGB8888, "ARGB8888"},
+};
+
+static const lv_display_rotation_t rotations[] = {LV_DISPLAY_ROTATION_90, LV_DISPLAY_ROTATION_180,
+                                                  LV_DISPLAY_ROTATION_270};
+
+static uint8_t src[MAX_W * MAX_H * 4];
+static uint8_t dst[MAX_W * MAX_H * 4];
+static uint8_t ref[MAX_W * MAX_H * 4];
+
+template <int N>
+struct Pixel {
+    uint8_t bytes[N];
+};
+
+// Rotação simples, pixel a pixel: em 90 e 270 graus, para cada coluna da origem, uma linha inteira do
+// destino. Em 180 graus, linha por linha.
+template <int N>
+static void rotate_simple(const uint8_t* s, uint8_t* d, int32_t w, int32_t h, int32_t s_stride, int32_t d_stride,
+                          lv_display_rotation_t rotation) {
+    typedef Pixel<N> P;
+    if (rotation == LV_DISPLAY_ROTATION_180) {
+        for (int32_t y = 0; y < h; y++) {
+            const P* s_row = reinterpret_cast<const P*>(s + y * s_stride);
+            P* d_row = reinterpret_cast<P*>(d + (h - 1 - y) * d_stride);
+            for (int32_t x = 0; x < w; x++) {
+                d_row[w - 1 - x] = s_row[x];
+            }
+        }
+        return;
+    }
+    for (int32_t x = 0; x < w; x++) {
+        P* d_row = reinterpret_cast<P*>(d + (rotation == LV_DISPLAY_ROTATION_90 ? w - 1 - x : x) * d_stride);
+        for (int32_t y = 0; y < h; y++) {
+            const P px = *reinterpret_cast<const P*>(s + y * s_stride + x * N);
+            d_row[rotation == LV_DISPLAY_ROTATION_90 ? y : h - 1 - y] = px;
+        }
+    }
+}
+
+static void rotate_ref(const Format& f, int32_t w, int32_t h, int32_t s_stride, int32_t d_stride,
+                       lv_display_rotation_t rotation) {
+    switch (lv_color_format_get_size(f.cf)) {
+        case 1: rotate_simple<1>(src, ref, w, h, s_stride, d_stride, rotation); break;
+        case 2: rotate_simple<2>(src, ref, w, h, s_stride, d_stride, rotation); break;
+        case 3: rotate_simple<3>(src, ref, w, h, s_stride, d_stride, rotation); break;
+        default: rotate_simple<4>(src, ref, w, h, s_stride, d_stride, rotation); break;
+    }
+}
+
+static double now() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// Passo das linhas do destino: a largura dele é a altura da origem em 90 e 270 graus
+static int32_t dst_stride(const Format& f, int32_t w, int32_t h, lv_display_rotation_t rotation) {
+    return lv_draw_buf_width_to_stride(rotation == LV_DISPLAY_ROTATION_180 ? w : h, f.cf);
+}
+
+static bool check(const Format& f, int32_t w, int32_t h, int32_t pad) {
+    const uint32_t px_size = lv_color_format_get_size(f.cf);
+    const int32_t s_stride = w * px_size + pad;
+    bool ok = true;
+    for (lv_display_rotation_t rotation : rotations) {
+        const int32_t d_stride = dst_stride(f, w, h, rotation) + pad;
+        const int32_t d_w = rotation == LV_DISPLAY_ROTATION_180 ? w : h;
+        const int32_t d_h = rotation == LV_DISPLAY_ROTATION_180 ? h : w;
+        memset(dst, 0, d_stride * d_h);
+        memset(ref, 0, d_stride * d_h);
+        lv_draw_sw_rotate(src, dst, w, h, s_stride, d_stride, rotation, f.cf);
+        rotate_ref(f, w, h, s_stride, d_stride, rotation);
+        for (int32_t y = 0; y < d_h; y++) {
+            if (memcmp(dst + y * d_stride, ref + y * d_stride, d_w * px_size) != 0) {
+                printf("  %s %dx%d %d degrees: row %d differs\n", f.name, w, h, rotation * 90, y);
+                ok = false;
+                break;
+            }
+        }
+    }
+    return ok;
+}
+
+static double mpx_per_s(const Format& f, const Size& s, lv_display_rotation_t rotation, bool simple) {
+    const int32_t s_stride = lv_draw_buf_width_to_stride(s.w, f.cf);
+    const int32_t d_stride = dst_stride(f, s.w, s.h, rotation);
+    const int n = 800 * 480 * 10 / (s.w * s.h) + 1;
+    double best = 1e9;
+    for (int r = 0; r < 5; r++) {
+        const double start = now();
+        for (int i = 0; i < n; i++) {
+            if (simple) {
+                rotate_ref(f, s.w, s.h, s_stride, d_stride, rotation);
+            } else {
+                lv_draw_sw_rotate(src, dst, s.w, s.h, s_stride, d_stride, rotation, f.cf);
+            }
+        }
+        best = LV_MIN(best, now() - start);
+    }
+    return (double)s.w * s.h * n / best * 1e-6;
+}
+
+int main() {
+    lv_init();
+    for (size_t i = 0; i < sizeof(src); i++) {
+        src[i] = (uint8_t)(i * 2654435761u >> 13);
+    }
+
+    bool ok = true;
+    for (const Format& f : formats) {
+        ok &= check(f, 97, 61, 0);
+        ok &= check(f, 61, 97, 12);
+        ok &= check(f, 1, 40, 4);
+        ok &= check(f, 240, 24, 0);
+    }
+    printf("rotations: %s\n", ok ? "same pixels as the simple loop" : "WRONG PIXELS");
+
+    static const Size sizes[] = {{1920, 1080, "1920x1080"}, {800, 480, "800x480"}, {240, 24, "240x24 strip"}};
+    for (const Format& f : formats) {
+        for (const Size& s : sizes) {
+            for (lv_display_rotation_t rotation : rotations) {
+                printf("%-9s %-13s %3d: %7.1f Mpx/s, simple loop %7.1f Mpx/s\n", f.name, s.name, rotation * 90,
+                       mpx_per_s(f, s, rotation, false), mpx_per_s(f, s, rotation, true));
+            }
+        }
+    }
+
+    lv_deinit();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+// Mede o ui_init e o pico de heap da UI e navega entre as telas. Roda em dois programas:
+//   screen_lifecycle        telas construídas na primeira navegação (UI_LAZY_SCREENS 1, o do firmware)
+//   screen_lifecycle_eager  todas as telas construídas no ui_init (UI_LAZY_SCREENS 0, com ui_eager.c)
+//
+// Depois do ui_init navega 20 vezes pelo ciclo Screen2 -> Screen3 -> Screen2 -> Screen1 e falha se uma
+// navegação não mostrar a tela pedida ou se o heap usado crescer de um ciclo para outro. No modo
+// preguiçoso também falha se o ui_init construir mais que a Screen1 ou se nenhum objeto sair do pool.
+//
+// Compilar e rodar:
+//   make -C test/host run-screen_lifecycle run-screen_lifecycle_eager
+// Só compilar: make -C test/host, os programas ficam em .host/screen_lifecycle e
+// .host/screen_lifecycle_eager.
+
+#include <lvgl.h>
+#include <ui/ui.h>
+#include <stdio.h>
+#include <time.h>
+
+#define CYCLES 20
+
+static uint32_t tick_ms;
+static uint8_t draw_buf[240 * 60 * 2];
+
+static uint32_t tick_cb() {
+    return tick_ms;
+}
+
+static void flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    lv_display_flush_ready(disp);
+}
+
+static double now_us() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e6 + t.tv_nsec * 1e-3;
+}
+
+static void run(int steps) {
+    for (int i = 0; i < steps; i++) {
+        tick_ms += 5;
+        lv_timer_handler();
+    }
+}
+
+static size_t heap_used() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+static bool go(ui_screen_t* screen, ui_screen_t* next) {
+    _ui_screen_lazy_change(screen, LV_SCR_LOAD_ANIM_NONE, 0, 0, next);
+    run(40);
+    return lv_screen_active() == *screen->target;
+}
+
+int main() {
+    lv_init();
+    lv_tick_set_cb(tick_cb);
+    lv_display_t* disp = lv_display_create(240, 240);
+    lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    const size_t before = mon.max_used;
+    const double start = now_us();
+    ui_init();
+    const double init_us = now_us() - start;
+    lv_mem_monitor(&mon);
+
+    const bool lazy = ui_Screen2 == NULL;
+    printf("%s: ui_init %.0f us, heap peak %zu B (%zu B before ui_init)\n", lazy ? "lazy" : "eager", init_us,
+           mon.max_used, before);
+    bool ok = !lazy || ui_Screen3 == NULL;
+
+    size_t used_first = 0;
+    for (int c = 0; c < CYCLES && ok; c++) {
+        ok &= go(&ui_Screen2_dsc, &ui_Screen3_dsc);
+        ok &= go(&ui_Screen3_dsc, &ui_Screen2_dsc);
+        ok &= go(&ui_Screen2_dsc, &ui_Screen1_dsc);
+        ok &= go(&ui_Screen1_dsc, &ui_Screen2_dsc);
+        if (c == 1) {
+            used_first = heap_used();
+        }
+    }
+    if (!ok) {
+        printf("a navigation didn't show its screen\n");
+        return 1;
+    }
+
+    lv_mem_monitor(&mon);
+    const size_t used_last = heap_used();
+    const uint32_t reused = lv_obj_class_pool_get_reuse_count();
+    printf("%d cycles: heap used %zu B after the 2nd and %zu B after the last, peak %zu B, %u objects reused\n",
+           CYCLES, used_first, used_last, mon.max_used, reused);
+    ok = used_last <= used_first && (!lazy || reused > 0);
+
+    ui_destroy();
+    lv_deinit();
+    return ok ? 0 : 1;
+}
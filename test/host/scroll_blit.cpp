@@ -0,0 +1,203 @@
+// Rola um contêiner de 200x200 com 40 botões numa tela de 240x240 em LV_DISPLAY_RENDER_MODE_DIRECT, por
+// uma animação que muda de direção no meio, e mostra os pixels renderizados e enviados por quadro. Roda
+// em dois programas:
+//   scroll_redraw  redesenha o contêiner inteiro a cada passo (LV_USE_SCROLL_BLIT 0, configuração fw)
+//   scroll_blit    move o que já foi renderizado e redesenha só as faixas novas (LV_USE_SCROLL_BLIT 1,
+//                  configuração os)
+//
+// Casos: uma coluna de botões, um lv_list e botões mais largos que o contêiner rolados na diagonal, com
+// um e com dois buffers, e três em que o conteúdo não pode ser movido: um label por cima, o contêiner
+// translúcido e um retângulo desenhado no LV_EVENT_DRAW_POST.
+// Falha se um quadro não for igual ao redesenho da tela inteira ou, com LV_USE_SCROLL_BLIT, se os casos
+// sem nada por cima renderizarem mais que metade do contêiner por quadro. O make run confere que os dois
+// programas mostram os mesmos quadros.
+//
+// Compilar e rodar:
+//   make -C test/host run-scroll_redraw run-scroll_blit
+// Só compilar: make -C test/host, os programas ficam em .host/scroll_redraw e .host/scroll_blit.
+
+#include <lvgl.h>
+#include <src/display/lv_display_private.h>
+#include <stdio.h>
+#include <string.h>
+
+#define HOR_RES 240
+#define VER_RES 240
+#define FRAMES  60
+#define SIZE    200
+
+enum Kind { COLUMN, LIST, WIDE };
+enum Cover { NONE, LABEL, TRANSLUCENT, DRAW_POST };
+
+static uint16_t fb1[HOR_RES * VER_RES];
+static uint16_t fb2[HOR_RES * VER_RES];
+static uint16_t panel[HOR_RES * VER_RES];
+static uint16_t redrawn[HOR_RES * VER_RES];
+static uint32_t tick_ms;
+static uint64_t rendered;
+static uint64_t flushed;
+static int frames;
+static uint32_t hash = 2166136261u;
+
+static uint32_t tick_cb() {
+    return tick_ms;
+}
+
+// Em modo direto px_map é o buffer da tela inteira
+static void flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    const uint16_t* px = reinterpret_cast<const uint16_t*>(px_map);
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&panel[y * HOR_RES + area->x1], &px[y * HOR_RES + area->x1], lv_area_get_width(area) * 2);
+    }
+    flushed += lv_area_get_size(area);
+    lv_display_flush_ready(disp);
+}
+
+// As áreas que serão renderizadas, depois de juntadas
+static void render_start_cb(lv_event_t* e) {
+    const lv_display_t* disp = static_cast<lv_display_t*>(lv_event_get_target(e));
+    frames++;
+    for (uint32_t i = 0; i < disp->inv_p; i++) {
+        if (!disp->inv_area_joined[i]) {
+            rendered += lv_area_get_size(&disp->inv_areas[i]);
+        }
+    }
+}
+
+static void draw_post_cb(lv_event_t* e) {
+    const lv_obj_t* obj = static_cast<lv_obj_t*>(lv_event_get_target(e));
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = lv_color_hex(0xff0000);
+    lv_area_t area;
+    lv_obj_get_coords(obj, &area);
+    area.x1 += 20;
+    area.y1 += 20;
+    area.x2 = area.x1 + 30;
+    area.y2 = area.y1 + 30;
+    lv_draw_rect(lv_event_get_layer(e), &dsc, &area);
+}
+
+static lv_obj_t* create_container(Kind kind, Cover cover) {
+    lv_obj_clean(lv_screen_active());
+    lv_obj_t* cont = kind == LIST ? lv_list_create(lv_screen_active()) : lv_obj_create(lv_screen_active());
+    if (kind != LIST) {
+        lv_obj_set_flex_flow(cont, kind == WIDE ? LV_FLEX_FLOW_ROW_WRAP : LV_FLEX_FLOW_COLUMN);
+    }
+    lv_obj_set_style_radius(cont, 0, 0);
+    lv_obj_set_size(cont, SIZE, SIZE);
+    lv_obj_center(cont);
+
+    char text[8];
+    for (int i = 0; i < 40; i++) {
+        snprintf(text, sizeof(text), "%d", i);
+        if (kind == LIST) {
+            lv_list_add_button(cont, NULL, text);
+        } else {
+            lv_obj_t* button = lv_button_create(cont);
+            lv_obj_set_width(button, kind == WIDE ? 300 : LV_PCT(100));
+            lv_label_set_text(lv_label_create(button), text);
+        }
+    }
+
+    if (cover == LABEL) {
+        lv_obj_t* label = lv_label_create(lv_screen_active());
+        lv_label_set_text(label, "50%");
+        lv_obj_center(label);
+    } else if (cover == TRANSLUCENT) {
+        lv_obj_set_style_opa(cont, LV_OPA_50, 0);
+    } else if (cover == DRAW_POST) {
+        lv_obj_add_event_cb(cont, draw_post_cb, LV_EVENT_DRAW_POST, NULL);
+    }
+    return cont;
+}
+
+static void scroll(lv_obj_t* cont, Kind kind, int dx, int dy) {
+    lv_obj_scroll_by(cont, kind == WIDE ? dx : 0, dy, LV_ANIM_ON);
+}
+
+// Pixels do painel diferentes do redesenho da tela inteira
+static int wrong_pixels(lv_display_t* disp) {
+    memcpy(redrawn, panel, sizeof(panel));
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+    int wrong = 0;
+    for (int i = 0; i < HOR_RES * VER_RES; i++) {
+        wrong += panel[i] != redrawn[i];
+    }
+    return wrong;
+}
+
+// Sem verify mede os pixels por quadro renderizado; com verify confere cada quadro, e o redesenho não entra
+// na conta
+static int run(lv_display_t* disp, Kind kind, bool double_buf, Cover cover, bool verify) {
+    lv_display_set_buffers(disp, fb1, double_buf ? fb2 : NULL, sizeof(fb1), LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_obj_t* cont = create_container(kind, cover);
+    lv_refr_now(disp);
+
+    rendered = 0;
+    flushed = 0;
+    frames = 0;
+    int wrong = 0;
+    scroll(cont, kind, -60, -600);
+    for (int f = 0; f < FRAMES; f++) {
+        tick_ms += 16;
+        lv_timer_handler();
+        lv_refr_now(disp);
+        if (verify) {
+            for (uint16_t px : panel) {
+                hash = (hash ^ (px & 0xff)) * 16777619u;
+                hash = (hash ^ (px >> 8)) * 16777619u;
+            }
+            wrong += wrong_pixels(disp);
+        }
+        if (f == 20) {
+            scroll(cont, kind, 30, 200);
+        }
+    }
+    return verify ? wrong : rendered / frames;
+}
+
+int main() {
+    lv_init();
+    lv_tick_set_cb(tick_cb);
+    lv_display_t* disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_add_event_cb(disp, render_start_cb, LV_EVENT_RENDER_START, NULL);
+
+    struct Case {
+        Kind kind;
+        bool double_buf;
+        Cover cover;
+        const char* name;
+    };
+    static const Case cases[] = {
+        {COLUMN, false, NONE, "column"},
+        {COLUMN, true, NONE, "column, 2 buffers"},
+        {LIST, false, NONE, "list"},
+        {LIST, true, NONE, "list, 2 buffers"},
+        {WIDE, false, NONE, "diagonal"},
+        {WIDE, true, NONE, "diagonal, 2 buffers"},
+        {COLUMN, false, LABEL, "column, label over"},
+        {COLUMN, false, TRANSLUCENT, "column, translucent"},
+        {COLUMN, false, DRAW_POST, "column, draw post"},
+    };
+
+    printf("LV_USE_SCROLL_BLIT %d, container %d px\n", LV_USE_SCROLL_BLIT, SIZE * SIZE);
+    bool ok = true;
+    for (const Case& c : cases) {
+        const int rendered_per_frame = run(disp, c.kind, c.double_buf, c.cover, false);
+        const uint64_t flushed_per_frame = flushed / frames;
+        const int rendered_frames = frames;
+        const int wrong = run(disp, c.kind, c.double_buf, c.cover, true);
+        printf("%-20s: %d frames, rendered %5d px/frame, flushed %5llu px/frame, %d pixels differ from a redraw\n",
+               c.name, rendered_frames, rendered_per_frame, (unsigned long long)flushed_per_frame, wrong);
+        ok &= wrong == 0;
+        ok &= !LV_USE_SCROLL_BLIT || c.cover != NONE || rendered_per_frame < SIZE * SIZE / 2;
+    }
+    printf("frames hash 0x%08x\n", hash);
+
+    lv_deinit();
+    return ok ? 0 : 1;
+}
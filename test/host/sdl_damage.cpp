@@ -0,0 +1,101 @@
+// Roda o driver de SDL do LVGL com o driver de vídeo dummy do SDL, sem janela nem GPU, e muda o valor de
+// um arco de 300x300 numa tela de 480x480 por 100 quadros. Mostra quantos bytes o driver enviou para a
+// textura por quadro e o tempo por quadro. SDL_UpdateTexture é interceptado pelo ligador (--wrap) para
+// somar os retângulos enviados de fato.
+// Falha se a textura apresentada não tiver os pixels do framebuffer depois de cada quadro, se a soma dos
+// retângulos não for o que lv_sdl_window_get_uploaded_bytes conta ou se um quadro enviar a tela inteira.
+//
+// Precisa do SDL2 (pkg-config sdl2, por exemplo o pacote libsdl2-dev). Sem ele o make pula este programa.
+//
+// Compilar e rodar:
+//   make -C test/host run-sdl_damage
+// Só compilar: make -C test/host, o programa fica em .host/sdl_damage.
+
+#define LV_USE_SDL 1
+
+#include <lvgl.h>
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define HOR_RES 480
+#define VER_RES 480
+#define FRAMES  100
+#define PX_SIZE 2
+
+static uint64_t updated_bytes;
+static uint16_t presented[HOR_RES * VER_RES];
+
+extern "C" int __real_SDL_UpdateTexture(SDL_Texture* texture, const SDL_Rect* rect, const void* pixels, int pitch);
+
+extern "C" int __wrap_SDL_UpdateTexture(SDL_Texture* texture, const SDL_Rect* rect, const void* pixels, int pitch) {
+    int w;
+    int h;
+    SDL_QueryTexture(texture, NULL, NULL, &w, &h);
+    updated_bytes += (uint64_t)(rect ? rect->w * rect->h : w * h) * PX_SIZE;
+    return __real_SDL_UpdateTexture(texture, rect, pixels, pitch);
+}
+
+static double now() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// Pixels da janela diferentes do framebuffer
+static int wrong_pixels(lv_display_t* disp) {
+    SDL_Renderer* renderer = static_cast<SDL_Renderer*>(lv_sdl_window_get_renderer(disp));
+    if (SDL_RenderReadPixels(renderer, NULL, SDL_PIXELFORMAT_RGB565, presented, HOR_RES * PX_SIZE) != 0) {
+        printf("SDL_RenderReadPixels: %s\n", SDL_GetError());
+        return HOR_RES * VER_RES;
+    }
+    const lv_draw_buf_t* fb = lv_display_get_buf_active(disp);
+    int wrong = 0;
+    for (int y = 0; y < VER_RES; y++) {
+        const uint16_t* row = reinterpret_cast<const uint16_t*>(fb->data + y * fb->header.stride);
+        for (int x = 0; x < HOR_RES; x++) {
+            wrong += row[x] != presented[y * HOR_RES + x];
+        }
+    }
+    return wrong;
+}
+
+int main() {
+    setenv("SDL_VIDEODRIVER", "dummy", 1);
+    lv_init();
+    lv_display_t* disp = lv_sdl_window_create(HOR_RES, VER_RES);
+    printf("SDL video driver: %s\n", SDL_GetCurrentVideoDriver());
+
+    lv_obj_t* arc = lv_arc_create(lv_screen_active());
+    lv_obj_set_size(arc, 300, 300);
+    lv_obj_center(arc);
+    lv_refr_now(disp);
+    const uint64_t first = lv_sdl_window_get_uploaded_bytes(disp);
+
+    int wrong = wrong_pixels(disp);
+    uint64_t max_frame = 0;
+    double busy = 0;
+    for (int f = 0; f < FRAMES; f++) {
+        const uint64_t before = lv_sdl_window_get_uploaded_bytes(disp);
+        lv_arc_set_value(arc, f);
+        const double start = now();
+        lv_refr_now(disp);
+        busy += now() - start;
+        max_frame = LV_MAX(max_frame, lv_sdl_window_get_uploaded_bytes(disp) - before);
+        wrong += wrong_pixels(disp);
+    }
+    const uint64_t total = lv_sdl_window_get_uploaded_bytes(disp);
+
+    const uint64_t full = HOR_RES * VER_RES * PX_SIZE;
+    printf("first frame %llu B, then %llu B/frame (at most %llu, full frame %llu), %.0f us/frame\n",
+           (unsigned long long)first, (unsigned long long)((total - first) / FRAMES), (unsigned long long)max_frame,
+           (unsigned long long)full, busy * 1e6 / FRAMES);
+    printf("SDL_UpdateTexture %llu B, %d pixels differ from the frame buffer\n", (unsigned long long)updated_bytes,
+           wrong);
+
+    const bool ok = wrong == 0 && updated_bytes == total && max_frame < full;
+    lv_deinit();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,20 @@
+// O driver de SDL do LVGL, para o sdl_damage. A liblvgl.a é compilada sem LV_USE_SDL, para não
+// depender do SDL2, então os arquivos do driver são compilados aqui. Cada um tem o seu
+// release_indev_cb estático, renomeado para caberem no mesmo arquivo.
+
+#define LV_USE_SDL          1
+#define LV_SDL_ACCELERATED  0
+
+#include "../../lib/lvgl/src/drivers/sdl/lv_sdl_window.c"
+
+#define release_indev_cb mouse_release_indev_cb
+#include "../../lib/lvgl/src/drivers/sdl/lv_sdl_mouse.c"
+#undef release_indev_cb
+
+#define release_indev_cb mousewheel_release_indev_cb
+#include "../../lib/lvgl/src/drivers/sdl/lv_sdl_mousewheel.c"
+#undef release_indev_cb
+
+#define release_indev_cb keyboard_release_indev_cb
+#include "../../lib/lvgl/src/drivers/sdl/lv_sdl_keyboard.c"
+#undef release_indev_cb
@@ -0,0 +1,88 @@
+// Mede lv_timer_handler com 1000 timers de períodos aleatórios, avançando o tick 1 ms por chamada, para
+// períodos até 100, 1000 e 10000 ms. Mostra o tempo por chamada e os callbacks por chamada, e confere que
+// cada timer rodou o número de vezes esperado pelo seu período.
+//
+// Compilar e rodar:
+//   make -C test/host run-timer_bench
+// Só compilar: make -C test/host, o programa fica em .host/timer_bench.
+
+#include <lvgl.h>
+#include <stdio.h>
+#include <time.h>
+
+#define TIMERS 1000
+#define STEPS  20000
+
+struct TimerCount {
+    uint32_t period;
+    uint32_t calls;
+};
+
+static uint32_t tick_ms;
+static TimerCount counts[TIMERS];
+
+static uint32_t tick_cb() {
+    return tick_ms;
+}
+
+static void timer_cb(lv_timer_t* timer) {
+    static_cast<TimerCount*>(lv_timer_get_user_data(timer))->calls++;
+}
+
+static double now() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static bool bench(uint32_t max_period) {
+    lv_timer_t* timers[TIMERS];
+    uint32_t seed = 12345;
+    for (int i = 0; i < TIMERS; i++) {
+        seed = seed * 1103515245u + 12345u;
+        counts[i] = {10 + (seed >> 8) % (max_period - 9), 0};
+        timers[i] = lv_timer_create(timer_cb, counts[i].period, &counts[i]);
+    }
+
+    const double start = now();
+    for (int i = 0; i < STEPS; i++) {
+        tick_ms++;
+        lv_timer_handler();
+    }
+    const double elapsed = now() - start;
+
+    uint64_t calls = 0;
+    int wrong = 0;
+    for (int i = 0; i < TIMERS; i++) {
+        const uint32_t expected = STEPS / counts[i].period;
+        if (counts[i].calls + 1 < expected || counts[i].calls > expected + 1) {
+            if (wrong++ == 0) {
+                printf("  timer %d, period %u: %u calls, expected %u\n", i, counts[i].period, counts[i].calls,
+                       expected);
+            }
+        }
+        calls += counts[i].calls;
+        lv_timer_delete(timers[i]);
+    }
+
+    printf("periods 10..%u ms: %.2f us/handler call, %.1f callbacks/call\n", max_period, elapsed * 1e6 / STEPS,
+           (double)calls / STEPS);
+    if (wrong > 0) {
+        printf("  %d timers with a wrong call count\n", wrong);
+    }
+    return wrong == 0;
+}
+
+int main() {
+    lv_init();
+    lv_tick_set_cb(tick_cb);
+
+    bool ok = true;
+    const uint32_t max_periods[] = {100, 1000, 10000};
+    for (uint32_t max_period : max_periods) {
+        ok &= bench(max_period);
+    }
+
+    lv_deinit();
+    return ok ? 0 : 1;
+}
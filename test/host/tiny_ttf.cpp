@@ -0,0 +1,150 @@
+// Busca glifos de uma fonte TrueType de 48 px pelo tiny_ttf como o lv_draw_label faz e mostra o tempo
+// por glifo, o tempo do primeiro texto, os contadores do cache e o heap usado. Roda em dois programas:
+//   tiny_ttf        só o cache por glifo (LV_TINY_TTF_ATLAS_SIZE 0, o da configuração os)
+//   tiny_ttf_atlas  com o atlas de glifos em páginas de 256x256 (com tiny_ttf_atlas.c)
+//
+// Casos:
+//   readout    textos de 8 caracteres com os 12 de um mostrador numérico, sem e com lv_tiny_ttf_prerender
+//   ascii      textos de 32 caracteres com os 94 ASCII visíveis, com cache de 256 e de 32 glifos
+// A fonte é a arial.ttf que vem com o LVGL, sem kerning. Falha se um glifo pré-renderizado for
+// rasterizado de novo. O make run confere que os dois programas dão o mesmo hash dos bitmaps.
+// O heap é contado nas alocações do LVGL, interceptadas pelo ligador (--wrap): o mallinfo da glibc não
+// mostra bem blocos pequenos devolvidos e reusados.
+//
+// Compilar e rodar:
+//   make -C test/host run-tiny_ttf run-tiny_ttf_atlas
+// Só compilar: make -C test/host, os programas ficam em .host/tiny_ttf e .host/tiny_ttf_atlas.
+
+#include <lvgl.h>
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+#define FONT_PATH "lib/lvgl/src/libs/freetype/arial.ttf"
+#define FONT_SIZE 48
+
+static std::vector<uint8_t> ttf;
+static lv_draw_buf_t* draw_buf;
+static uint32_t hash = 2166136261u;
+static size_t heap_used;
+
+extern "C" void* __real_lv_malloc_core(size_t size);
+extern "C" void* __real_lv_realloc_core(void* p, size_t new_size);
+extern "C" void __real_lv_free_core(void* p);
+
+extern "C" void* __wrap_lv_malloc_core(size_t size) {
+    void* p = __real_lv_malloc_core(size);
+    heap_used += malloc_usable_size(p);
+    return p;
+}
+
+extern "C" void* __wrap_lv_realloc_core(void* p, size_t new_size) {
+    heap_used -= malloc_usable_size(p);
+    p = __real_lv_realloc_core(p, new_size);
+    heap_used += malloc_usable_size(p);
+    return p;
+}
+
+extern "C" void __wrap_lv_free_core(void* p) {
+    heap_used -= malloc_usable_size(p);
+    __real_lv_free_core(p);
+}
+
+static double now() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// Como o lv_draw_label: descritor, bitmap e liberação de cada glifo, com o hash das linhas do bitmap
+static void draw_text(lv_font_t* font, const char* text) {
+    for (const char* c = text; *c; c++) {
+        lv_font_glyph_dsc_t g;
+        if (!lv_font_get_glyph_dsc(font, &g, *c, c[1]) || g.box_w == 0 || g.box_h == 0) {
+            continue;
+        }
+        const lv_draw_buf_t* bitmap = static_cast<const lv_draw_buf_t*>(lv_font_get_glyph_bitmap(&g, draw_buf));
+        if (bitmap != NULL) {
+            for (uint32_t y = 0; y < g.box_h; y++) {
+                const uint8_t* p = bitmap->data + y * bitmap->header.stride;
+                for (uint32_t x = 0; x < g.box_w; x++) {
+                    hash = (hash ^ p[x]) * 16777619u;
+                }
+            }
+        }
+        lv_font_glyph_release_draw_data(&g);
+    }
+}
+
+static bool run(const char* name, const char* chars, int text_len, int texts, int cache, bool prerender) {
+    const size_t heap = heap_used;
+    lv_font_t* font = lv_tiny_ttf_create_data_ex(ttf.data(), ttf.size(), FONT_SIZE, LV_FONT_KERNING_NONE, cache);
+    if (prerender) {
+        lv_tiny_ttf_prerender(font, chars);
+    }
+
+    srand(1);
+    const int n = strlen(chars);
+    char text[64];
+    double first = 0;
+    const double start = now();
+    for (int i = 0; i < texts; i++) {
+        for (int k = 0; k < text_len; k++) {
+            text[k] = chars[rand() % n];
+        }
+        text[text_len] = '\0';
+        draw_text(font, text);
+        if (i == 0) {
+            first = now() - start;
+        }
+    }
+    const double total = now() - start;
+
+    lv_tiny_ttf_cache_stats_t s;
+    lv_tiny_ttf_get_cache_stats(font, &s);
+    printf("%-8s cache %3d%s: 1st text %5.0f us, %5.2f us/glyph, %3.0f%% hits, %u evicted pages, heap %zu kB\n", name,
+           cache, prerender ? " prerendered" : "            ", first * 1e6, total * 1e6 / (texts * text_len),
+           100.0 * s.hit_cnt / (s.hit_cnt + s.miss_cnt), s.evict_cnt, (heap_used - heap) / 1024);
+    lv_tiny_ttf_destroy(font);
+
+    // Com cache para todos, um glifo pré-renderizado nunca falta
+    const bool ok = !prerender || cache < n || s.miss_cnt == 0;
+    if (!ok) {
+        printf("  %u misses after the prerender\n", s.miss_cnt);
+    }
+    return ok;
+}
+
+int main() {
+    lv_init();
+    FILE* f = fopen(FONT_PATH, "rb");
+    if (f == NULL) {
+        printf("can't open " FONT_PATH "\n");
+        return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    ttf.resize(ftell(f));
+    rewind(f);
+    fread(ttf.data(), 1, ttf.size(), f);
+    fclose(f);
+    draw_buf = lv_draw_buf_create(256, 256, LV_COLOR_FORMAT_A8, 0);
+
+    static char ascii[95];
+    for (int i = 0; i < 94; i++) {
+        ascii[i] = '!' + i;
+    }
+
+    bool ok = run("readout", "0123456789.-", 8, 20000, 256, false);
+    ok &= run("readout", "0123456789.-", 8, 20000, 256, true);
+    ok &= run("ascii", ascii, 32, 5000, 256, false);
+    ok &= run("ascii", ascii, 32, 5000, 32, false);
+    ok &= run("ascii", ascii, 32, 5000, 32, true);
+    printf("bitmaps hash 0x%08x\n", hash);
+
+    lv_draw_buf_destroy(draw_buf);
+    lv_deinit();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,7 @@
+// tiny_ttf com o atlas de glifos, para o tiny_ttf_atlas. A configuração os não define
+// LV_TINY_TTF_ATLAS_SIZE, então o lv_tiny_ttf.c da liblvgl.a usa só o cache por glifo. Os símbolos do
+// lv_tiny_ttf.c já estão aqui, então o ligador não puxa os da liblvgl.a.
+
+#define LV_TINY_TTF_ATLAS_SIZE 256
+
+#include "../../lib/lvgl/src/libs/tiny_ttf/lv_tiny_ttf.c"
@@ -0,0 +1,7 @@
+// A UI com todas as telas construídas no ui_init (UI_LAZY_SCREENS 0), para o screen_lifecycle_eager.
+// Os símbolos de ui.c e ui_helpers.c já estão aqui, então o ligador não puxa os da liblvgl.a.
+
+#define UI_LAZY_SCREENS 0
+
+#include "../../src/ui/ui.c"
+#include "../../src/ui/ui_helpers.c"